@@ -0,0 +1,634 @@
+// Benchmark paketi: parse / dönüşüm / RANSAC / kesişim / SVG (mikro) ve uçtan uca akış (makro).
+// Çıktı: satır başına bir JSON kaydı (JSON Lines). Alan adları ve sırası sabittir,
+// sürümler arası regresyon takibinde doğrudan karşılaştırılabilir.
+#include "synthetic_scan.hpp"
+#include "model/downsample.hpp"
+#include "model/fusion.hpp"
+#include "model/occupancy_grid.hpp"
+#include "model/outlier_filter.hpp"
+#include "model/parallel_ransac.hpp"
+#include "model/geometry.hpp"
+#include "model/lidar.hpp"
+#include "model/line_map.hpp"
+#include "model/ransac.hpp"
+#include "model/sector_scan.hpp"
+#include "model/toml_parser.hpp"
+#include "model/toml_writer.hpp"
+#include "utils/cli.hpp"
+#include "utils/scan_arena.hpp"
+#include "utils/snapshot_publisher.hpp"
+#include "view/raster_writer.hpp"
+#include "view/result_writer.hpp"
+#include "view/svg_writer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Heap ayırma sayacı: "alloc" benchmark'ı tarama başına malloc sayısını raporlar
+static std::atomic<size_t> g_heapAllocations{0};
+
+void* operator new(std::size_t n) {
+    g_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+
+// pmr::new_delete_resource hizalı sürümleri çağırır
+void* operator new(std::size_t n, std::align_val_t al) {
+    g_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    const std::size_t a = static_cast<std::size_t>(al);
+    if (void* p = std::aligned_alloc(a, (std::max<std::size_t>(n, 1) + a - 1) / a * a)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+namespace {
+
+constexpr const char* kSchema = "lidar-bench/1";
+constexpr uint32_t kRansacSeed = 1; // Sabit tohum: sürümler arası karşılaştırılabilir RANSAC işi
+
+struct BenchOptions {
+    std::vector<size_t> beams    = {360, 3600, 36000, 360000, 1000000};
+    std::vector<size_t> segments = {16, 128, 1024};
+    int    walls          = 4;
+    double noise          = 0.005;
+    double dropout        = 0.02;
+    double minTimeSec     = 0.25;
+    int    minReps        = 5;
+    int    maxReps        = 1000;
+    size_t ransacMaxBeams = 36000; // RANSAC + makro için üst sınır (uç noktalar O(n^2))
+    std::string filter;            // İsimde geçmesi gereken alt dize
+    std::string outPath;           // Boşsa stdout
+};
+
+struct Stats {
+    size_t reps = 0;
+    double meanNs = 0, minNs = 0, maxNs = 0, p50Ns = 0, p90Ns = 0, p99Ns = 0;
+};
+
+volatile size_t g_sink = 0; // Derleyicinin ölçülen işi silmesini engeller
+
+double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size()));
+    return sorted[std::min(sorted.size() - 1, rank == 0 ? 0 : rank - 1)];
+}
+
+Stats measure(const BenchOptions& opt, const std::function<size_t()>& body) {
+    using clock = std::chrono::steady_clock;
+    std::vector<double> samples;
+    double total = 0.0;
+
+    while ((int)samples.size() < opt.maxReps &&
+           ((int)samples.size() < opt.minReps || total < opt.minTimeSec * 1e9)) {
+        auto t0 = clock::now();
+        g_sink = g_sink + body();
+        auto t1 = clock::now();
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        samples.push_back(ns);
+        total += ns;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    Stats s;
+    s.reps   = samples.size();
+    s.meanNs = total / samples.size();
+    s.minNs  = samples.front();
+    s.maxNs  = samples.back();
+    s.p50Ns  = percentile(samples, 50);
+    s.p90Ns  = percentile(samples, 90);
+    s.p99Ns  = percentile(samples, 99);
+    return s;
+}
+
+class Reporter {
+public:
+    explicit Reporter(std::ostream& os) : m_os(os) {}
+
+    void meta(const BenchOptions& opt) {
+        m_os << "{\"schema\":\"" << kSchema << "\",\"type\":\"meta\""
+             << ",\"compiler\":\"" << compilerId() << "\""
+             << ",\"build_type\":\"" << LIDAR_BENCH_BUILD_TYPE << "\""
+             << ",\"hw_threads\":" << std::thread::hardware_concurrency()
+             << ",\"walls\":" << opt.walls
+             << ",\"noise\":" << opt.noise
+             << ",\"dropout\":" << opt.dropout
+             << "}\n";
+    }
+
+    // items: bir tekrarda işlenen öğe sayısı (ışın, parça çifti, nokta ...)
+    void result(const char* bench, const char* kind, const char* unit,
+                size_t size, size_t items, const Stats& s) {
+        char buf[512];
+        std::snprintf(buf, sizeof(buf),
+            "{\"schema\":\"%s\",\"type\":\"result\",\"bench\":\"%s\",\"kind\":\"%s\","
+            "\"size\":%zu,\"unit\":\"%s\",\"items\":%zu,\"reps\":%zu,"
+            "\"items_per_s\":%.6g,\"mean_ns\":%.0f,\"min_ns\":%.0f,\"p50_ns\":%.0f,"
+            "\"p90_ns\":%.0f,\"p99_ns\":%.0f,\"max_ns\":%.0f}\n",
+            kSchema, bench, kind, size, unit, items, s.reps,
+            s.p50Ns > 0 ? items * 1e9 / s.p50Ns : 0.0,
+            s.meanNs, s.minNs, s.p50Ns, s.p90Ns, s.p99Ns, s.maxNs);
+        m_os << buf << std::flush;
+    }
+
+    // Tarama başına heap ayırma: varsayılan kaynak ve ScanArena (ısınma sonrası)
+    void alloc(size_t size, size_t scans, double perScanDefault, double perScanArena, size_t arenaBytes) {
+        char buf[320];
+        std::snprintf(buf, sizeof(buf),
+            "{\"schema\":\"%s\",\"type\":\"alloc\",\"bench\":\"alloc\",\"kind\":\"macro\","
+            "\"size\":%zu,\"scans\":%zu,\"mallocs_per_scan_default\":%.1f,"
+            "\"mallocs_per_scan_arena\":%.1f,\"arena_bytes\":%zu}\n",
+            kSchema, size, scans, perScanDefault, perScanArena, arenaBytes);
+        m_os << buf << std::flush;
+    }
+
+private:
+    static std::string compilerId() {
+#if defined(__clang__)
+        return std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+        return std::string("gcc ") + __VERSION__;
+#elif defined(_MSC_VER)
+        return "msvc " + std::to_string(_MSC_VER);
+#else
+        return "unknown";
+#endif
+    }
+
+    std::ostream& m_os;
+};
+
+bool parseList(const char* s, std::vector<size_t>& out) {
+    out.clear();
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        char* end = nullptr;
+        unsigned long long v = std::strtoull(item.c_str(), &end, 10);
+        if (!end || *end != '\0' || v == 0) return false;
+        out.push_back(static_cast<size_t>(v));
+    }
+    return !out.empty();
+}
+
+void printHelp(const char* exe) {
+    std::cout
+      << "Usage:\n  " << exe << " [options]\n\n"
+      << "      --beams <n,n,...>        Sentetik tarama boyutlari (default: 360,...,1000000)\n"
+      << "      --segments <n,n,...>     Kesisim benchmark'i parca sayilari (default: 16,128,1024)\n"
+      << "      --walls <n>              Oda duvar sayisi (default: 4)\n"
+      << "      --noise <m>              Gauss gurultu sigma (default: 0.005)\n"
+      << "      --dropout <0..1>         Kayip isin orani (default: 0.02)\n"
+      << "      --min-time <s>           Benchmark basina min sure (default: 0.25)\n"
+      << "      --max-reps <n>           Benchmark basina max tekrar (default: 1000)\n"
+      << "      --ransac-max-beams <n>   RANSAC/makro icin ust sinir (default: 36000)\n"
+      << "      --filter <str>           Sadece adinda <str> gecenleri calistir\n"
+      << "      --out <path>             JSON Lines cikti dosyasi (default: stdout)\n";
+}
+
+std::optional<BenchOptions> parseArgs(int argc, char* argv[]) {
+    BenchOptions o;
+    for (int i = 1; i < argc; ++i) {
+        std::string a = argv[i];
+        bool hasVal = i + 1 < argc;
+        if (a == "-h" || a == "--help") { printHelp(argv[0]); return std::nullopt; }
+        else if (a == "--beams" && hasVal && parseList(argv[i + 1], o.beams)) ++i;
+        else if (a == "--segments" && hasVal && parseList(argv[i + 1], o.segments)) ++i;
+        else if (a == "--walls" && hasVal) o.walls = std::atoi(argv[++i]);
+        else if (a == "--noise" && hasVal) o.noise = std::atof(argv[++i]);
+        else if (a == "--dropout" && hasVal) o.dropout = std::atof(argv[++i]);
+        else if (a == "--min-time" && hasVal) o.minTimeSec = std::atof(argv[++i]);
+        else if (a == "--max-reps" && hasVal) o.maxReps = std::max(1, std::atoi(argv[++i]));
+        else if (a == "--ransac-max-beams" && hasVal) o.ransacMaxBeams = std::strtoull(argv[++i], nullptr, 10);
+        else if (a == "--filter" && hasVal) o.filter = argv[++i];
+        else if (a == "--out" && hasVal) o.outPath = argv[++i];
+        else {
+            std::cerr << "[!] Bilinmeyen veya hatali arguman: " << a << "\n\n";
+            printHelp(argv[0]);
+            return std::nullopt;
+        }
+    }
+    o.minReps = std::min(o.minReps, o.maxReps);
+    return o;
+}
+
+bool selected(const BenchOptions& opt, const char* name) {
+    return opt.filter.empty() || std::strstr(name, opt.filter.c_str()) != nullptr;
+}
+
+// Analiz akışı (dönüşüm + RANSAC + kesişim) tek tarama; dosya G/Ç hariç
+size_t analyzeScan(const LidarScan& scan, const CliParams& d, std::pmr::memory_resource* mr) {
+    auto pts = filterAndConvertToPoints(scan, mr);
+    auto segs = findLinesRANSAC(pts, d.minInliers, d.epsilon, d.maxIters, mr, kRansacSeed);
+    auto inter = findPhysicalIntersections(segs, d.angleThreshDeg, mr);
+    return inter.size();
+}
+
+// İlk tarama ısınma sayılır; ortalama sonraki taramalar üzerinden
+template <typename Fn>
+double heapAllocationsPerScan(size_t scans, Fn&& runScan) {
+    runScan();
+    const size_t before = g_heapAllocations.load();
+    for (size_t i = 1; i < scans; ++i) runScan();
+    return static_cast<double>(g_heapAllocations.load() - before) / std::max<size_t>(1, scans - 1);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::optional<BenchOptions> parsed = parseArgs(argc, argv);
+    if (!parsed) return 1;
+    const BenchOptions& opt = *parsed;
+
+    std::ofstream outFile;
+    if (!opt.outPath.empty()) {
+        outFile.open(opt.outPath);
+        if (!outFile.is_open()) {
+            std::cerr << "[!] Cikti dosyasi acilamadi: " << opt.outPath << "\n";
+            return 1;
+        }
+    }
+    Reporter rep(opt.outPath.empty() ? std::cout : outFile);
+    rep.meta(opt);
+
+    const CliParams defaults;
+    // svg / svg_stream nokta başına daire yazar (LOD kapalı); svg_lod ayrı ölçülür
+    const SvgParams svgParams{defaults.svgWidth, defaults.svgHeight, defaults.svgMargin,
+                              SvgBackend::Buffered, 0};
+
+    namespace fs = std::filesystem;
+    const fs::path tmpDir = fs::temp_directory_path();
+    const std::string tomlPath = (tmpDir / "lidar_bench_scan.toml").string();
+    const std::string svgPath  = (tmpDir / "lidar_bench_out.svg").string();
+
+    for (size_t beams : opt.beams) {
+        SyntheticScanConfig cfg;
+        cfg.beams = beams;
+        cfg.walls = opt.walls;
+        cfg.noiseSigma = opt.noise;
+        cfg.dropoutRate = opt.dropout;
+
+        const LidarScan scan = makeSyntheticScan(cfg);
+        if (!saveScanToFile(tomlPath, scan)) return 1;
+
+        std::pmr::vector<Point> points = filterAndConvertToPoints(scan);
+        const bool ransacAllowed = beams <= opt.ransacMaxBeams;
+
+        if (selected(opt, "parse")) {
+            Stats s = measure(opt, [&] {
+                auto loaded = loadScanFromFile(tomlPath);
+                return loaded ? loaded->ranges.size() : 0;
+            });
+            rep.result("parse", "micro", "beams", beams, beams, s);
+        }
+
+        if (selected(opt, "convert")) {
+            Stats s = measure(opt, [&] { return filterAndConvertToPoints(scan).size(); });
+            rep.result("convert", "micro", "beams", beams, beams, s);
+        }
+
+        // Tek hassasiyet: aynı tarama float'a çevrilmiş olarak
+        LidarScanT<float> scanF = convertScanHeader<float>(scan);
+        scanF.ranges.assign(scan.ranges.begin(), scan.ranges.end());
+        std::pmr::vector<PointT<float>> pointsF = filterAndConvertToPoints(scanF);
+
+        if (selected(opt, "convert_f32")) {
+            Stats s = measure(opt, [&] { return filterAndConvertToPoints(scanF).size(); });
+            rep.result("convert_f32", "micro", "beams", beams, beams, s);
+        }
+
+        // 16 bit kodlardan doğrudan dönüşüm (bellek trafiği double taramanın 1/4'ü)
+        if (selected(opt, "convert_q16")) {
+            const QuantizedScan q = quantizeScan(scan);
+            Stats s = measure(opt, [&] { return filterAndConvertToPoints<double>(q).size(); });
+            rep.result("convert_q16", "micro", "beams", beams, beams, s);
+        }
+
+        // Dört sensör (aynı tarama, farklı montaj): tablolar ilk tekrarda kurulur, sonra yeniden kullanılır
+        if (selected(opt, "fusion")) {
+            ScanFuser<double> fuser({{0.8, 0.0, 0.0}, {-0.8, 0.0, 3.14159}, {0.0, 0.5, 1.5708}, {0.0, -0.5, -1.5708}});
+            const std::vector<const LidarScan*> scans(4, &scan);
+            Stats s = measure(opt, [&] { return fuser.fuse(scans).size(); });
+            rep.result("fusion", "micro", "beams", beams, 4 * beams, s);
+        }
+
+        std::pmr::vector<Line> lines;
+        std::pmr::vector<Intersection> xs;
+        if (ransacAllowed) {
+            lines = findLinesRANSAC(points, defaults.minInliers, defaults.epsilon, defaults.maxIters,
+                                    std::pmr::get_default_resource(), kRansacSeed);
+            xs = findPhysicalIntersections(lines, defaults.angleThreshDeg);
+        }
+
+        // RANSAC noktaları yerinde sıralar: her tekrar aynı sıradaki girdiyle başlar (kopya O(n), ihmal edilir)
+        if (ransacAllowed && selected(opt, "ransac")) {
+            const std::pmr::vector<Point> input = points;
+            Stats s = measure(opt, [&] {
+                points.assign(input.begin(), input.end());
+                return findLinesRANSAC(points, defaults.minInliers, defaults.epsilon, defaults.maxIters,
+                                       std::pmr::get_default_resource(), kRansacSeed).size();
+            });
+            rep.result("ransac", "micro", "points", beams, points.size(), s);
+        }
+
+        // Açısal sektörlerde paralel RANSAC (varsayılan 8 sektör, donanım iş parçacığı sayısı)
+        if (ransacAllowed && selected(opt, "ransac_parallel")) {
+            const std::pmr::vector<Point> input = points;
+            Stats s = measure(opt, [&] {
+                points.assign(input.begin(), input.end());
+                return findLinesParallel(points, defaults.minInliers, defaults.epsilon, defaults.maxIters,
+                                         ParallelRansacParams{}, std::pmr::get_default_resource(), kRansacSeed).size();
+            });
+            points.assign(input.begin(), input.end());
+            rep.result("ransac_parallel", "micro", "points", beams, points.size(), s);
+        }
+
+        // Ölçekleme: aynı 16 sektörlük iş 1/2/4/8 iş parçacığında ("ransac_parallel_tN").
+        // Sektör tohumları sabit olduğundan her satır aynı doğruları bulur; süre farkı yalnızca
+        // çekirdek kullanımıdır (meta.hw_threads üstündeki satırlar kazanç göstermez)
+        for (unsigned threads : {1u, 2u, 4u, 8u}) {
+            const std::string name = "ransac_parallel_t" + std::to_string(threads);
+            if (!ransacAllowed || !selected(opt, name.c_str())) continue;
+            ParallelRansacParams params;
+            params.sectors = 16;
+            params.threads = threads;
+            const std::pmr::vector<Point> input = points;
+            Stats s = measure(opt, [&] {
+                points.assign(input.begin(), input.end());
+                return findLinesParallel(points, defaults.minInliers, defaults.epsilon, defaults.maxIters,
+                                         params, std::pmr::get_default_resource(), kRansacSeed).size();
+            });
+            points.assign(input.begin(), input.end());
+            rep.result(name.c_str(), "micro", "points", beams, points.size(), s);
+        }
+
+        if (ransacAllowed && selected(opt, "ransac_f32")) {
+            const std::pmr::vector<PointT<float>> input = pointsF;
+            Stats s = measure(opt, [&] {
+                pointsF.assign(input.begin(), input.end());
+                return findLinesRANSAC(pointsF, defaults.minInliers, defaults.epsilon, defaults.maxIters,
+                                       std::pmr::get_default_resource(), kRansacSeed).size();
+            });
+            rep.result("ransac_f32", "micro", "points", beams, pointsF.size(), s);
+        }
+
+        // Voxel seyreltme (5 cm, centroid): tablo ilk tekrarda büyür, sonra yeniden kullanılır
+        VoxelDownsampler<double> voxel(VoxelParams{0.05, VoxelPolicy::Centroid, 0});
+        if (selected(opt, "voxel")) {
+            Stats s = measure(opt, [&] { return voxel.apply(points).size(); });
+            rep.result("voxel", "micro", "points", beams, points.size(), s);
+        }
+
+        // Doluluk ızgarası: taramanın ışın izlemesi ve toplu log-odds güncellemesi (sabit poz)
+        if (selected(opt, "occupancy")) {
+            OccupancyGrid grid;
+            Stats s = measure(opt, [&] {
+                grid.integrate(points, SensorPose{});
+                return grid.stats().missCells;
+            });
+            rep.result("occupancy", "micro", "points", beams, points.size(), s);
+        }
+
+        // Seyreltilmiş bulutta RANSAC: "ransac" ile farkı seyreltmenin kazancıdır
+        if (ransacAllowed && selected(opt, "ransac_voxel")) {
+            const std::pmr::vector<Point> input = voxel.apply(points);
+            std::pmr::vector<Point> thinned;
+            Stats s = measure(opt, [&] {
+                thinned.assign(input.begin(), input.end());
+                return findLinesRANSAC(thinned, defaults.minInliers, defaults.epsilon, defaults.maxIters,
+                                       std::pmr::get_default_resource(), kRansacSeed).size();
+            });
+            rep.result("ransac_voxel", "micro", "points", beams, input.size(), s);
+        }
+
+        // Aykırı filtre: ışınların %30'u rastgele range ile değiştirilmiş tarama (gürültü bölgeleri)
+        LidarScan noisy = scan;
+        {
+            std::mt19937 rng(kRansacSeed);
+            std::uniform_real_distribution<double> range(scan.range_min, scan.range_max);
+            for (double& r : noisy.ranges) {
+                if (rng() % 10 < 3) r = range(rng);
+            }
+        }
+        ScanOutlierFilter<double> outliers(OutlierFilterParams{});
+        if (selected(opt, "outlier")) {
+            LidarScan work = noisy;
+            Stats s = measure(opt, [&] {
+                work.ranges.assign(noisy.ranges.begin(), noisy.ranges.end());
+                outliers.apply(work);
+                return filterAndConvertToPoints(work).size();
+            });
+            rep.result("outlier", "micro", "beams", beams, beams, s);
+        }
+
+        // Aynı gürültülü tarama filtresiz / filtreli: farkı filtrenin RANSAC kazancıdır
+        if (ransacAllowed && (selected(opt, "ransac_noisy") || selected(opt, "ransac_outlier"))) {
+            LidarScan filtered = noisy;
+            outliers.apply(filtered);
+            const std::pmr::vector<Point> raw = filterAndConvertToPoints(noisy);
+            const std::pmr::vector<Point> kept = filterAndConvertToPoints(filtered);
+            std::pmr::vector<Point> work;
+            const std::pair<const char*, const std::pmr::vector<Point>*> variants[] = {
+                {"ransac_noisy", &raw}, {"ransac_outlier", &kept}
+            };
+            for (const auto& [name, input] : variants) {
+                if (!selected(opt, name)) continue;
+                Stats s = measure(opt, [&] {
+                    work.assign(input->begin(), input->end());
+                    return findLinesRANSAC(work, defaults.minInliers, defaults.epsilon, defaults.maxIters,
+                                           std::pmr::get_default_resource(), kRansacSeed).size();
+                });
+                rep.result(name, "micro", "points", beams, input->size(), s);
+            }
+        }
+
+        // Sektör akışı: dönüşüm + sektör RANSAC'ı + birleştirme + kesişim, tam tarama boyunca
+        if (ransacAllowed && selected(opt, "sector")) {
+            SectorParams sp;
+            sp.sectorBeams = std::max<size_t>(beams / 16, 1);
+            sp.minInliers = defaults.minInliers;
+            sp.epsilon = defaults.epsilon;
+            sp.maxIters = defaults.maxIters;
+            sp.seed = kRansacSeed;
+            sp.angleThreshDeg = defaults.angleThreshDeg;
+            SectorScanProcessor<double> proc(sp);
+            Stats s = measure(opt, [&] {
+                proc.begin(scan);
+                for (size_t i = 0; i < scan.ranges.size(); ++i) {
+                    proc.addBeam(i, scan.ranges[i]);
+                }
+                proc.finish();
+                return proc.segments().size();
+            });
+            rep.result("sector", "micro", "beams", beams, beams, s);
+        }
+
+        if (selected(opt, "svg")) {
+            Stats s = measure(opt, [&] {
+                saveToSVG(svgPath, points, lines, xs, svgParams);
+                return points.size();
+            });
+            rep.result("svg", "micro", "points", beams, points.size(), s);
+        }
+
+        // Eski ofstream yazıcısı: karşılaştırma için
+        if (selected(opt, "svg_stream")) {
+            SvgParams streamParams = svgParams;
+            streamParams.backend = SvgBackend::Stream;
+            Stats s = measure(opt, [&] {
+                saveToSVG(svgPath, points, lines, xs, streamParams);
+                return points.size();
+            });
+            rep.result("svg_stream", "micro", "points", beams, points.size(), s);
+        }
+
+        // Raster: aynı tampon tekrar tekrar kullanılır, dosyaya yazma hariç
+        if (selected(opt, "raster")) {
+            RasterRenderer raster;
+            Stats s = measure(opt, [&] {
+                raster.render(points, lines, xs, svgParams, RasterFormat::Ppm);
+                return points.size();
+            });
+            rep.result("raster", "micro", "points", beams, points.size(), s);
+        }
+
+        if (selected(opt, "svg_lod")) {
+            SvgParams lodParams = svgParams;
+            lodParams.lodThreshold = 1;
+            Stats s = measure(opt, [&] {
+                saveToSVG(svgPath, points, lines, xs, lodParams);
+                return points.size();
+            });
+            rep.result("svg_lod", "micro", "points", beams, points.size(), s);
+        }
+
+        if (ransacAllowed && selected(opt, "alloc")) {
+            constexpr size_t scans = 6;
+            double perDefault = heapAllocationsPerScan(scans, [&] {
+                g_sink = g_sink + analyzeScan(scan, defaults, std::pmr::get_default_resource());
+            });
+
+            ScanArena arena;
+            double perArena = heapAllocationsPerScan(scans, [&] {
+                g_sink = g_sink + analyzeScan(scan, defaults, arena.resource());
+                arena.reset(); // Taşma varsa büyüme burada (ısınma taramasında) olur
+            });
+            rep.alloc(beams, scans, perDefault, perArena, arena.capacity());
+        }
+
+        if (ransacAllowed && selected(opt, "pipeline")) {
+            Stats s = measure(opt, [&] {
+                auto loaded = loadScanFromFile(tomlPath);
+                if (!loaded) return size_t{0};
+                auto pts = filterAndConvertToPoints(*loaded);
+                auto segs = findLinesRANSAC(pts, defaults.minInliers, defaults.epsilon, defaults.maxIters,
+                                            std::pmr::get_default_resource(), kRansacSeed);
+                auto inter = findPhysicalIntersections(segs, defaults.angleThreshDeg);
+                saveToSVG(svgPath, pts, segs, inter, svgParams);
+                return inter.size();
+            });
+            rep.result("pipeline", "macro", "beams", beams, beams, s);
+        }
+    }
+
+    // Kesişim araması ışın sayısından değil, parça sayısından etkilenir
+    if (selected(opt, "intersections")) {
+        for (size_t count : opt.segments) {
+            const std::pmr::vector<Line> segs = makeSyntheticSegments(count, 3.0, 7);
+            Stats s = measure(opt, [&] {
+                return findPhysicalIntersections(segs, defaults.angleThreshDeg).size();
+            });
+            rep.result("intersections", "micro", "pairs", count, count * (count - 1) / 2, s);
+        }
+    }
+
+    // Küresel çizgi haritası: harita büyürken kare başına birleştirme maliyeti sabit kalmalı.
+    // Harita 4 m aralıklı ayrı kısa duvarlardan; ölçülen kare bunların 8'ini yeniden gözler.
+    if (selected(opt, "line_map")) {
+        auto addWalls = [](std::pmr::vector<Point>& pts, std::pmr::vector<Line>& lines, size_t side,
+                           size_t first, size_t count) {
+            for (size_t k = first; k < first + count; ++k) {
+                const double x = 4.0 * static_cast<double>(k % side), y = 4.0 * static_cast<double>(k / side);
+                Line l;
+                l.B = 1.0;
+                l.C = -y;
+                l.inlierOffset = static_cast<uint32_t>(pts.size());
+                l.inlierCount = 21;
+                l.startPoint = {x, y};
+                l.endPoint = {x + 2.0, y};
+                for (int i = 0; i <= 20; ++i) pts.push_back(Point{x + 0.1 * i, y});
+                lines.push_back(l);
+            }
+        };
+        for (size_t count : {size_t{1000}, size_t{10000}, size_t{40000}}) {
+            const auto side = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(count))));
+            std::pmr::vector<Point> mapPts, framePts;
+            std::pmr::vector<Line> mapLines, frameLines;
+            addWalls(mapPts, mapLines, side, 0, count);
+            addWalls(framePts, frameLines, side, count / 2, 8);
+
+            LineMap map;
+            map.integrate(mapPts, mapLines, SensorPose{});
+            Stats s = measure(opt, [&] {
+                map.integrate(framePts, frameLines, SensorPose{});
+                return map.stats().associated;
+            });
+            rep.result("line_map", "micro", "segments", map.size(), frameLines.size(), s);
+        }
+    }
+
+    // Canlı yayın: yazarın kare başına maliyeti (yerinde doldurma + değiş tokuş) ve bir okuma
+    if (selected(opt, "publish")) {
+        for (size_t count : opt.segments) {
+            const std::pmr::vector<Line> segs = makeSyntheticSegments(count, 3.0, 7);
+            const std::pmr::vector<Intersection> xs = findPhysicalIntersections(segs, defaults.angleThreshDeg);
+            SnapshotPublisher<ResultFrame> pub;
+            auto reader = pub.reader();
+            Stats s = measure(opt, [&] {
+                assignResultFrame(pub.beginWrite(), count * 20, segs, xs, StageTimings{});
+                pub.publish();
+                return reader.read()->segments.size();
+            });
+            rep.result("publish", "micro", "segments", count, segs.size() + xs.size(), s);
+        }
+    }
+
+    // Yoğun köşeli haritada etiket yerleşimi (noktasız SVG)
+    if (selected(opt, "svg_labels")) {
+        const std::pmr::vector<Point> noPoints;
+        for (size_t count : opt.segments) {
+            const std::pmr::vector<Line> segs = makeSyntheticSegments(count, 3.0, 7);
+            const std::pmr::vector<Intersection> xs = findPhysicalIntersections(segs, defaults.angleThreshDeg);
+            Stats s = measure(opt, [&] {
+                saveToSVG(svgPath, noPoints, segs, xs, svgParams);
+                return xs.size();
+            });
+            rep.result("svg_labels", "micro", "labels", count, xs.size(), s);
+        }
+    }
+
+    std::error_code ec;
+    fs::remove(tomlPath, ec);
+    fs::remove(svgPath, ec);
+    return 0;
+}
@@ -0,0 +1,33 @@
+#include "synthetic_scan.hpp"
+#include "model/scene.hpp"
+#include <random>
+
+LidarScan makeSyntheticScan(const SyntheticScanConfig& cfg) {
+    Scene scene;
+    addPolygonRoom(scene, 0.0, 0.0, cfg.walls, cfg.radius);
+
+    ScanSimConfig sim;
+    sim.beams = cfg.beams;
+    sim.rangeMin = 0.05;
+    sim.rangeMax = 2.0 * cfg.radius;
+    sim.noiseSigma = cfg.noiseSigma;
+    sim.dropoutRate = cfg.dropoutRate;
+    sim.seed = cfg.seed;
+
+    return simulateScan(scene, SensorPose{}, sim);
+}
+
+std::pmr::vector<Line> makeSyntheticSegments(size_t count, double radius, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> coord(-radius, radius);
+
+    std::pmr::vector<Line> segments(count);
+    for (auto& s : segments) {
+        s.startPoint = {coord(rng), coord(rng)};
+        s.endPoint   = {coord(rng), coord(rng)};
+        s.A = s.endPoint.y - s.startPoint.y;
+        s.B = s.startPoint.x - s.endPoint.x;
+        s.C = -s.A * s.startPoint.x - s.B * s.startPoint.y;
+    }
+    return segments;
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "model/types.hpp"
+#include <cstdint>
+#include <vector>
+
+// Benchmark girdisi: merkezde robot, etrafında düzgün çokgen oda (model/scene ile ışın izlenir)
+struct SyntheticScanConfig {
+    size_t   beams       = 360;
+    int      walls       = 4;      // Çokgen kenar sayısı (>= 3)
+    double   radius      = 2.5;    // Çokgenin çevrel çember yarıçapı [m]
+    double   noiseSigma  = 0.005;  // Gauss gürültüsü [m]
+    double   dropoutRate = 0.02;   // -1.0 ile işaretlenen ışın oranı
+    uint32_t seed        = 42;
+};
+
+LidarScan makeSyntheticScan(const SyntheticScanConfig& cfg);
+
+// Intersection benchmark'ı için rastgele doğru parçaları (±radius karesi içinde)
+std::pmr::vector<Line> makeSyntheticSegments(size_t count, double radius, uint32_t seed);
@@ -1,82 +1,401 @@
 #include "app_controller.hpp"
 #include "model/lidar.hpp"
-#include "model/toml_parser.hpp"
 #include "model/ransac.hpp"
+#include "model/scan_stream.hpp"
 #include "model/geometry.hpp"
+#include "model/downsample.hpp"
+#include "model/fusion.hpp"
+#include "model/outlier_filter.hpp"
+#include "model/parallel_ransac.hpp"
+#include "utils/alloc_profiler.hpp"
 #include "utils/cli.hpp"
+#include "utils/input_stream.hpp"
+#include "utils/scan_sync.hpp"
 #include "view/svg_writer.hpp"
 #include "view/console_view.hpp"
+#include "view/result_writer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
-#include <cstdlib>
+#include <thread>
+
+// Başlangıçtan bu yana geçen süre (ms)
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static OutlierFilterParams outlierParams(const CliParams& p) {
+    return OutlierFilterParams{p.outlierWindow, p.outlierSupport, p.outlierTol, p.outlierSlope};
+}
 
 AppController::AppController(const CliParams& params)
     : m_params(params)
 {
-    ConsoleView::printControllerStart(m_params.inputPath);
+    ConsoleView::setQuiet(m_params.quiet);
+
+    std::string sources = m_params.inputPath;
+    for (const auto& sensor : m_params.sensors) {
+        sources += (sources.empty() ? "" : ", ") + sensor.path;
+    }
+    ConsoleView::printControllerStart(sources);
+
+    if (m_params.asyncOutput) {
+        m_writer = std::make_unique<AsyncWriter>(m_params.outputQueue, m_params.outputPolicy);
+    }
 }
 
 // Ana uygulama akışı
 void AppController::run() {
     ConsoleView::printAppRunning();
 
-    std::string filePath = m_params.inputPath;
-    std::string localPath = "data/downloaded_scan.toml";
-
-    if (filePath.rfind("http", 0) == 0) {
+    if (isUrlSource(m_params.inputPath)) {
         ConsoleView::printUrlDownload();
+    }
+
+    if (m_params.precision == Precision::Float) {
+        runPipeline<float>(m_arenas.acquire());
+    } else {
+        runPipeline<double>(m_arenas.acquire());
+    }
+
+    finishOutput();
+
+    if constexpr (AllocProfiler::enabled()) {
+        const AllocProfile profile = AllocProfiler::snapshot();
+        ConsoleView::printAllocProfile(profile);
+        if (!m_params.outAllocJson.empty() && AllocProfiler::saveJson(m_params.outAllocJson, profile)) {
+            ConsoleView::printResultSuccess(m_params.outAllocJson);
+        }
+    }
+    ConsoleView::printAppComplete();
+}
 
-        std::string command;
-        int result_code = 1;
+void AppController::dispatchOutput(AsyncWriter::Job job) {
+    if (m_writer) {
+        m_writer->submit(std::move(job));
+    } else {
+        job();
+    }
+}
+
+void AppController::finishOutput() {
+    if (!m_writer) return;
+
+    m_writer->flush();
+    AsyncWriter::Stats st = m_writer->stats();
+    ConsoleView::printOutputStats(st.submitted, st.written, st.dropped, st.blockedSeconds, st.drainSeconds);
+}
 
-#ifdef _WIN32
-        command = "powershell -Command \"Invoke-WebRequest -UseBasicParsing -Uri '" + filePath + "' -OutFile '" + localPath + "'\"";
-        result_code = std::system(command.c_str());
+// Tek kaynak: her range değeri okunduğu anda filtrelenip noktaya dönüştürülür;
+// girdi (dosya, FIFO, stdin veya URL) hiçbir zaman tamamen tamponlanmaz.
+// Aykırı değer filtresi açıksa komşu ışınlar gerektiğinden yalnızca range dizisi
+// tamponlanır, dönüşüm okuma bitince yapılır.
+template <typename T>
+std::pmr::vector<PointT<T>> AppController::readScan(std::pmr::memory_resource* mr,
+                                                    SectorScanProcessor<T>* sectors) {
+    const std::string& source = m_params.inputPath;
+    const bool prefilter = m_params.outlierWindow > 0;
 
-        if (result_code != 0) {
-            ConsoleView::printUrlDownloadFallback();
-            command = "curl -L -s -o \"" + localPath + "\" \"" + filePath + "\"";
-            result_code = std::system(command.c_str());
+    std::pmr::vector<PointT<T>> allPoints(mr);
+    LidarScanT<T> header;
+    ScanStreamDecoder decoder([&allPoints, &header, sectors, prefilter, mr](const LidarScan& scan, size_t index, double range) {
+        if (index == 0) {
+            header = convertScanHeader<T>(scan, mr); // Başlık dizi başlamadan tamamlanmıştır
+            if (sectors) sectors->begin(header);
         }
-#else
-        command = "curl -L -s -o '" + localPath + "' '" + filePath + "'";
-        result_code = std::system(command.c_str());
-#endif
-
-        // Hata Kontrolü
-        if (result_code != 0) {
-             throw std::runtime_error("[HATA] Dosya indirilemedi: " + filePath +
-                                      " | Lutfen URL'yi veya internet baglantinizi kontrol edin.");
+        if (sectors) {
+            sectors->addBeam(index, static_cast<T>(range));
+            return;
         }
+        if (prefilter) {
+            header.ranges.push_back(static_cast<T>(range));
+            return;
+        }
+        PointT<T> p;
+        if (convertBeam(header, index, static_cast<T>(range), p)) {
+            allPoints.push_back(p);
+        }
+    });
+
+    std::string error;
+    if (!readInputChunks(source, [&decoder](const char* data, size_t size) { decoder.feed(data, size); }, error)) {
+        throw std::runtime_error("[HATA] " + error);
+    }
+    decoder.finish();
+    if (!decoder.ok()) {
+        throw std::runtime_error("Tarama verisi okunamadi veya islenemedi: " + source + " (" + decoder.error() + ")");
+    }
 
-        filePath = localPath;
-        ConsoleView::printUrlDownloadSuccess(localPath);
+    if (isUrlSource(source)) {
+        ConsoleView::printUrlDownloadSuccess(source);
+    }
+    ConsoleView::printTomlResult(decoder.rangeCount());
+    if (sectors) {
+        sectors->finish();
+        return std::move(sectors->points());
+    }
+    if (prefilter) {
+        LIDAR_ALLOC_STAGE(Prefilter);
+        const auto t0 = std::chrono::steady_clock::now();
+        ScanOutlierFilter<T> filter(outlierParams(m_params));
+        filter.apply(header);
+        ConsoleView::printOutlierResult(filter.stats().validBeams, filter.stats().removed, elapsedMs(t0));
+        allPoints = filterAndConvertToPoints(header, mr);
     }
+    return allPoints;
+}
+
+// Kaynağın tamamını okur; füzyonda dönüşüm sensör tablosuyla sonradan yapılır.
+// filter verilirse tarama paylaşılmadan önce aykırı ışınlar elenir (süresi filterMs'e).
+static std::shared_ptr<const LidarScan> readWholeScan(const std::string& source, std::string& error,
+                                                      ScanOutlierFilter<double>* filter, double& filterMs) {
+    std::pmr::vector<double> ranges;
+    ScanStreamDecoder decoder([&ranges](const LidarScan&, size_t, double range) {
+        ranges.push_back(range);
+    });
 
-    std::optional<LidarScan> scanData = loadScanFromFile(filePath);
-    if (!scanData) {
-        throw std::runtime_error("TOML dosyasi okunamadi veya islenemedi: " + filePath);
+    if (!readInputChunks(source, [&decoder](const char* data, size_t size) { decoder.feed(data, size); }, error)) {
+        return nullptr;
     }
-    ConsoleView::printTomlResult(scanData->ranges.size());
+    decoder.finish();
+    if (!decoder.ok()) {
+        error = "tarama verisi islenemedi: " + source + " (" + decoder.error() + ")";
+        return nullptr;
+    }
+
+    const LidarScan& h = decoder.header();
+    LidarScan scan{h.angle_min, h.angle_max, h.angle_increment, h.range_min, h.range_max, std::move(ranges)};
+    if (filter) {
+        LIDAR_ALLOC_STAGE(Prefilter);
+        const auto t0 = std::chrono::steady_clock::now();
+        filter->apply(scan);
+        filterMs = elapsedMs(t0);
+    }
+    return std::make_shared<const LidarScan>(std::move(scan));
+}
+
+// Füzyon okuyucularının ortak durumu. Okuyucular ayrılmış (detach) iş parçacıklarıdır ve
+// durumu paylaşarak sahiplenir: kareyi kaçıran yavaş ya da takılmış sensör okumasını
+// bitirene kadar durum yaşar, kare ise onu hiç beklemez.
+struct FusedReadState {
+    FusedReadState(size_t n, const CliParams& p)
+        : sync(n, p.syncSkewMs > 0 ? p.syncSkewMs / 1000.0 : 1e300, std::chrono::milliseconds(p.syncWaitMs)),
+          errors(n),
+          filters(p.outlierWindow > 0 ? n : 0, ScanOutlierFilter<double>(outlierParams(p))),
+          filterMs(n, 0.0) {}
+
+    ScanSynchronizer sync;
+    std::mutex errorMutex;             // errors geç okuyucularca kareden sonra da yazılabilir
+    std::vector<std::string> errors;
+    // Sensör s'in filtresi ve süresi taraması push edilmeden önce yazılır; karede bulunan
+    // sensörler için senkronizör kilidi üzerinden görünürdür
+    std::vector<ScanOutlierFilter<double>> filters;
+    std::vector<double> filterMs;
+};
+
+// Çoklu sensör: her kaynak kendi iş parçacığında okunup senkronizöre verilir, ilk kare
+// en fazla syncWaitMs beklemeyle toplanır ve sensör tablolarıyla paralel olarak tek buluta
+// dönüştürülür. Kareye yetişemeyen okuyucular beklenmez (bkz. FusedReadState).
+// Zaman damgası olarak varış zamanı kullanılır (dosya biçimlerinde yakalama zamanı yok).
+template <typename T>
+std::pmr::vector<PointT<T>> AppController::readFusedScans(std::pmr::memory_resource* mr) {
+    const size_t n = m_params.sensors.size();
+    auto state = std::make_shared<FusedReadState>(n, m_params);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t s = 0; s < n; ++s) {
+        std::thread([state, s, start, path = m_params.sensors[s].path] {
+            LIDAR_ALLOC_STAGE(Read);
+            std::string error;
+            auto scan = readWholeScan(path, error, state->filters.empty() ? nullptr : &state->filters[s],
+                                      state->filterMs[s]);
+            if (!error.empty()) {
+                std::lock_guard<std::mutex> lock(state->errorMutex);
+                state->errors[s] = std::move(error);
+            }
+            if (scan) {
+                state->sync.push(s, elapsedMs(start) / 1000.0, std::move(scan));
+            }
+            state->sync.close(s);
+        }).detach();
+    }
+
+    std::optional<ScanSynchronizer::Frame> frame = state->sync.next();
+
+    std::pmr::vector<PointT<T>> allPoints(mr);
+    size_t rangeCount = 0;
+    if (frame && frame->present > 0) {
+        std::vector<SensorMount> mounts;
+        std::vector<const LidarScan*> scans;
+        for (size_t s = 0; s < n; ++s) {
+            mounts.push_back(m_params.sensors[s].mount);
+            scans.push_back(frame->scans[s].get());
+            rangeCount += frame->scans[s] ? frame->scans[s]->ranges.size() : 0;
+        }
+        ScanFuser<T> fuser(std::move(mounts));
+        allPoints = fuser.fuse(scans, mr);
+    }
+
+    // Kareye kadar biten okuyucuların hataları; geç kalanlarınki raporlanmaz
+    {
+        std::lock_guard<std::mutex> lock(state->errorMutex);
+        for (size_t s = 0; s < n; ++s) {
+            if (!state->errors[s].empty()) {
+                ConsoleView::printSensorError(s, state->errors[s]);
+            }
+        }
+    }
+    if (!frame || frame->present == 0) {
+        throw std::runtime_error("Hicbir sensorden tarama okunamadi.");
+    }
+
+    ConsoleView::printTomlResult(rangeCount);
+    if (!state->filters.empty()) {
+        // Sensörler paralel okunur: süre en yavaş sensörün filtresidir
+        size_t valid = 0, removed = 0;
+        double slowestMs = 0.0;
+        for (size_t s = 0; s < n; ++s) {
+            if (!frame->scans[s]) continue;
+            valid += state->filters[s].stats().validBeams;
+            removed += state->filters[s].stats().removed;
+            slowestMs = std::max(slowestMs, state->filterMs[s]);
+        }
+        ConsoleView::printOutlierResult(valid, removed, slowestMs);
+    }
+    ConsoleView::printFusionResult(frame->present, n, state->sync.stats().skewDropped);
+    return allPoints;
+}
+
+// Derleme zamanında hassasiyete özelleşmiş analiz akışı
+template <typename T>
+void AppController::runPipeline(std::shared_ptr<ScanArena> arena) {
+    std::pmr::memory_resource* mr = arena->resource();
+    StageTimings timings;
+    auto t0 = std::chrono::steady_clock::now();
+
+    const bool sectorMode = m_params.sectorBeams > 0;
+    SectorParams sectorParams;
+    sectorParams.sectorBeams = m_params.sectorBeams;
+    sectorParams.minInliers = m_params.minInliers;
+    sectorParams.epsilon = m_params.epsilon;
+    sectorParams.maxIters = m_params.maxIters;
+    sectorParams.minSectorPoints = m_params.sectorMinPoints;
+    sectorParams.seed = m_params.seed;
+    sectorParams.angleThreshDeg = m_params.angleThreshDeg;
+    SectorScanProcessor<T> sectors(sectorParams, mr);
+
+    std::pmr::vector<PointT<T>> allPoints(mr);
+    {
+        // Sektör modunda sektör RANSAC'ı da okuma aşamasına yazılır
+        LIDAR_ALLOC_STAGE(Read);
+        allPoints = !m_params.sensors.empty() ? readFusedScans<T>(mr)
+                                              : readScan<T>(mr, sectorMode ? &sectors : nullptr);
+    }
+    timings.readMs = elapsedMs(t0);
 
-    std::vector<Point> allPoints = filterAndConvertToPoints(*scanData);
     ConsoleView::printFilterResult(allPoints.size());
 
-    std::vector<Line> segments = findLinesRANSAC(
-        allPoints, m_params.minInliers, m_params.epsilon, m_params.maxIters
-    );
-    ConsoleView::printRansacResult(segments.size());
+    std::pmr::vector<LineT<T>> segments(mr);
+    std::pmr::vector<IntersectionT<T>> intersections(mr);
+    if (sectorMode) {
+        // Sektör RANSAC'ı okuma süresine dahildir; ransacMs son ışından sonraki
+        // birleştirme + nihai kesişim süresidir
+        const SectorStats& st = sectors.stats();
+        segments = std::move(sectors.segments());
+        intersections = std::move(sectors.intersections());
+        timings.ransacMs = st.finishMs;
+        ConsoleView::printRansacResult(segments.size());
+        ConsoleView::printGeometryResult(intersections.size(), m_params.angleThreshDeg);
+        ConsoleView::printSectorResult(st.sectors, st.rawSegments, st.stitched, st.recovered,
+                                       st.firstIntersectionMs, st.firstIntersectionLeadMs, st.finishMs);
+    } else {
+        // Seyreltilmiş bulut tam bulutun yerini alır: doğruların inlier aralıkları ona göredir
+        if (m_params.voxelSize > 0) {
+            LIDAR_ALLOC_STAGE(Prefilter);
+            t0 = std::chrono::steady_clock::now();
+            VoxelDownsampler<T> voxel(VoxelParams{m_params.voxelSize, m_params.voxelPolicy, m_params.maxPoints});
+            allPoints = voxel.apply(allPoints, mr);
+            const VoxelStats& vs = voxel.stats();
+            ConsoleView::printDownsampleResult(vs.inputPoints, vs.cells, vs.outputPoints, elapsedMs(t0));
+        }
 
-    // Geometrik Analiz
-    std::vector<Intersection> intersections = findPhysicalIntersections(
-        segments, m_params.angleThreshDeg
-    );
-    ConsoleView::printGeometryResult(intersections.size(), m_params.angleThreshDeg);
+        t0 = std::chrono::steady_clock::now();
+        ParallelRansacStats parallelStats;
+        {
+            LIDAR_ALLOC_STAGE(Ransac);
+            if (m_params.parallelSectors > 0) {
+                ParallelRansacParams pp;
+                pp.sectors = m_params.parallelSectors;
+                pp.threads = static_cast<unsigned>(m_params.threads);
+                segments = findLinesParallel(
+                    allPoints, m_params.minInliers, m_params.epsilon, m_params.maxIters, pp, mr, m_params.seed, &parallelStats
+                );
+            } else {
+                segments = findLinesRANSAC(
+                    allPoints, m_params.minInliers, m_params.epsilon, m_params.maxIters, mr, m_params.seed
+                );
+            }
+        }
+        timings.ransacMs = elapsedMs(t0);
+        if (m_params.parallelSectors > 0) {
+            ConsoleView::printParallelResult(parallelStats.sectors, parallelStats.threads,
+                                             parallelStats.rawSegments, parallelStats.merged,
+                                             parallelStats.dropped, parallelStats.recovered);
+        }
+        ConsoleView::printRansacResult(segments.size());
 
-    ConsoleView::printFinalReport(intersections);
+        // Geometrik Analiz
+        t0 = std::chrono::steady_clock::now();
+        {
+            LIDAR_ALLOC_STAGE(Intersect);
+            intersections = findPhysicalIntersections(segments, m_params.angleThreshDeg, mr);
+        }
+        timings.intersectMs = elapsedMs(t0);
+        ConsoleView::printGeometryResult(intersections.size(), m_params.angleThreshDeg);
+    }
 
-    SvgParams sp{ m_params.svgWidth, m_params.svgHeight, m_params.svgMargin };
-    saveToSVG(m_params.outSvg, allPoints, segments, intersections, sp);
+    // Canlı yayın: önceki bir yayının nesnesi yerinde doldurulup tek değiş tokuşla yayınlanır
+    assignResultFrame(m_results.beginWrite(), allPoints.size(), segments, intersections, timings);
+    m_results.publish();
 
-    ConsoleView::printSvgSuccess(m_params.outSvg);
-    ConsoleView::printAppComplete();
+    SvgParams sp{ m_params.svgWidth, m_params.svgHeight, m_params.svgMargin,
+                  m_params.svgStream ? SvgBackend::Stream : SvgBackend::Buffered,
+                  m_params.svgLodThreshold };
+
+    // Sonuçlar kopyalanmadan işe taşınır; arena iş bitene kadar canlı tutulur
+    dispatchOutput([this, arena, sp, timings,
+                    outSvg = m_params.outSvg,
+                    outRaster = m_params.outRaster,
+                    outJson = m_params.outJson,
+                    outBin = m_params.outBin,
+                    allPoints = std::move(allPoints),
+                    segments = std::move(segments),
+                    intersections = std::move(intersections)] {
+        LIDAR_ALLOC_STAGE(Output);
+        std::pmr::memory_resource* mr = arena->resource();
+
+        ConsoleView::printFinalReport(intersections);
+
+        // Yapılandırılmış sonuçlar önce: aşağı akış tüketicileri SVG'yi beklemez
+        if (!outJson.empty() &&
+            saveResultsJson(outJson, allPoints.size(), segments, intersections, timings)) {
+            ConsoleView::printResultSuccess(outJson);
+        }
+        if (!outBin.empty() &&
+            saveResultsBinary(outBin, allPoints.size(), segments, intersections, timings)) {
+            ConsoleView::printResultSuccess(outBin);
+        }
+
+        saveToSVG(outSvg, allPoints, segments, intersections, sp, mr);
+        ConsoleView::printSvgSuccess(outSvg);
+
+        if (!outRaster.empty()) {
+            m_raster.render(allPoints, segments, intersections, sp, rasterFormatForPath(outRaster));
+            if (m_raster.save(outRaster)) {
+                ConsoleView::printRasterSuccess(outRaster);
+            }
+        }
+    });
 }
\ No newline at end of file
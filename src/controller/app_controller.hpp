@@ -1,5 +1,15 @@
 #pragma once
+#include <memory>
+#include "model/sector_scan.hpp"
+#include "utils/async_writer.hpp"
 #include "utils/cli.hpp"
+#include "utils/scan_arena.hpp"
+#include "utils/snapshot_publisher.hpp"
+#include "view/raster_writer.hpp"
+#include "view/result_writer.hpp"
+
+// Son karenin sonuçları; canlı tüketiciler (pano, planlayıcı, kayıt) kilitsiz okur
+using ResultPublisher = SnapshotPublisher<ResultFrame>;
 
 class AppController {
 public:
@@ -9,6 +19,38 @@ public:
     // Ana uygulama akışı
     void run();
 
+    // Okuyucular run()'dan önce alınabilir; analiz iş parçacığı onları hiç beklemez
+    ResultPublisher& results() { return m_results; }
+
 private:
+    // Okuma -> dönüşüm -> RANSAC -> kesişim -> çıktı (T: float / double)
+    template <typename T>
+    void runPipeline(std::shared_ptr<ScanArena> arena);
+
+    // Okuma + dönüşüm aşaması: tek kaynak (akış) ya da --sensor kaynaklarının füzyonu.
+    // sectors verilirse ışınlar ona aktarılır; sektör RANSAC'ı okuma sırasında çalışır.
+    template <typename T>
+    std::pmr::vector<PointT<T>> readScan(std::pmr::memory_resource* mr,
+                                         SectorScanProcessor<T>* sectors = nullptr);
+    template <typename T>
+    std::pmr::vector<PointT<T>> readFusedScans(std::pmr::memory_resource* mr);
+
+    // Çıktı işini eşzamanlı çalıştırır ya da arka plan yazıcısına taşır
+    void dispatchOutput(AsyncWriter::Job job);
+
+    // Bekleyen çıktıları yazdırıp kuyruk istatistiklerini raporlar
+    void finishOutput();
+
     CliParams m_params;
+
+    // Tarama başına ara bellek; asenkron çıktıda sonuçlar yazılana kadar arena işte kalır
+    ScanArenaPool m_arenas;
+
+    // Raster çıktı tamponu; kareler arasında yeniden kullanılır (yalnızca çıktı işlerinden)
+    RasterRenderer m_raster;
+
+    ResultPublisher m_results;
+
+    // --async-output verilmediyse boş
+    std::unique_ptr<AsyncWriter> m_writer;
 };
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include "downsample.hpp"
+#include <algorithm>
+#include <cmath>
+
+template <typename T>
+VoxelDownsampler<T>::VoxelDownsampler(VoxelParams params)
+    : m_params(params),
+      m_invCell(static_cast<T>(1.0 / std::max(params.cellSize, 1e-6)))
+{
+}
+
+template <typename T>
+void VoxelDownsampler<T>::reserve(size_t points) {
+    // Her nokta ayrı hücre olsa bile yük oranı 0.5'i geçmez
+    m_cells.reserve(points);
+}
+
+template <typename T>
+std::pmr::vector<PointT<T>> VoxelDownsampler<T>::apply(
+    const std::pmr::vector<PointT<T>>& points,
+    std::pmr::memory_resource* mr)
+{
+    m_stats = VoxelStats{};
+    m_stats.inputPoints = points.size();
+    std::pmr::vector<PointT<T>> out(mr);
+    if (points.empty()) return out;
+
+    reserve(points.size());
+    m_cells.clear();
+
+    const bool centroid = m_params.policy == VoxelPolicy::Centroid;
+    m_sums.clear();
+    m_counts.clear();
+
+    for (const PointT<T>& p : points) {
+        const auto cx = static_cast<int32_t>(std::floor(p.x * m_invCell));
+        const auto cy = static_cast<int32_t>(std::floor(p.y * m_invCell));
+        const uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) | static_cast<uint32_t>(cy);
+
+        auto [index, inserted] = m_cells.tryEmplace(key);
+        if (inserted) {
+            *index = static_cast<uint32_t>(out.size());
+            out.push_back(p);
+            if (centroid) {
+                m_sums.push_back({static_cast<double>(p.x), static_cast<double>(p.y)});
+                m_counts.push_back(1);
+            }
+        } else if (centroid) {
+            m_sums[*index].x += p.x;
+            m_sums[*index].y += p.y;
+            ++m_counts[*index];
+        }
+    }
+    m_stats.cells = out.size();
+
+    if (centroid) {
+        for (size_t i = 0; i < out.size(); ++i) {
+            if (m_counts[i] > 1) {
+                out[i].x = static_cast<T>(m_sums[i].x / m_counts[i]);
+                out[i].y = static_cast<T>(m_sums[i].y / m_counts[i]);
+            }
+        }
+    }
+
+    // Üst sınır: eşit aralıklı seçim, tarama sırası korunur (k <= k * n / max: yerinde güvenli)
+    if (m_params.maxPoints > 0 && out.size() > m_params.maxPoints) {
+        const size_t n = out.size();
+        for (size_t k = 0; k < m_params.maxPoints; ++k) {
+            out[k] = out[k * n / m_params.maxPoints];
+        }
+        out.resize(m_params.maxPoints);
+    }
+    m_stats.outputPoints = out.size();
+    return out;
+}
+
+template class VoxelDownsampler<float>;
+template class VoxelDownsampler<double>;
@@ -0,0 +1,55 @@
+#pragma once
+#include "model/types.hpp"
+#include "utils/flat_hash.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Hücre başına tek nokta:
+//   Centroid - hücredeki noktaların ortalaması
+//   First    - hücreye düşen ilk nokta (tarama sırasında), değer değişmez
+enum class VoxelPolicy { Centroid, First };
+
+struct VoxelParams {
+    double cellSize = 0.05;     // m
+    VoxelPolicy policy = VoxelPolicy::Centroid;
+    size_t maxPoints = 0;       // 0: sınırsız; aşılırsa hücre çıktısı eşit aralıklı seyreltilir
+};
+
+struct VoxelStats {
+    size_t inputPoints = 0;
+    size_t cells = 0;           // Dolu hücre
+    size_t outputPoints = 0;    // maxPoints sonrası
+};
+
+// RANSAC öncesi 2D voxel ızgara seyreltmesi. Yakın duvarların çok yoğun noktaları doğru
+// doğruluğuna katkı vermeden RANSAC maliyetini büyütür; her hücre tek noktaya iner.
+// Tek doğrusal geçiş: hücre anahtarı açık adresli tabloda (FlatHashMap) aranır.
+// Tablo nesneyle birlikte yaşar, yalnızca büyür; girişler nesil damgasıyla geçersiz
+// sayılır, kareler arası temizleme yoktur. Çıktı hücrelerin ilk görüldüğü sırayla
+// (tarama sırası) dizilir.
+template <typename T>
+class VoxelDownsampler {
+public:
+    explicit VoxelDownsampler(VoxelParams params);
+
+    // Tabloyu bu kadar nokta için önceden ayırır (ilk karede büyümeyi önler)
+    void reserve(size_t points);
+
+    std::pmr::vector<PointT<T>> apply(
+        const std::pmr::vector<PointT<T>>& points,
+        std::pmr::memory_resource* mr = std::pmr::get_default_resource()
+    );
+
+    const VoxelParams& params() const { return m_params; }
+    const VoxelStats& stats() const { return m_stats; }
+
+private:
+    VoxelParams m_params;
+    T m_invCell;
+    FlatHashMap<uint32_t> m_cells; // Hücre anahtarı -> çıktıdaki hücre
+
+    std::vector<PointT<double>> m_sums;  // Centroid: hücre toplamları (float'ta da double)
+    std::vector<uint32_t> m_counts;
+    VoxelStats m_stats;
+};
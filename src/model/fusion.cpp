@@ -0,0 +1,119 @@
+#include "fusion.hpp"
+#include "model/lidar.hpp"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+// Bu kadar ışından azında iş parçacığı açmak dönüşümden pahalı
+static constexpr size_t kParallelMinBeams = 8192;
+
+template <typename T>
+void BeamRotationTable<T>::build(const LidarScanT<T>& header, const SensorMount& mount, size_t beams) {
+    m_header = convertScanHeader<T>(header);
+    m_mount = mount;
+    m_tx = static_cast<T>(mount.x);
+    m_ty = static_cast<T>(mount.y);
+    m_rangeMin = header.range_min;
+    m_rangeMax = header.range_max;
+
+    m_cos.resize(beams);
+    m_sin.resize(beams);
+    m_valid.resize(beams);
+
+    const T yaw = static_cast<T>(mount.yaw);
+    for (size_t i = 0; i < beams; ++i) {
+        // Açı convertBeam ile aynı biçimde (aynı hassasiyette) hesaplanır
+        T angle = header.angle_min + (static_cast<T>(i) * header.angle_increment);
+        m_valid[i] = angle > header.angle_max ? 0 : 1;
+        m_cos[i] = std::cos(angle + yaw);
+        m_sin[i] = std::sin(angle + yaw);
+    }
+}
+
+template <typename T>
+bool BeamRotationTable<T>::matches(const LidarScanT<T>& header, const SensorMount& mount, size_t beams) const {
+    return beams == m_cos.size() &&
+           header.angle_min == m_header.angle_min && header.angle_max == m_header.angle_max &&
+           header.angle_increment == m_header.angle_increment &&
+           header.range_min == m_header.range_min && header.range_max == m_header.range_max &&
+           mount.x == m_mount.x && mount.y == m_mount.y && mount.yaw == m_mount.yaw;
+}
+
+template <typename T>
+ScanFuser<T>::ScanFuser(std::vector<SensorMount> mounts)
+    : m_mounts(std::move(mounts)),
+      m_tables(m_mounts.size())
+{
+}
+
+template <typename T>
+std::pmr::vector<PointT<T>> ScanFuser<T>::fuse(
+    const std::vector<const LidarScan*>& scans,
+    std::pmr::memory_resource* mr,
+    std::vector<size_t>* counts)
+{
+    const size_t sensors = std::min(scans.size(), m_mounts.size());
+
+    // Tablolar (gerekirse) ve sensör başına çıktı dilimleri
+    std::vector<size_t> offsets(sensors + 1, 0);
+    for (size_t s = 0; s < sensors; ++s) {
+        const size_t beams = scans[s] ? scans[s]->ranges.size() : 0;
+        if (scans[s]) {
+            LidarScanT<T> header = convertScanHeader<T>(*scans[s]);
+            if (!m_tables[s].matches(header, m_mounts[s], beams)) {
+                m_tables[s].build(header, m_mounts[s], beams);
+            }
+        }
+        offsets[s + 1] = offsets[s] + beams;
+    }
+
+    std::pmr::vector<PointT<T>> cloud(offsets[sensors], mr);
+    std::vector<size_t> kept(sensors, 0);
+
+    auto convertSensor = [&](size_t s) {
+        if (!scans[s]) return;
+        const BeamRotationTable<T>& table = m_tables[s];
+        const auto& ranges = scans[s]->ranges;
+        PointT<T>* out = cloud.data() + offsets[s];
+        size_t n = 0;
+        for (size_t i = 0; i < ranges.size(); ++i) {
+            if (table.convert(i, static_cast<T>(ranges[i]), out[n])) {
+                ++n;
+            }
+        }
+        kept[s] = n;
+    };
+
+    // İlk sensör çağıran iş parçacığında, diğerleri ayrı iş parçacıklarında
+    if (sensors > 1 && offsets[sensors] >= kParallelMinBeams) {
+        std::vector<std::thread> workers;
+        workers.reserve(sensors - 1);
+        for (size_t s = 1; s < sensors; ++s) {
+            workers.emplace_back(convertSensor, s);
+        }
+        convertSensor(0);
+        for (auto& w : workers) w.join();
+    } else {
+        for (size_t s = 0; s < sensors; ++s) convertSensor(s);
+    }
+
+    // Dilimlerdeki geçerli noktalar öne kaydırılır
+    size_t write = 0;
+    for (size_t s = 0; s < sensors; ++s) {
+        auto first = cloud.begin() + static_cast<std::ptrdiff_t>(offsets[s]);
+        std::copy(first, first + static_cast<std::ptrdiff_t>(kept[s]),
+                  cloud.begin() + static_cast<std::ptrdiff_t>(write));
+        write += kept[s];
+    }
+    cloud.resize(write);
+
+    if (counts) {
+        *counts = kept;
+    }
+    return cloud;
+}
+
+template class BeamRotationTable<float>;
+template class BeamRotationTable<double>;
+template class ScanFuser<float>;
+template class ScanFuser<double>;
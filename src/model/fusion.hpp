@@ -0,0 +1,66 @@
+#pragma once
+#include "model/types.hpp"
+#include <cstddef>
+#include <vector>
+
+// Sensörün araç çerçevesindeki montajı (metre, radyan)
+struct SensorMount {
+    double x   = 0.0;
+    double y   = 0.0;
+    double yaw = 0.0;
+};
+
+// Bir sensörün ışın başına birleşik dönüşüm tablosu: cos/sin(açı + yaw) bir kez
+// hesaplanır, dönüşüm çarp-topla'ya iner (nokta = öteleme + r * (cos, sin)).
+// Filtre convertBeam ile aynıdır; montaj sıfırsa sonuç onunla bit düzeyinde eşittir.
+template <typename T>
+class BeamRotationTable {
+public:
+    // Başlık (ranges kullanılmaz), montaj ve ışın sayısı değişmedikçe tablo yeniden kullanılır
+    void build(const LidarScanT<T>& header, const SensorMount& mount, size_t beams);
+    bool matches(const LidarScanT<T>& header, const SensorMount& mount, size_t beams) const;
+
+    size_t size() const { return m_cos.size(); }
+
+    bool convert(size_t index, T range, PointT<T>& out) const {
+        if (range == T(-1) || range == T(999) || range == T(-999)) {
+            return false;
+        }
+        if (range < m_rangeMin || range > m_rangeMax || !m_valid[index]) {
+            return false;
+        }
+        out.x = m_tx + range * m_cos[index];
+        out.y = m_ty + range * m_sin[index];
+        return true;
+    }
+
+private:
+    LidarScanT<T> m_header;
+    SensorMount m_mount;
+    std::vector<T> m_cos;
+    std::vector<T> m_sin;
+    std::vector<unsigned char> m_valid; // 0: ışın açısı angle_max'ı aşar
+    T m_tx = 0, m_ty = 0, m_rangeMin = 0, m_rangeMax = 0;
+};
+
+// Birden çok sensörün taramalarını araç çerçevesinde tek buluta birleştirir.
+// Her sensör kendi iş parçacığında ortak çıktı tamponunun ayrı bir dilimine dönüştürülür,
+// ardından dilimler sırayla sıkıştırılır (sensör sırası korunur).
+template <typename T>
+class ScanFuser {
+public:
+    explicit ScanFuser(std::vector<SensorMount> mounts);
+
+    size_t sensorCount() const { return m_mounts.size(); }
+
+    // scans[i] == nullptr: sensör bu turda yok (senkronizör atladı). scans.size() == sensorCount()
+    // counts verilirse sensör başına geçerli nokta sayısı yazılır.
+    std::pmr::vector<PointT<T>> fuse(
+        const std::vector<const LidarScan*>& scans,
+        std::pmr::memory_resource* mr = std::pmr::get_default_resource(),
+        std::vector<size_t>* counts = nullptr);
+
+private:
+    std::vector<SensorMount> m_mounts;
+    std::vector<BeamRotationTable<T>> m_tables;
+};
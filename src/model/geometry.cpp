@@ -7,28 +7,29 @@
 #define M_PI 3.14159265358979323846
 #endif
 
-std::optional<Point> getSegmentIntersection(const Line& segA, const Line& segB) {
-    Point p0 = segA.startPoint;
-    Point p1 = segA.endPoint;
-    Point p2 = segB.startPoint;
-    Point p3 = segB.endPoint;
-
-    double s1_x = p1.x - p0.x;
-    double s1_y = p1.y - p0.y;
-    double s2_x = p3.x - p2.x;
-    double s2_y = p3.y - p2.y;
-
-    double det = (-s2_x * s1_y + s1_x * s2_y);
-    if (std::abs(det) < 1e-9) {
+template <typename T>
+std::optional<PointT<T>> getSegmentIntersection(const LineT<T>& segA, const LineT<T>& segB) {
+    PointT<T> p0 = segA.startPoint;
+    PointT<T> p1 = segA.endPoint;
+    PointT<T> p2 = segB.startPoint;
+    PointT<T> p3 = segB.endPoint;
+
+    T s1_x = p1.x - p0.x;
+    T s1_y = p1.y - p0.y;
+    T s2_x = p3.x - p2.x;
+    T s2_y = p3.y - p2.y;
+
+    T det = (-s2_x * s1_y + s1_x * s2_y);
+    if (std::abs(det) < T(1e-9)) {
         return std::nullopt;
     }
 
-    double s, t;
+    T s, t;
     s = (-s1_y * (p0.x - p2.x) + s1_x * (p0.y - p2.y)) / det;
     t = ( s2_x * (p0.y - p2.y) - s2_y * (p0.x - p2.x)) / det;
 
     if (s >= 0 && s <= 1 && t >= 0 && t <= 1) {
-        Point intersection;
+        PointT<T> intersection;
         intersection.x = p0.x + (t * s1_x);
         intersection.y = p0.y + (t * s1_y);
         return intersection;
@@ -38,64 +39,109 @@ std::optional<Point> getSegmentIntersection(const Line& segA, const Line& segB)
 }
 
 // İki Doğrunun Vektörleri Arasındaki Açı
-static double getAngleBetweenLines(const Line& lineA, const Line& lineB) {
-    double vA_x = lineA.B;
-    double vA_y = -lineA.A;
+template <typename T>
+static T getAngleBetweenLines(const LineT<T>& lineA, const LineT<T>& lineB) {
+    T vA_x = lineA.B;
+    T vA_y = -lineA.A;
 
-    double vB_x = lineB.B;
-    double vB_y = -lineB.A;
+    T vB_x = lineB.B;
+    T vB_y = -lineB.A;
 
-    double dotProduct = vA_x * vB_x + vA_y * vB_y;
-    double magA = std::sqrt(vA_x * vA_x + vA_y * vA_y);
-    double magB = std::sqrt(vB_x * vB_x + vB_y * vB_y);
+    T dotProduct = vA_x * vB_x + vA_y * vB_y;
+    T magA = std::sqrt(vA_x * vA_x + vA_y * vA_y);
+    T magB = std::sqrt(vB_x * vB_x + vB_y * vB_y);
 
     if (magA == 0 || magB == 0) return 0;
 
-    double cosTheta = dotProduct / (magA * magB);
+    T cosTheta = dotProduct / (magA * magB);
 
-    cosTheta = std::max(-1.0, std::min(1.0, cosTheta));
+    cosTheta = std::max(T(-1), std::min(T(1), cosTheta));
 
-    double angleRad = std::acos(cosTheta);
+    T angleRad = std::acos(cosTheta);
 
-    double angleDeg = (angleRad * 180.0) / M_PI;
+    T angleDeg = (angleRad * T(180)) / T(M_PI);
 
-    if (angleDeg > 90.0) {
-        angleDeg = 180.0 - angleDeg;
+    if (angleDeg > T(90)) {
+        angleDeg = T(180) - angleDeg;
     }
 
     return angleDeg;
 }
 
-// Geometri Fonksiyonu
-std::vector<Intersection> findPhysicalIntersections(
-    const std::vector<Line>& segments,
-    double minAngleDeg)
-{
-    std::vector<Intersection> validIntersections;
+template <typename T>
+std::optional<IntersectionT<T>> evaluateSegmentPair(const LineT<T>& segA, const LineT<T>& segB, double minAngleDeg) {
+    std::optional<PointT<T>> intersectionPoint = getSegmentIntersection(segA, segB);
 
-    for (size_t i = 0; i < segments.size(); ++i) {
-        for (size_t j = i + 1; j < segments.size(); ++j) {
-            const Line& segA = segments[i];
-            const Line& segB = segments[j];
+    if (intersectionPoint.has_value()) {
+        PointT<T> p_intersect = intersectionPoint.value();
 
-            std::optional<Point> intersectionPoint = getSegmentIntersection(segA, segB);
+        T angle = getAngleBetweenLines(segA, segB);
 
-            if (intersectionPoint.has_value()) {
-                Point p_intersect = intersectionPoint.value();
+        if (angle >= minAngleDeg) {
 
-                double angle = getAngleBetweenLines(segA, segB);
+            T dist =
+                std::sqrt(p_intersect.x * p_intersect.x + p_intersect.y * p_intersect.y);
 
-                if (angle >= minAngleDeg) {
+            return IntersectionT<T>{p_intersect, angle, dist};
+        }
+    }
+    return std::nullopt;
+}
 
-                    double dist =
-                        std::sqrt(p_intersect.x * p_intersect.x + p_intersect.y * p_intersect.y);
+// Geometri Fonksiyonu
+template <typename T>
+std::pmr::vector<IntersectionT<T>> findPhysicalIntersections(
+    const std::pmr::vector<LineT<T>>& segments,
+    double minAngleDeg,
+    std::pmr::memory_resource* mr)
+{
+    std::pmr::vector<IntersectionT<T>> validIntersections(mr);
 
-                    validIntersections.push_back({p_intersect, angle, dist});
-                }
+    for (size_t i = 0; i < segments.size(); ++i) {
+        for (size_t j = i + 1; j < segments.size(); ++j) {
+            std::optional<IntersectionT<T>> hit = evaluateSegmentPair(segments[i], segments[j], minAngleDeg);
+            if (hit.has_value()) {
+                validIntersections.push_back(*hit);
             }
         }
     }
 
 
     return validIntersections;
-}
\ No newline at end of file
+}
+
+template <typename T>
+bool fitLineFromMoments(T meanX, T meanY, T Sxx, T Sxy, T Syy, LineT<T>& out) {
+    const T trace = Sxx + Syy;
+    const T D = Sxx * Syy - Sxy * Sxy;
+    const T lambda = trace / T(2) - std::sqrt(std::max(T(0), trace * trace / T(4) - D));
+
+    // (Sxy, lambda - Sxx) özvektörü Sxy = 0 iken sıfırlanabilir: diğer satırdan
+    T A = Sxy, B = lambda - Sxx;
+    T mag = std::sqrt(A * A + B * B);
+    if (mag < T(1e-9)) {
+        A = lambda - Syy;
+        B = Sxy;
+        mag = std::sqrt(A * A + B * B);
+        if (mag < T(1e-9)) return false;
+    }
+
+    out.A = A / mag;
+    out.B = B / mag;
+    out.C = -out.A * meanX - out.B * meanY;
+    return true;
+}
+
+template bool fitLineFromMoments(float, float, float, float, float, LineT<float>&);
+template bool fitLineFromMoments(double, double, double, double, double, LineT<double>&);
+
+template std::optional<PointT<float>> getSegmentIntersection(const LineT<float>&, const LineT<float>&);
+template std::optional<PointT<double>> getSegmentIntersection(const LineT<double>&, const LineT<double>&);
+
+template std::optional<IntersectionT<float>> evaluateSegmentPair(const LineT<float>&, const LineT<float>&, double);
+template std::optional<IntersectionT<double>> evaluateSegmentPair(const LineT<double>&, const LineT<double>&, double);
+
+template std::pmr::vector<IntersectionT<float>> findPhysicalIntersections(
+    const std::pmr::vector<LineT<float>>&, double, std::pmr::memory_resource*);
+template std::pmr::vector<IntersectionT<double>> findPhysicalIntersections(
+    const std::pmr::vector<LineT<double>>&, double, std::pmr::memory_resource*);
@@ -3,9 +3,22 @@
 #include <vector>
 #include <optional>
 
-std::optional<Point> getSegmentIntersection(const Line& segA, const Line& segB);
+// Ortalama (meanX, meanY) ve merkezi ikinci momentlerden (Sxx, Sxy, Syy) toplam en küçük
+// kareler doğrusu: normal, kovaryansın küçük özdeğerinin özvektörüdür. Yalnızca out'un A, B, C
+// alanları yazılır (birim normal). Momentler dejenereyse (tüm noktalar üst üste) false.
+template <typename T>
+bool fitLineFromMoments(T meanX, T meanY, T Sxx, T Sxy, T Syy, LineT<T>& out);
 
-std::vector<Intersection> findPhysicalIntersections(
-    const std::vector<Line>& segments,
-    double minAngleDeg
-);
\ No newline at end of file
+template <typename T>
+std::optional<PointT<T>> getSegmentIntersection(const LineT<T>& segA, const LineT<T>& segB);
+
+// Tek parça çifti: kesişiyor ve açı eşiği sağlanıyorsa kesişim (findPhysicalIntersections'ın iç adımı)
+template <typename T>
+std::optional<IntersectionT<T>> evaluateSegmentPair(const LineT<T>& segA, const LineT<T>& segB, double minAngleDeg);
+
+template <typename T>
+std::pmr::vector<IntersectionT<T>> findPhysicalIntersections(
+    const std::pmr::vector<LineT<T>>& segments,
+    double minAngleDeg,
+    std::pmr::memory_resource* mr = std::pmr::get_default_resource()
+);
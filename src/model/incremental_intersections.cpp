@@ -0,0 +1,246 @@
+#include "incremental_intersections.hpp"
+#include "model/geometry.hpp"
+#include <algorithm>
+#include <cmath>
+
+// YARDIMCI FONKSİYONLAR
+// İki parçanın uç noktaları arasındaki en büyük mesafe (yön farketmez)
+template <typename T>
+static T endpointDeviation(const LineT<T>& a, const LineT<T>& b) {
+    auto d = [](const PointT<T>& p, const PointT<T>& q) { return std::hypot(p.x - q.x, p.y - q.y); };
+    T same = std::max(d(a.startPoint, b.startPoint), d(a.endPoint, b.endPoint));
+    T swapped = std::max(d(a.startPoint, b.endPoint), d(a.endPoint, b.startPoint));
+    return std::min(same, swapped);
+}
+
+// KESİŞİM MOTORU
+template <typename T>
+IncrementalIntersector<T>::IncrementalIntersector(double minAngleDeg, double tolerance)
+    : m_minAngleDeg(minAngleDeg),
+      m_tolerance(static_cast<T>(std::max(tolerance, 0.0))),
+      // Orta noktalar en fazla tolerans kadar kayar: 3x3 hücre komşuluğu yeterli
+      m_cellSize(static_cast<T>(std::max(tolerance, 1e-3)))
+{
+}
+
+template <typename T>
+void IncrementalIntersector<T>::reset() {
+    m_slots.clear();
+    m_freeSlots.clear();
+    m_cache.clear();
+    m_ids.clear();
+    m_past.clear();
+    m_nextId = 1;
+    m_stats = IncrementalIntersectionStats{};
+}
+
+template <typename T>
+int64_t IncrementalIntersector<T>::cellKey(T x, T y) const {
+    const auto cx = static_cast<int32_t>(std::floor(x / m_cellSize));
+    const auto cy = static_cast<int32_t>(std::floor(y / m_cellSize));
+    return static_cast<int64_t>((static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) |
+                                static_cast<uint32_t>(cy));
+}
+
+template <typename T>
+uint32_t IncrementalIntersector<T>::allocateSlot() {
+    if (!m_freeSlots.empty()) {
+        uint32_t s = m_freeSlots.back();
+        m_freeSlots.pop_back();
+        return s;
+    }
+
+    const auto s = static_cast<uint32_t>(m_slots.size());
+    m_slots.emplace_back();
+    return s;
+}
+
+// Önceki karenin parçaları orta nokta ızgarasına konur; her yeni parça komşu hücrelerdeki
+// sahipsiz en yakın referansla eşlenir. Eşlenmeyen eski slotlar boşaltılır.
+template <typename T>
+void IncrementalIntersector<T>::matchSegments(const std::pmr::vector<LineT<T>>& segments) {
+    m_grid.clear();
+    for (uint32_t s = 0; s < m_slots.size(); ++s) {
+        if (!m_slots[s].live) continue;
+        const LineT<T>& r = m_slots[s].ref;
+        m_grid.emplace_back(cellKey((r.startPoint.x + r.endPoint.x) / 2, (r.startPoint.y + r.endPoint.y) / 2), s);
+    }
+    std::sort(m_grid.begin(), m_grid.end());
+    m_claimed.assign(m_slots.size(), 0);
+
+    const uint32_t none = UINT32_MAX;
+    m_current.assign(segments.size(), none);
+    for (size_t i = 0; i < segments.size(); ++i) {
+        const LineT<T>& seg = segments[i];
+        const T mx = (seg.startPoint.x + seg.endPoint.x) / 2;
+        const T my = (seg.startPoint.y + seg.endPoint.y) / 2;
+
+        uint32_t best = none;
+        T bestDev = m_tolerance;
+        for (int dx = -1; dx <= 1; ++dx) {
+            for (int dy = -1; dy <= 1; ++dy) {
+                const int64_t key = cellKey(mx + dx * m_cellSize, my + dy * m_cellSize);
+                auto it = std::lower_bound(m_grid.begin(), m_grid.end(), std::make_pair(key, uint32_t{0}));
+                for (; it != m_grid.end() && it->first == key; ++it) {
+                    if (m_claimed[it->second]) continue;
+                    T dev = endpointDeviation(m_slots[it->second].ref, seg);
+                    if (dev <= bestDev) {
+                        bestDev = dev;
+                        best = it->second;
+                    }
+                }
+            }
+        }
+
+        if (best != none) {
+            m_claimed[best] = 1;
+            m_slots[best].fresh = false;
+            m_current[i] = best;
+            ++m_stats.matched;
+        }
+    }
+
+    for (uint32_t s = 0; s < m_claimed.size(); ++s) {
+        if (m_slots[s].live && !m_claimed[s]) {
+            m_slots[s].live = false;
+            m_freeSlots.push_back(s);
+        }
+    }
+
+    for (size_t i = 0; i < segments.size(); ++i) {
+        if (m_current[i] != none) continue;
+        const uint32_t s = allocateSlot();
+        m_slots[s].ref = segments[i];
+        m_slots[s].live = true;
+        m_slots[s].fresh = true;
+        m_current[i] = s;
+        ++m_stats.fresh;
+    }
+}
+
+template <typename T>
+std::pmr::vector<IntersectionT<T>> IncrementalIntersector<T>::update(
+    const std::pmr::vector<LineT<T>>& segments,
+    std::pmr::memory_resource* mr)
+{
+    m_stats = IncrementalIntersectionStats{};
+    m_stats.segments = segments.size();
+    matchSegments(segments);
+
+    const uint32_t none = UINT32_MAX;
+    m_segmentOf.assign(m_slots.size(), none);
+    m_freshSegments.clear();
+    for (size_t i = 0; i < segments.size(); ++i) {
+        m_segmentOf[m_current[i]] = static_cast<uint32_t>(i);
+        if (m_slots[m_current[i]].fresh) m_freshSegments.push_back(static_cast<uint32_t>(i));
+    }
+    auto order = [](size_t i, size_t j) {
+        return (static_cast<uint64_t>(std::min(i, j)) << 32) | std::max(i, j);
+    };
+
+    m_next.clear();
+    m_order.clear();
+    // İki slotu da eşlenmiş çiftler: önbellekte yoksa önceki karede de kesişmiyordu
+    for (const PairEntry& e : m_cache) {
+        const uint32_t i = m_segmentOf[e.a], j = m_segmentOf[e.b];
+        if (i == none || j == none || m_slots[e.a].fresh || m_slots[e.b].fresh) continue;
+        m_order.emplace_back(order(i, j), static_cast<uint32_t>(m_next.size()));
+        m_next.push_back(e);
+    }
+
+    // Yeni slot içeren çiftler (iki ucu da yeniyse bir kez)
+    for (uint32_t i : m_freshSegments) {
+        const uint32_t a = m_current[i];
+        for (size_t j = 0; j < segments.size(); ++j) {
+            const uint32_t b = m_current[j];
+            if (j == i || (m_slots[b].fresh && j < i)) continue;
+            // Slot sırasıyla: aynı geometri kare sırasından bağımsız olarak aynı bitleri verir
+            std::optional<IntersectionT<T>> hit = a < b
+                ? evaluateSegmentPair(segments[i], segments[j], m_minAngleDeg)
+                : evaluateSegmentPair(segments[j], segments[i], m_minAngleDeg);
+            ++m_stats.pairsEvaluated;
+            if (!hit) continue;
+            m_order.emplace_back(order(i, j), static_cast<uint32_t>(m_next.size()));
+            m_next.push_back(PairEntry{std::min(a, b), std::max(a, b), *hit, 0});
+        }
+    }
+    const size_t n = segments.size();
+    m_stats.pairsReused = (n > 1 ? n * (n - 1) / 2 : 0) - m_stats.pairsEvaluated;
+
+    // Çift sırası findPhysicalIntersections ile aynı
+    std::sort(m_order.begin(), m_order.end());
+    std::pmr::vector<IntersectionT<T>> result(mr);
+    result.reserve(m_order.size());
+    m_ids.clear();
+    m_pending.clear();
+    m_taken.clear();
+    for (const auto& [key, entry] : m_order) {
+        const PairEntry& e = m_next[entry];
+        if (e.id == 0) {
+            m_pending.emplace_back(result.size(), entry);
+        } else {
+            m_taken.push_back(e.id);
+        }
+        result.push_back(e.intersection);
+        m_ids.push_back(e.id);
+    }
+
+    // Yeni hesaplanan kesişimler: önceki karede yakında, başka çiftin tutmadığı kimlik devralınır.
+    // Geçmiş kesişimler parça eşlemesindeki gibi hücre ızgarasına konur (hücre >= tolerans:
+    // 3x3 komşuluk yeterli); önbellekten gelen çiftlerin kimlikleri baştan sahiplenilmiş sayılır
+    std::sort(m_taken.begin(), m_taken.end());
+    m_pastClaimed.assign(m_past.size(), 0);
+    m_pastGrid.clear();
+    if (!m_pending.empty()) {
+        for (uint32_t q = 0; q < m_past.size(); ++q) {
+            if (std::binary_search(m_taken.begin(), m_taken.end(), m_past[q].id)) {
+                m_pastClaimed[q] = 1;
+                continue;
+            }
+            m_pastGrid.emplace_back(cellKey(m_past[q].position.x, m_past[q].position.y), q);
+        }
+        std::sort(m_pastGrid.begin(), m_pastGrid.end());
+    }
+    for (auto& [k, entry] : m_pending) {
+        const PointT<T>& p = result[k].position;
+        size_t best = m_past.size();
+        T bestDist = m_tolerance;
+        for (int dx = -1; dx <= 1; ++dx) {
+            for (int dy = -1; dy <= 1; ++dy) {
+                const int64_t key = cellKey(p.x + dx * m_cellSize, p.y + dy * m_cellSize);
+                auto it = std::lower_bound(m_pastGrid.begin(), m_pastGrid.end(), std::make_pair(key, uint32_t{0}));
+                for (; it != m_pastGrid.end() && it->first == key; ++it) {
+                    const uint32_t q = it->second;
+                    if (m_pastClaimed[q]) continue;
+                    T dist = std::hypot(m_past[q].position.x - p.x, m_past[q].position.y - p.y);
+                    // Eşit uzaklıkta büyük indeks: doğrusal taramayla aynı seçim
+                    if (dist < bestDist || (dist == bestDist && (best == m_past.size() || q > best))) {
+                        bestDist = dist;
+                        best = q;
+                    }
+                }
+            }
+        }
+
+        PairEntry& e = m_next[entry];
+        if (best < m_past.size()) {
+            m_pastClaimed[best] = 1;
+            e.id = m_past[best].id;
+        } else {
+            e.id = m_nextId++;
+            ++m_stats.newIds;
+        }
+        m_ids[k] = e.id;
+    }
+    std::swap(m_cache, m_next);
+    m_stats.cachedPairs = m_cache.size();
+
+    m_past.clear();
+    for (size_t k = 0; k < result.size(); ++k) {
+        m_past.push_back({result[k].position, m_ids[k]});
+    }
+    return result;
+}
+
+template class IncrementalIntersector<float>;
+template class IncrementalIntersector<double>;
@@ -0,0 +1,99 @@
+#pragma once
+#include "model/types.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct IncrementalIntersectionStats {
+    size_t segments = 0;
+    size_t matched = 0;        // Önceki karedeki bir parçaya tolerans içinde eşlenen
+    size_t fresh = 0;          // Yeni ya da toleransı aşacak kadar değişmiş
+    size_t pairsEvaluated = 0; // Bu karede hesaplanan parça çifti
+    size_t pairsReused = 0;    // Önbellekten alınan çift
+    size_t newIds = 0;         // Bu karede ilk kez görülen kesişim
+    size_t cachedPairs = 0;    // Sonraki kareye taşınan (kesişen) çift
+};
+
+// Kareler arası durumlu kesişim motoru. Her karede parçalar önceki karenin parçalarıyla
+// eşlenir (iki uç noktası da tolerans içinde, yön farketmez); iki ucu da eşlenmiş çiftin
+// sonucu önbellekten alınır, yalnızca yeni / değişmiş parça içeren çiftler hesaplanır.
+// Sonuç sırası findPhysicalIntersections ile aynıdır; değerler çift sırasından kaynaklı yuvarlama
+// farkı dışında aynıdır. Önbellekten gelen çiftlerde konum, parçaların önbellek anındaki
+// hâline göredir (en fazla tolerans mertebesinde sapma).
+//
+// Eşleme, parçanın en son hesaplandığı (referans) geometrisine göre yapılır: yavaş kayan
+// bir parça birikimli sapmayla eşlenmeye devam etmez, tolerans aşılınca yeniden hesaplanır.
+// Kesişim kimlikleri kareler arası kararlıdır: önbellekten gelen çift kimliğini korur,
+// yeni hesaplanan kesişim önceki karede tolerans içindeki sahipsiz kesişimin kimliğini alır.
+//
+// Önbellek yalnızca önceki karenin kesişen çiftlerini (slot çifti ile) tutar: iki slotu da
+// eşlenmiş çiftlerin sonucu, önbellekteki kesişimlerden doğrudan alınır; çift başına arama
+// yoktur, yalnızca yeni slot içeren çiftler gezilir. Önbellek her karede yeniden kurulur, boyutu
+// güncel kesişim sayısıdır; bırakılan slotların çiftleri kendiliğinden düşer.
+template <typename T>
+class IncrementalIntersector {
+public:
+    // tolerance: uç nokta eşleme ve kimlik devri mesafesi (m); 0 yalnızca birebir aynı parçaları eşler
+    IncrementalIntersector(double minAngleDeg, double tolerance);
+
+    std::pmr::vector<IntersectionT<T>> update(
+        const std::pmr::vector<LineT<T>>& segments,
+        std::pmr::memory_resource* mr = std::pmr::get_default_resource()
+    );
+
+    // Son update() sonucuna paralel: kesişim kimlikleri (1'den başlar)
+    const std::vector<uint64_t>& ids() const { return m_ids; }
+
+    const IncrementalIntersectionStats& stats() const { return m_stats; }
+
+    // Tüm önbelleği ve kimlik geçmişini bırakır
+    void reset();
+
+private:
+    struct Slot {
+        LineT<T> ref;        // Çift sonuçlarının hesaplandığı geometri
+        bool live = false;
+        bool fresh = false;  // Bu karede yeni atandı: çiftleri yeniden hesaplanır
+    };
+
+    struct PairEntry {
+        uint32_t a = 0, b = 0;   // Slot çifti (küçük, büyük)
+        IntersectionT<T> intersection;
+        uint64_t id = 0;         // 0: kimlik bekliyor
+    };
+
+    struct PastIntersection {
+        PointT<T> position;
+        uint64_t id = 0;
+    };
+
+    void matchSegments(const std::pmr::vector<LineT<T>>& segments);
+    uint32_t allocateSlot();
+    int64_t cellKey(T x, T y) const;
+
+    double m_minAngleDeg;
+    T m_tolerance;
+    T m_cellSize;
+
+    std::vector<Slot> m_slots;
+    std::vector<uint32_t> m_freeSlots;
+    std::vector<PairEntry> m_cache;   // Önceki karenin kesişen çiftleri
+    std::vector<PairEntry> m_next;    // Bu karede kurulan
+
+    // Kare başına yeniden kullanılan tamponlar
+    std::vector<std::pair<int64_t, uint32_t>> m_grid; // (orta nokta hücresi, slot), sıralı
+    std::vector<char> m_claimed;
+    std::vector<uint32_t> m_current;                   // Güncel parça -> slot
+    std::vector<uint32_t> m_segmentOf;                 // Slot -> güncel parça
+    std::vector<uint32_t> m_freshSegments;
+    std::vector<std::pair<uint64_t, uint32_t>> m_order; // (parça çifti sırası, m_next girdisi)
+    std::vector<std::pair<size_t, uint32_t>> m_pending; // Kimlik bekleyen (sonuç indeksi, m_next girdisi)
+    std::vector<uint64_t> m_taken;
+
+    std::vector<uint64_t> m_ids;
+    std::vector<PastIntersection> m_past;
+    std::vector<char> m_pastClaimed;
+    std::vector<std::pair<int64_t, uint32_t>> m_pastGrid; // (kesişim hücresi, m_past indeksi), sıralı
+    uint64_t m_nextId = 1;
+    IncrementalIntersectionStats m_stats;
+};
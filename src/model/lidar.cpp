@@ -1,33 +1,51 @@
 #include "lidar.hpp"
-#include <cmath>
 
-std::vector<Point> filterAndConvertToPoints(const LidarScan& scan) {
-    std::vector<Point> points;
+template <typename T>
+std::pmr::vector<PointT<T>> filterAndConvertToPoints(const LidarScanT<T>& scan, std::pmr::memory_resource* mr) {
+    std::pmr::vector<PointT<T>> points(mr);
+    points.reserve(scan.ranges.size());
 
+    PointT<T> p;
     for (size_t i = 0; i < scan.ranges.size(); ++i) {
-        double range = scan.ranges[i];
-
-        if (range == -1.0 || range == 999.0 || range == -999.0) {
-            continue;
+        if (convertBeam(scan, i, scan.ranges[i], p)) {
+            points.push_back(p);
         }
+    }
 
-        if (range < scan.range_min || range > scan.range_max) {
-            continue;
-        }
 
-        double angle = scan.angle_min + (i * scan.angle_increment);
+    return points;
+}
+
+template std::pmr::vector<PointT<float>> filterAndConvertToPoints(const LidarScanT<float>&, std::pmr::memory_resource*);
+template std::pmr::vector<PointT<double>> filterAndConvertToPoints(const LidarScanT<double>&, std::pmr::memory_resource*);
 
-        if (angle > scan.angle_max) {
+template <typename T>
+std::pmr::vector<PointT<T>> filterAndConvertToPoints(const QuantizedScan& scan, std::pmr::memory_resource* mr) {
+    std::pmr::vector<PointT<T>> points(mr);
+    points.reserve(scan.codes.size());
+
+    const T angleMin = static_cast<T>(scan.angle_min);
+    const T angleMax = static_cast<T>(scan.angle_max);
+    const T angleInc = static_cast<T>(scan.angle_increment);
+    const T scale = static_cast<T>(scan.scale);
+
+    for (size_t i = 0; i < scan.codes.size(); ++i) {
+        const uint16_t code = scan.codes[i];
+        if (code > RangeCode::MaxValue) {
             continue;
         }
 
-        Point p;
-        p.x = range * std::cos(angle);
-        p.y = range * std::sin(angle);
+        T angle = angleMin + (static_cast<T>(i) * angleInc);
+        if (angle > angleMax) {
+            continue;
+        }
 
-        points.push_back(p);
+        const T range = static_cast<T>(code) * scale;
+        points.push_back({range * std::cos(angle), range * std::sin(angle)});
     }
 
-
     return points;
-}
\ No newline at end of file
+}
+
+template std::pmr::vector<PointT<float>> filterAndConvertToPoints<float>(const QuantizedScan&, std::pmr::memory_resource*);
+template std::pmr::vector<PointT<double>> filterAndConvertToPoints<double>(const QuantizedScan&, std::pmr::memory_resource*);
@@ -1,4 +1,56 @@
 #pragma once
+#include "model/quantized_scan.hpp"
 #include "model/types.hpp"
+#include <cmath>
 
-std::vector<Point> filterAndConvertToPoints(const LidarScan& scan);
\ No newline at end of file
+// Tek ışının filtresi ve kartezyen dönüşümü. Toplu (filterAndConvertToPoints) ve
+// akış (scan_stream) yolları aynı kuralı kullanır. Geçerliyse out doldurulur.
+template <typename T>
+inline bool convertBeam(const LidarScanT<T>& scan, size_t index, T range, PointT<T>& out) {
+    if (range == T(-1) || range == T(999) || range == T(-999)) {
+        return false;
+    }
+
+    if (range < scan.range_min || range > scan.range_max) {
+        return false;
+    }
+
+    T angle = scan.angle_min + (static_cast<T>(index) * scan.angle_increment);
+
+    if (angle > scan.angle_max) {
+        return false;
+    }
+
+    out.x = range * std::cos(angle);
+    out.y = range * std::sin(angle);
+    return true;
+}
+
+// Başlık alanlarını başka hassasiyete taşır; ranges mr ile boş oluşturulur
+template <typename To, typename From>
+LidarScanT<To> convertScanHeader(
+    const LidarScanT<From>& scan,
+    std::pmr::memory_resource* mr = std::pmr::get_default_resource())
+{
+    return LidarScanT<To>{
+        static_cast<To>(scan.angle_min), static_cast<To>(scan.angle_max),
+        static_cast<To>(scan.angle_increment), static_cast<To>(scan.range_min),
+        static_cast<To>(scan.range_max), std::pmr::vector<To>(mr)
+    };
+}
+
+// Dönen nokta dizisi mr'den ayrılır (tarama başına arena için bkz. utils/scan_arena.hpp)
+template <typename T>
+std::pmr::vector<PointT<T>> filterAndConvertToPoints(
+    const LidarScanT<T>& scan,
+    std::pmr::memory_resource* mr = std::pmr::get_default_resource()
+);
+
+// Sıkıştırılmış tarama: kodlar döngü içinde çözülür (ara double dizi yok). Menzil filtresi
+// kodlamada uygulandığından yalnızca ayrılmış kodlar ve açı sınırı denetlenir.
+// T çıkarılamaz: filterAndConvertToPoints<double>(q) biçiminde çağrılır.
+template <typename T>
+std::pmr::vector<PointT<T>> filterAndConvertToPoints(
+    const QuantizedScan& scan,
+    std::pmr::memory_resource* mr = std::pmr::get_default_resource()
+);
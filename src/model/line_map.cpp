@@ -0,0 +1,236 @@
+#include "line_map.hpp"
+#include "model/geometry.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// YARDIMCI FONKSİYONLAR
+// Birleşik merkezi momentlerden toplam en küçük kareler doğrusu
+static bool refit(MapSegment& s) {
+    return fitLineFromMoments(s.mean.x, s.mean.y, s.sxx, s.sxy, s.syy, s.line);
+}
+
+// Birim normalli doğru üzerinde parametre: nokta = taban + t * (B, -A)
+static double paramOn(const Line& l, const Point& p) {
+    return p.x * l.B - p.y * l.A;
+}
+
+static Point pointOn(const Line& l, double t) {
+    return Point{-l.A * l.C + t * l.B, -l.B * l.C - t * l.A};
+}
+
+static double lengthOf(const Line& l) {
+    return std::hypot(l.endPoint.x - l.startPoint.x, l.endPoint.y - l.startPoint.y);
+}
+
+static uint64_t cellKey(int64_t cx, int64_t cy) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) | static_cast<uint32_t>(cy);
+}
+
+LineMap::LineMap(LineMapParams params)
+    : m_params(params),
+      m_maxSin(std::sin(params.maxAngleDeg * M_PI / 180.0))
+{
+    m_params.cellSize = std::max(params.cellSize, 1e-3);
+    m_heads.reserve(512);
+}
+
+// DİZİN
+// a-b parçasının (margin genişletilmiş) değdiği hücreler, tekil; parça hücre boyunda dilimlere bölünür
+void LineMap::collectCells(const Point& a, const Point& b, double margin) {
+    m_cells.clear();
+    if (!std::isfinite(a.x) || !std::isfinite(a.y) || !std::isfinite(b.x) || !std::isfinite(b.y)) return;
+
+    const double cell = m_params.cellSize;
+    const double len = std::hypot(b.x - a.x, b.y - a.y);
+    const auto steps = static_cast<int>(std::max(1.0, std::ceil(len / cell)));
+    for (int i = 0; i < steps; ++i) {
+        const double t0 = static_cast<double>(i) / steps, t1 = static_cast<double>(i + 1) / steps;
+        const double x0 = a.x + (b.x - a.x) * t0, x1 = a.x + (b.x - a.x) * t1;
+        const double y0 = a.y + (b.y - a.y) * t0, y1 = a.y + (b.y - a.y) * t1;
+        const auto cx0 = static_cast<int64_t>(std::floor((std::min(x0, x1) - margin) / cell));
+        const auto cx1 = static_cast<int64_t>(std::floor((std::max(x0, x1) + margin) / cell));
+        const auto cy0 = static_cast<int64_t>(std::floor((std::min(y0, y1) - margin) / cell));
+        const auto cy1 = static_cast<int64_t>(std::floor((std::max(y0, y1) + margin) / cell));
+        for (int64_t cy = cy0; cy <= cy1; ++cy) {
+            for (int64_t cx = cx0; cx <= cx1; ++cx) m_cells.push_back(cellKey(cx, cy));
+        }
+    }
+    std::sort(m_cells.begin(), m_cells.end());
+    m_cells.erase(std::unique(m_cells.begin(), m_cells.end()), m_cells.end());
+}
+
+void LineMap::insertCells(uint32_t segment, const Point& a, const Point& b) {
+    collectCells(a, b, 0.0);
+    for (uint64_t key : m_cells) {
+        auto [head, inserted] = m_heads.tryEmplace(key);
+        m_entries.push_back({segment, inserted ? -1 : *head});
+        *head = static_cast<int32_t>(m_entries.size() - 1);
+    }
+}
+
+// BİRLEŞTİRME
+// Kısa parçanın uçları uzun parçanın doğrusuna yakın ve doğru boyunca aralarındaki boşluk küçük
+bool LineMap::collinear(const MapSegment& a, const MapSegment& b) const {
+    const Line& la = a.line;
+    const Line& lb = b.line;
+    if (std::abs(la.A * lb.B - la.B * lb.A) > m_maxSin) return false;
+
+    const bool aLonger = lengthOf(la) >= lengthOf(lb);
+    const Line& lng = aLonger ? la : lb;
+    const Line& sht = aLonger ? lb : la;
+    auto offset = [&lng](const Point& p) { return std::abs(lng.A * p.x + lng.B * p.y + lng.C); };
+    if (offset(sht.startPoint) > m_params.maxOffset || offset(sht.endPoint) > m_params.maxOffset) return false;
+
+    const double l0 = std::min(paramOn(lng, lng.startPoint), paramOn(lng, lng.endPoint));
+    const double l1 = std::max(paramOn(lng, lng.startPoint), paramOn(lng, lng.endPoint));
+    const double s0 = std::min(paramOn(lng, sht.startPoint), paramOn(lng, sht.endPoint));
+    const double s1 = std::max(paramOn(lng, sht.startPoint), paramOn(lng, sht.endPoint));
+    return std::max(l0, s0) - std::min(l1, s1) <= m_params.maxGap;
+}
+
+void LineMap::absorb(MapSegment& into, const MapSegment& from) {
+    const uint32_t id = static_cast<uint32_t>(&into - m_segments.data());
+    const Line before = into.line;
+
+    // Momentlerin birleşimi (paralel eksen): ortalamalar arası fark merkezi momentlere eklenir
+    const double n = into.weight + from.weight;
+    const double dx = from.mean.x - into.mean.x, dy = from.mean.y - into.mean.y;
+    const double f = into.weight * from.weight / n;
+    into.sxx += from.sxx + dx * dx * f;
+    into.sxy += from.sxy + dx * dy * f;
+    into.syy += from.syy + dy * dy * f;
+    into.mean.x += dx * from.weight / n;
+    into.mean.y += dy * from.weight / n;
+    into.weight = n;
+    into.observations += from.observations;
+    into.line.inlierCount = static_cast<uint32_t>(std::min(n, static_cast<double>(std::numeric_limits<uint32_t>::max())));
+    if (!refit(into)) return;
+
+    const Line& l = into.line;
+    const double b0 = paramOn(l, before.startPoint), b1 = paramOn(l, before.endPoint);
+    const double f0 = paramOn(l, from.line.startPoint), f1 = paramOn(l, from.line.endPoint);
+    const double oldMin = std::min(b0, b1), oldMax = std::max(b0, b1);
+    const double tMin = std::min({oldMin, f0, f1}), tMax = std::max({oldMax, f0, f1});
+    into.line.startPoint = pointOn(l, tMin);
+    into.line.endPoint = pointOn(l, tMax);
+
+    // Yalnızca uzayan uçlar dizine eklenir; doğrunun küçük kayması sorgu payıyla örtülür
+    if (tMin < oldMin) insertCells(id, pointOn(l, tMin), pointOn(l, oldMin));
+    if (tMax > oldMax) insertCells(id, pointOn(l, oldMax), pointOn(l, tMax));
+}
+
+// ANA FONKSİYON
+template <typename T>
+void LineMap::integrate(const std::pmr::vector<PointT<T>>& points,
+                        const std::pmr::vector<LineT<T>>& segments,
+                        const SensorPose& pose)
+{
+    const LineMapStats before = m_stats;
+    m_stats = LineMapStats{};
+    m_stats.frames = before.frames + 1;
+    m_stats.observed = segments.size();
+
+    const double c = std::cos(pose.yaw), s = std::sin(pose.yaw);
+    auto toWorld = [&](const PointT<T>& p) {
+        const double x = static_cast<double>(p.x), y = static_cast<double>(p.y);
+        return Point{pose.x + c * x - s * y, pose.y + s * x + c * y};
+    };
+    const double margin = m_params.maxGap + m_params.maxOffset;
+
+    for (const LineT<T>& seg : segments) {
+        if (seg.inlierCount < 2) continue;
+
+        // Gözlem: dünya çerçevesindeki inlier'ların momentleri ve doğru üzerindeki en dış izdüşümleri
+        MapSegment obs;
+        for (const PointT<T>& p : seg.inliers(points)) {
+            const Point w = toWorld(p);
+            obs.mean.x += w.x;
+            obs.mean.y += w.y;
+        }
+        obs.weight = static_cast<double>(seg.inlierCount);
+        obs.mean.x /= obs.weight;
+        obs.mean.y /= obs.weight;
+        for (const PointT<T>& p : seg.inliers(points)) {
+            const Point w = toWorld(p);
+            const double ex = w.x - obs.mean.x, ey = w.y - obs.mean.y;
+            obs.sxx += ex * ex;
+            obs.sxy += ex * ey;
+            obs.syy += ey * ey;
+        }
+        if (!refit(obs)) continue;
+
+        double tMin = std::numeric_limits<double>::max(), tMax = std::numeric_limits<double>::lowest();
+        for (const PointT<T>& p : seg.inliers(points)) {
+            const double t = paramOn(obs.line, toWorld(p));
+            tMin = std::min(tMin, t);
+            tMax = std::max(tMax, t);
+        }
+        obs.line.startPoint = pointOn(obs.line, tMin);
+        obs.line.endPoint = pointOn(obs.line, tMax);
+        obs.line.inlierCount = seg.inlierCount;
+        obs.observations = 1;
+
+        // Adaylar: parçanın çevresindeki hücrelerde kayıtlı yaşayan harita parçaları (tekil)
+        if (++m_query == 0) {
+            std::fill(m_visited.begin(), m_visited.end(), 0u);
+            m_query = 1;
+        }
+        collectCells(obs.line.startPoint, obs.line.endPoint, margin);
+        m_candidates.clear();
+        for (uint64_t key : m_cells) {
+            const int32_t* head = m_heads.find(key);
+            for (int32_t e = head ? *head : -1; e >= 0; e = m_entries[e].next) {
+                const uint32_t id = m_entries[e].segment;
+                if (!m_segments[id].alive || m_visited[id] == m_query) continue;
+                m_visited[id] = m_query;
+                m_candidates.push_back(id);
+            }
+        }
+        m_stats.candidates += m_candidates.size();
+
+        // En eski eşleşen parça hedeftir; diğer eşleşenler yeni gözlemle köprülenmişse ona katılır
+        std::sort(m_candidates.begin(), m_candidates.end());
+        auto match = std::find_if(m_candidates.begin(), m_candidates.end(),
+                                  [&](uint32_t id) { return collinear(m_segments[id], obs); });
+        if (match == m_candidates.end()) {
+            const auto id = static_cast<uint32_t>(m_segments.size());
+            m_segments.push_back(obs);
+            m_visited.push_back(0);
+            ++m_alive;
+            ++m_stats.added;
+            insertCells(id, obs.line.startPoint, obs.line.endPoint);
+            continue;
+        }
+
+        MapSegment& target = m_segments[*match];
+        absorb(target, obs);
+        ++m_stats.associated;
+        for (auto it = match + 1; it != m_candidates.end(); ++it) {
+            MapSegment& other = m_segments[*it];
+            if (!collinear(target, other)) continue;
+            absorb(target, other);
+            other.alive = false;
+            --m_alive;
+            ++m_stats.fused;
+        }
+    }
+}
+
+std::pmr::vector<Line> LineMap::lines(std::pmr::memory_resource* mr) const {
+    std::pmr::vector<Line> out(mr);
+    out.reserve(m_alive);
+    for (const MapSegment& s : m_segments) {
+        if (s.alive) out.push_back(s.line);
+    }
+    return out;
+}
+
+template void LineMap::integrate(const std::pmr::vector<PointT<float>>&, const std::pmr::vector<LineT<float>>&,
+                                 const SensorPose&);
+template void LineMap::integrate(const std::pmr::vector<PointT<double>>&, const std::pmr::vector<LineT<double>>&,
+                                 const SensorPose&);
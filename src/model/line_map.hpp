@@ -0,0 +1,94 @@
+#pragma once
+#include "model/scene.hpp"
+#include "model/types.hpp"
+#include "utils/flat_hash.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct LineMapParams {
+    double cellSize    = 1.0;   // m, dizin hücresi
+    double maxAngleDeg = 5.0;   // Eş doğrusal sayılacak en büyük açı farkı
+    double maxOffset   = 0.1;   // m, kısa parçanın uçlarının uzun parçanın doğrusuna en büyük uzaklığı
+    double maxGap      = 0.5;   // m, doğru boyunca iki parça arasındaki en büyük boşluk
+};
+
+struct LineMapStats {
+    size_t frames = 0;
+    size_t observed = 0;        // Son karenin parçaları
+    size_t associated = 0;      // Son karede mevcut harita parçasına eklenen
+    size_t added = 0;           // Son karede yeni harita parçası olan
+    size_t fused = 0;           // Son karede köprülenip birleşen harita parçası çifti
+    size_t candidates = 0;      // Son karede dizinden gelip sınanan aday
+};
+
+// Harita parçası (dünya çerçevesi). Doğru, tüm gözlemlerin inlier'larının birleşik
+// momentlerinden (ağırlık, ortalama, merkezi ikinci momentler) toplam en küçük karelerle
+// oturtulur; yeni gözlem momentleri toplayarak eklenir, noktalar saklanmaz.
+struct MapSegment {
+    Line line;                  // inlierCount: toplam gözlenen nokta (doygun), inlier aralığı yok
+    double weight = 0.0;
+    Point mean;
+    double sxx = 0.0, sxy = 0.0, syy = 0.0;
+    uint32_t observations = 0;  // Katkı veren kare parçası sayısı
+    bool alive = true;          // false: başka parçayla birleşti
+};
+
+// Pozlu tarama dizisinin kare kare bulduğu doğrulardan tek küresel duvar haritası.
+//
+// Harita parçaları düzgün ızgara dizininde tutulur: her parça geçtiği hücrelere kaydedilir
+// (hücre anahtarı açık adresli tabloda, hücre listeleri tek dizide bağlı liste). Yeni parça
+// yalnızca kendi hücrelerinin (maxGap + maxOffset genişletilmiş) adaylarıyla sınanır; kare
+// başına maliyet haritanın boyutuna değil, parçanın çevresindeki yoğunluğa bağlıdır.
+//
+// Eşleşen parça momentleri toplanarak yeniden oturtulur, uçlar eski uçlar ve yeni inlier'ların
+// yeni doğru üzerindeki izdüşümlerinin en dışlarıdır; yalnızca uzayan kısım dizine eklenir. Yeni
+// parça iki harita parçasını köprülerse onlar da birleşir. Birleşen parçaların dizin kayıtları
+// silinmez, sorguda atlanır.
+class LineMap {
+public:
+    explicit LineMap(LineMapParams params = {});
+
+    // segments ve inlier'ları (points içinde) sensör çerçevesinde; pose sensörün dünya pozu
+    template <typename T>
+    void integrate(const std::pmr::vector<PointT<T>>& points,
+                   const std::pmr::vector<LineT<T>>& segments,
+                   const SensorPose& pose);
+
+    // Yaşayan parça sayısı
+    size_t size() const { return m_alive; }
+    const std::vector<MapSegment>& segments() const { return m_segments; }
+
+    // Yaşayan parçaların doğruları, ekleme sırasıyla
+    std::pmr::vector<Line> lines(std::pmr::memory_resource* mr = std::pmr::get_default_resource()) const;
+
+    const LineMapParams& params() const { return m_params; }
+    const LineMapStats& stats() const { return m_stats; }
+
+private:
+    struct Entry {
+        uint32_t segment;
+        int32_t next;
+    };
+
+    bool collinear(const MapSegment& a, const MapSegment& b) const;
+    void absorb(MapSegment& into, const MapSegment& from);
+    void insertCells(uint32_t segment, const Point& a, const Point& b);
+    void collectCells(const Point& a, const Point& b, double margin);
+
+    LineMapParams m_params;
+    double m_maxSin;
+    std::vector<MapSegment> m_segments;
+    size_t m_alive = 0;
+
+    FlatHashMap<int32_t> m_heads;   // Hücre anahtarı -> hücre listesinin başı (m_entries)
+    std::vector<Entry> m_entries;
+
+    // Sorgu tamponları (yeniden kullanılır)
+    std::vector<uint64_t> m_cells;
+    std::vector<uint32_t> m_candidates;
+    std::vector<uint32_t> m_visited;    // Parça başına sorgu damgası
+    uint32_t m_query = 0;
+
+    LineMapStats m_stats;
+};
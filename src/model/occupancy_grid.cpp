@@ -0,0 +1,178 @@
+#include "occupancy_grid.hpp"
+#include <algorithm>
+#include <cmath>
+
+// Negatif koordinatlarda da aşağı yuvarlayan karo indeksi
+static int64_t tileOf(int64_t cell) {
+    return cell >= 0 ? cell >> OccupancyGrid::kTileBits : -((-cell - 1) >> OccupancyGrid::kTileBits) - 1;
+}
+
+OccupancyGrid::OccupancyGrid(OccupancyGridParams params)
+    : m_params(params),
+      m_invCell(1.0 / std::max(params.cellSize, 1e-6))
+{
+    // Sabit noktalı (16.16) DDA için bağıl koordinatlar 32 bit içinde kalmalı
+    const size_t wanted = std::clamp<size_t>(params.tiles, 1, 1024);
+    m_tiles = 1;
+    while (m_tiles < wanted) {
+        m_tiles <<= 1;
+        ++m_tileShift;
+    }
+    m_tileMask = static_cast<uint32_t>(m_tiles - 1);
+    m_params.tiles = m_tiles;
+
+    m_logOdds.assign(m_tiles * m_tiles * kTileCells, 0.0f);
+    m_stamp.assign(m_logOdds.size(), 0);
+}
+
+uint32_t OccupancyGrid::slotOf(int32_t x, int32_t y) const {
+    const uint32_t sx = (static_cast<uint32_t>(x >> kTileBits) + m_slotX) & m_tileMask;
+    const uint32_t sy = (static_cast<uint32_t>(y >> kTileBits) + m_slotY) & m_tileMask;
+    return (((sy << m_tileShift) | sx) << (2 * kTileBits)) |
+           (static_cast<uint32_t>(y & (kTileSize - 1)) << kTileBits) | static_cast<uint32_t>(x & (kTileSize - 1));
+}
+
+void OccupancyGrid::clearTile(int64_t tx, int64_t ty) {
+    const uint32_t sx = static_cast<uint32_t>(static_cast<uint64_t>(tx) & m_tileMask);
+    const uint32_t sy = static_cast<uint32_t>(static_cast<uint64_t>(ty) & m_tileMask);
+    auto first = m_logOdds.begin() + static_cast<std::ptrdiff_t>(((sy << m_tileShift) | sx) * kTileCells);
+    std::fill(first, first + kTileCells, 0.0f);
+}
+
+void OccupancyGrid::recenter(double x, double y) {
+    const auto half = static_cast<int64_t>(m_tiles / 2);
+    const int64_t tx = tileOf(static_cast<int64_t>(std::floor(x * m_invCell))) - half;
+    const int64_t ty = tileOf(static_cast<int64_t>(std::floor(y * m_invCell))) - half;
+
+    if (m_placed && (tx != m_originTx || ty != m_originTy)) {
+        // Yalnızca yeni pencereye giren karolar sıfırlanır; kalanlar yuvalarında durur
+        const auto tiles = static_cast<int64_t>(m_tiles);
+        for (int64_t ay = ty; ay < ty + tiles; ++ay) {
+            const bool rowWasIn = ay >= m_originTy && ay < m_originTy + tiles;
+            for (int64_t ax = tx; ax < tx + tiles; ++ax) {
+                if (rowWasIn && ax >= m_originTx && ax < m_originTx + tiles) continue;
+                clearTile(ax, ay);
+                ++m_stats.scrolledTiles;
+            }
+        }
+    }
+    m_placed = true;
+    m_originTx = tx;
+    m_originTy = ty;
+    m_slotX = static_cast<uint32_t>(static_cast<uint64_t>(tx) & m_tileMask);
+    m_slotY = static_cast<uint32_t>(static_cast<uint64_t>(ty) & m_tileMask);
+}
+
+template <typename T>
+void OccupancyGrid::integrate(const std::pmr::vector<PointT<T>>& points, const SensorPose& pose) {
+    recenter(pose.x, pose.y);
+    m_lastPose = pose;
+    if (++m_generation == 0) {
+        // Damga taştı: tek seferlik temizlik
+        std::fill(m_stamp.begin(), m_stamp.end(), 0u);
+        m_generation = 1;
+    }
+
+    const int64_t side = cellsPerSide();
+    const int64_t ox = originX(), oy = originY();
+    const int64_t sx = static_cast<int64_t>(std::floor(pose.x * m_invCell)) - ox;
+    const int64_t sy = static_cast<int64_t>(std::floor(pose.y * m_invCell)) - oy;
+    const double c = std::cos(pose.yaw), s = std::sin(pose.yaw);
+
+    // Başlangıç hücre merkezinde (16.16 sabit nokta)
+    constexpr int kFrac = 16;
+    const int64_t x0 = (sx << kFrac) + (int64_t{1} << (kFrac - 1));
+    const int64_t y0 = (sy << kFrac) + (int64_t{1} << (kFrac - 1));
+    const int64_t limit = (side << kFrac) - 1;
+
+    m_hits.clear();
+    m_misses.clear();
+    for (const PointT<T>& p : points) {
+        const double wx = pose.x + c * static_cast<double>(p.x) - s * static_cast<double>(p.y);
+        const double wy = pose.y + s * static_cast<double>(p.x) + c * static_cast<double>(p.y);
+        if (!std::isfinite(wx) || !std::isfinite(wy)) continue;
+        const int64_t ex = static_cast<int64_t>(std::floor(wx * m_invCell)) - ox;
+        const int64_t ey = static_cast<int64_t>(std::floor(wy * m_invCell)) - oy;
+
+        const int64_t dx = ex - sx, dy = ey - sy;
+        const int64_t n = std::max(std::abs(dx), std::abs(dy));
+        if (n > 0) {
+            const int64_t stepX = dx * (int64_t{1} << kFrac) / n;
+            const int64_t stepY = dy * (int64_t{1} << kFrac) / n;
+
+            // Uç hücre hariç; pencereden çıkan ışın son içerideki adımda kesilir
+            int64_t last = n - 1;
+            if (stepX > 0) last = std::min(last, (limit - x0) / stepX);
+            if (stepX < 0) last = std::min(last, x0 / -stepX);
+            if (stepY > 0) last = std::min(last, (limit - y0) / stepY);
+            if (stepY < 0) last = std::min(last, y0 / -stepY);
+
+            const size_t base = m_misses.size();
+            const auto count = static_cast<int32_t>(last + 1);
+            m_misses.resize(base + static_cast<size_t>(count));
+            uint32_t* out = m_misses.data() + base;
+
+            const auto fx = static_cast<int32_t>(x0), fy = static_cast<int32_t>(y0);
+            const auto kx = static_cast<int32_t>(stepX), ky = static_cast<int32_t>(stepY);
+            const uint32_t mask = m_tileMask, slotX = m_slotX, slotY = m_slotY;
+            const int shift = m_tileShift;
+            for (int32_t k = 0; k < count; ++k) {
+                const int32_t x = (fx + k * kx) >> kFrac;
+                const int32_t y = (fy + k * ky) >> kFrac;
+                const uint32_t tx = (static_cast<uint32_t>(x >> kTileBits) + slotX) & mask;
+                const uint32_t ty = (static_cast<uint32_t>(y >> kTileBits) + slotY) & mask;
+                out[k] = (((ty << shift) | tx) << (2 * kTileBits)) |
+                         (static_cast<uint32_t>(y & (kTileSize - 1)) << kTileBits) |
+                         static_cast<uint32_t>(x & (kTileSize - 1));
+            }
+        }
+        if (ex >= 0 && ex < side && ey >= 0 && ey < side) {
+            m_hits.push_back(slotOf(static_cast<int32_t>(ex), static_cast<int32_t>(ey)));
+        }
+    }
+
+    // Toplu uygulama: önce isabetler, böylece aynı taramada geçilen dolu hücre boş sayılmaz
+    const uint32_t gen = m_generation;
+    size_t hitCells = 0, missCells = 0;
+    for (uint32_t i : m_hits) {
+        if (m_stamp[i] == gen) continue;
+        m_stamp[i] = gen;
+        m_logOdds[i] = std::min(m_logOdds[i] + m_params.hitLogOdds, m_params.maxLogOdds);
+        ++hitCells;
+    }
+    for (uint32_t i : m_misses) {
+        if (m_stamp[i] == gen) continue;
+        m_stamp[i] = gen;
+        m_logOdds[i] = std::max(m_logOdds[i] + m_params.missLogOdds, m_params.minLogOdds);
+        ++missCells;
+    }
+
+    ++m_stats.scans;
+    m_stats.rays = points.size();
+    m_stats.hitCells = hitCells;
+    m_stats.missCells = missCells;
+}
+
+bool OccupancyGrid::contains(int64_t cx, int64_t cy) const {
+    const int64_t x = cx - originX(), y = cy - originY();
+    return m_placed && x >= 0 && y >= 0 && x < cellsPerSide() && y < cellsPerSide();
+}
+
+float OccupancyGrid::logOdds(int64_t cx, int64_t cy) const {
+    if (!contains(cx, cy)) return 0.0f;
+    return m_logOdds[slotOf(static_cast<int32_t>(cx - originX()), static_cast<int32_t>(cy - originY()))];
+}
+
+CellState OccupancyGrid::state(int64_t cx, int64_t cy) const {
+    const float l = logOdds(cx, cy);
+    if (l > m_params.occupiedAbove) return CellState::Occupied;
+    if (l < m_params.freeBelow) return CellState::Free;
+    return CellState::Unknown;
+}
+
+size_t OccupancyGrid::memoryBytes() const {
+    return m_logOdds.size() * sizeof(float) + m_stamp.size() * sizeof(uint32_t);
+}
+
+template void OccupancyGrid::integrate(const std::pmr::vector<PointT<float>>&, const SensorPose&);
+template void OccupancyGrid::integrate(const std::pmr::vector<PointT<double>>&, const SensorPose&);
@@ -0,0 +1,98 @@
+#pragma once
+#include "model/scene.hpp"
+#include "model/types.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct OccupancyGridParams {
+    double cellSize      = 0.05;   // m
+    size_t tiles         = 32;     // Pencerenin bir kenarındaki karo sayısı (2'nin kuvvetine yuvarlanır)
+    float  hitLogOdds    = 0.85f;  // Işının bittiği hücreye eklenen log-odds
+    float  missLogOdds   = -0.4f;  // Işının geçtiği hücrelere eklenen log-odds
+    float  minLogOdds    = -2.0f;
+    float  maxLogOdds    = 3.5f;
+    float  occupiedAbove = 0.5f;   // state(): bunun üstü dolu
+    float  freeBelow     = -0.5f;  // state(): bunun altı boş
+};
+
+enum class CellState : uint8_t { Unknown, Free, Occupied };
+
+struct OccupancyGridStats {
+    size_t scans = 0;
+    size_t rays = 0;            // Son tarama
+    size_t hitCells = 0;        // Son taramada güncellenen dolu hücre (tekil)
+    size_t missCells = 0;       // Son taramada güncellenen boş hücre (tekil)
+    size_t scrolledTiles = 0;   // Toplam: pencere kaydıkça sıfırlanan karolar
+};
+
+// Tarama dizileri için kalıcı 2D log-odds doluluk ızgarası. Her taramanın noktaları
+// (filterAndConvertToPoints çıktısı, sensör çerçevesi) sensör pozundan ışın olarak izlenir.
+//
+// Bellek sabittir: pencere tiles x tiles karodan oluşur, her karo 16 x 16 hücre ve bellekte
+// ardışıktır (1 KB log-odds). Karolar dünya karo koordinatının pencere boyuna kalanıyla halka
+// düzeninde yerleşir; robot hareket edince pencere karo adımıyla kayar, yalnızca pencereye yeni
+// giren karoların yuvaları sıfırlanır, geri kalan veri taşınmaz.
+//
+// Işınlar sabit noktalı DDA ile izlenir: k. adımın hücresi başlangıçtan bağımsız hesaplanır
+// (döngü taşıyan bağımlılık yok), pencereden çıkış adımı önceden kırpılır; iç döngü dalsızdır ve
+// derleyicice vektörleşir. Güncellemeler tarama başına toplanıp tek geçişte uygulanır: her hücre
+// taramada en fazla bir kez değişir, isabet geçişe baskındır (nesil damgası ile).
+class OccupancyGrid {
+public:
+    static constexpr int kTileBits = 4;
+    static constexpr int kTileSize = 1 << kTileBits;
+    static constexpr int kTileCells = kTileSize * kTileSize;
+
+    explicit OccupancyGrid(OccupancyGridParams params = {});
+
+    // Pencereyi (x, y) merkezde kalacak şekilde kaydırır; integrate her taramada çağırır
+    void recenter(double x, double y);
+
+    // points sensör çerçevesinde; pose sensörün dünya pozu
+    template <typename T>
+    void integrate(const std::pmr::vector<PointT<T>>& points, const SensorPose& pose);
+
+    // Dünya hücre koordinatları (floor(m / cellSize)); pencere dışı hücreler 0 / Unknown
+    bool contains(int64_t cx, int64_t cy) const;
+    float logOdds(int64_t cx, int64_t cy) const;
+    CellState state(int64_t cx, int64_t cy) const;
+
+    // Pencerenin sol alt hücresi ve kenar uzunluğu (hücre)
+    int64_t originX() const { return m_originTx * kTileSize; }
+    int64_t originY() const { return m_originTy * kTileSize; }
+    int cellsPerSide() const { return static_cast<int>(m_tiles) * kTileSize; }
+
+    const OccupancyGridParams& params() const { return m_params; }
+    const OccupancyGridStats& stats() const { return m_stats; }
+    const SensorPose& lastPose() const { return m_lastPose; }
+    // Izgara deposu (log-odds + damga); pencere boyuyla sabittir
+    size_t memoryBytes() const;
+
+private:
+    // Pencereye göre bağıl hücreden (0 <= x, y < cellsPerSide) depo indeksine
+    uint32_t slotOf(int32_t x, int32_t y) const;
+    void clearTile(int64_t tx, int64_t ty);
+
+    OccupancyGridParams m_params;
+    double m_invCell;
+    size_t m_tiles = 0;
+    uint32_t m_tileMask = 0;
+    int m_tileShift = 0;            // log2(m_tiles)
+    int64_t m_originTx = 0;
+    int64_t m_originTy = 0;
+    uint32_t m_slotX = 0;           // Pencerenin ilk karosunun halka yuvası
+    uint32_t m_slotY = 0;
+    bool m_placed = false;
+
+    std::vector<float> m_logOdds;   // Karo karo: [yuvaY][yuvaX][hücreY][hücreX]
+    std::vector<uint32_t> m_stamp;  // == m_generation: bu taramada güncellendi
+    uint32_t m_generation = 0;
+
+    // Tarama başına toplu güncelleme tamponları (yeniden kullanılır)
+    std::vector<uint32_t> m_hits;
+    std::vector<uint32_t> m_misses;
+
+    SensorPose m_lastPose;
+    OccupancyGridStats m_stats;
+};
@@ -0,0 +1,74 @@
+#include "outlier_filter.hpp"
+#include "model/lidar.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+template <typename T>
+ScanOutlierFilter<T>::ScanOutlierFilter(OutlierFilterParams params)
+    : m_params(params)
+{
+    m_params.halfWindow = std::clamp(m_params.halfWindow, 1, 16);
+}
+
+template <typename T>
+void ScanOutlierFilter<T>::apply(LidarScanT<T>& scan) {
+    m_stats = OutlierFilterStats{};
+    const size_t n = scan.ranges.size();
+    const size_t h = static_cast<size_t>(m_params.halfWindow);
+    if (n == 0) return;
+
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+    const T tol = static_cast<T>(m_params.rangeTolerance);
+    const T slope = static_cast<T>(m_params.grazingSlope) * std::abs(scan.angle_increment);
+
+    m_padded.assign(n + 2 * h, nan);
+    m_tolBase.resize(n);
+    m_tolStep.resize(n);
+    m_support.assign(n, 0);
+
+    // Geçerlilik convertBeam ile aynı kural
+    PointT<T> unused;
+    T* r = m_padded.data() + h;
+    for (size_t i = 0; i < n; ++i) {
+        if (convertBeam(scan, i, scan.ranges[i], unused)) {
+            r[i] = scan.ranges[i];
+            ++m_stats.validBeams;
+        }
+        m_tolBase[i] = tol;
+        m_tolStep[i] = slope * scan.ranges[i];
+    }
+
+    // Tam tur: son ışınların komşusu ilk ışınlardır
+    const T sweep = static_cast<T>(n) * std::abs(scan.angle_increment);
+    const T fullTurn = static_cast<T>(2.0 * 3.14159265358979323846);
+    if (n > 2 * h && sweep >= fullTurn - std::abs(scan.angle_increment) / 2) {
+        std::copy(r + n - h, r + n, m_padded.begin());
+        std::copy(r, r + h, r + n);
+    }
+
+    for (size_t k = 1; k <= h; ++k) {
+        const T kk = static_cast<T>(k);
+        const T* prev = r - k;
+        const T* next = r + k;
+        const T* base = m_tolBase.data();
+        const T* step = m_tolStep.data();
+        uint8_t* support = m_support.data();
+        for (size_t i = 0; i < n; ++i) {
+            const T t = base[i] + kk * step[i];
+            support[i] += static_cast<uint8_t>(std::abs(prev[i] - r[i]) <= t) +
+                          static_cast<uint8_t>(std::abs(next[i] - r[i]) <= t);
+        }
+    }
+
+    const auto minSupport = static_cast<uint8_t>(std::clamp(m_params.minSupport, 0, 2 * m_params.halfWindow));
+    for (size_t i = 0; i < n; ++i) {
+        if (!std::isnan(r[i]) && m_support[i] < minSupport) {
+            scan.ranges[i] = T(-1);
+            ++m_stats.removed;
+        }
+    }
+}
+
+template class ScanOutlierFilter<float>;
+template class ScanOutlierFilter<double>;
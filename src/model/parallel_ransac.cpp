@@ -0,0 +1,196 @@
+#include "parallel_ransac.hpp"
+#include "model/ransac.hpp"
+#include "model/segment_merge.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+template <typename T>
+std::pmr::vector<LineT<T>> findLinesParallel(
+    std::pmr::vector<PointT<T>>& points,
+    int minInliers,
+    double distanceThreshold,
+    int maxIterations,
+    const ParallelRansacParams& params,
+    std::pmr::memory_resource* mr,
+    uint32_t seed,
+    ParallelRansacStats* stats)
+{
+    if (params.sectors <= 1) {
+        auto lines = findLinesRANSAC(points, minInliers, distanceThreshold, maxIterations, mr, seed);
+        if (stats) {
+            *stats = ParallelRansacStats{1, 1, lines.size(), 0, 0, 0};
+        }
+        return lines;
+    }
+
+    const size_t sectors = params.sectors;
+    const double width = 2.0 * M_PI / static_cast<double>(sectors);
+    const double overlap = std::clamp(params.overlapDeg * M_PI / 180.0, 0.0, width / 2);
+
+    // Açı [0, 2pi); ev sektörü yalnızca koordinatlardan hesaplanır, RANSAC sonrası da aynı sonucu verir
+    auto angleOf = [](const PointT<T>& p) {
+        double a = std::atan2(static_cast<double>(p.y), static_cast<double>(p.x));
+        return a < 0 ? a + 2.0 * M_PI : a;
+    };
+    auto homeOf = [width, sectors](double a) {
+        return std::min(static_cast<size_t>(a / width), sectors - 1);
+    };
+
+    std::vector<std::pmr::vector<PointT<T>>> buffers(sectors);
+    for (const PointT<T>& p : points) {
+        const double a = angleOf(p);
+        const size_t s = homeOf(a);
+        buffers[s].push_back(p);
+        const double f = a - static_cast<double>(s) * width;
+        if (f < overlap) buffers[(s + sectors - 1) % sectors].push_back(p);
+        if (width - f < overlap) buffers[(s + 1) % sectors].push_back(p);
+    }
+
+    unsigned threads = params.threads > 0 ? params.threads : std::thread::hardware_concurrency();
+    threads = static_cast<unsigned>(std::clamp<size_t>(threads, 1, sectors));
+
+    std::vector<std::pmr::vector<LineT<T>>> found(sectors);
+    std::atomic<size_t> next{0};
+    auto worker = [&] {
+        for (size_t s = next.fetch_add(1); s < sectors; s = next.fetch_add(1)) {
+            found[s] = findLinesRANSAC(buffers[s], minInliers, distanceThreshold, maxIterations,
+                                       std::pmr::get_default_resource(), seed == 0 ? 0 : seed + static_cast<uint32_t>(s));
+        }
+    };
+    if (threads == 1) {
+        worker();
+    } else {
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        for (unsigned t = 1; t < threads; ++t) pool.emplace_back(worker);
+        worker();
+        for (auto& t : pool) t.join();
+    }
+
+    // Doğrular yalnızca ev noktalarıyla; komşu bant kopyaları atılır (ev sektöründe yer alırlar)
+    std::pmr::vector<PointT<T>> out(mr);
+    out.reserve(points.size());
+    std::pmr::vector<PointT<T>> rest(mr);
+    std::pmr::vector<LineT<T>> lines(mr);
+    std::pmr::vector<size_t> region(mr);
+    for (size_t s = 0; s < sectors; ++s) {
+        std::pmr::vector<PointT<T>>& buf = buffers[s];
+        auto isHome = [&](const PointT<T>& p) { return homeOf(angleOf(p)) == s; };
+        size_t assigned = 0;
+        for (LineT<T> line : found[s]) {
+            auto first = buf.begin() + line.inlierOffset;
+            auto last = first + line.inlierCount;
+            assigned = std::max<size_t>(assigned, line.inlierOffset + line.inlierCount);
+            auto homeEnd = std::stable_partition(first, last, isHome);
+            if (homeEnd == first) continue;
+
+            // Uçlar ev inlier'larının doğru üzerindeki en dış izdüşümlerinden (findLinesRANSAC
+            // gibi 5 * eps kısaltılmış); aday doğrunun uçları komşu banda taşabilir ya da kısa kalabilir
+            const T norm = std::sqrt(line.A * line.A + line.B * line.B);
+            const T dx = line.B / norm, dy = -line.A / norm;
+            T tMin = std::numeric_limits<T>::max(), tMax = std::numeric_limits<T>::lowest();
+            for (auto it = first; it != homeEnd; ++it) {
+                const T t = it->x * dx + it->y * dy;
+                tMin = std::min(tMin, t);
+                tMax = std::max(tMax, t);
+            }
+            const T shrink = std::min(static_cast<T>(5 * distanceThreshold), (tMax - tMin) / T(2));
+            tMin += shrink;
+            tMax -= shrink;
+            const T off = -line.C / norm;
+            const PointT<T> base{line.A / norm * off, line.B / norm * off};
+            line.startPoint = {base.x + tMin * dx, base.y + tMin * dy};
+            line.endPoint = {base.x + tMax * dx, base.y + tMax * dy};
+
+            line.inlierOffset = static_cast<uint32_t>(out.size());
+            line.inlierCount = static_cast<uint32_t>(homeEnd - first);
+            out.insert(out.end(), first, homeEnd);
+            lines.push_back(line);
+            region.push_back(s);
+        }
+        for (size_t i = assigned; i < buf.size(); ++i) {
+            if (isHome(buf[i])) rest.push_back(buf[i]);
+        }
+    }
+    out.insert(out.end(), rest.begin(), rest.end());
+
+    const size_t raw = lines.size();
+    const size_t last = sectors - 1;
+    const size_t merged = mergeCollinearSegments(
+        out, lines, region,
+        [last](size_t a, size_t b) { return b == a + 1 || (a == 0 && b == last); },
+        distanceThreshold, params.mergeAngleDeg, mr);
+
+    // Ev noktaları birleşmeyle de minInliers'a ulaşmayan doğrular (yalnızca komşu bant
+    // sayesinde bulunanlar) atılır; noktaları atanmamışlara döner
+    const auto minCount = static_cast<uint32_t>(std::max(minInliers, 0));
+    size_t dropped = 0;
+    for (const LineT<T>& l : lines) dropped += l.inlierCount < minCount ? 1 : 0;
+    if (dropped > 0) {
+        std::pmr::vector<PointT<T>> kept(mr);
+        kept.reserve(out.size());
+        std::pmr::vector<LineT<T>> keptLines(mr);
+        size_t assignedEnd = 0;
+        for (LineT<T> l : lines) {
+            assignedEnd = std::max<size_t>(assignedEnd, l.inlierOffset + l.inlierCount);
+            if (l.inlierCount < minCount) continue;
+            auto first = out.begin() + l.inlierOffset;
+            l.inlierOffset = static_cast<uint32_t>(kept.size());
+            kept.insert(kept.end(), first, first + l.inlierCount);
+            keptLines.push_back(l);
+        }
+        for (const LineT<T>& l : lines) {
+            if (l.inlierCount >= minCount) continue;
+            auto first = out.begin() + l.inlierOffset;
+            kept.insert(kept.end(), first, first + l.inlierCount);
+        }
+        kept.insert(kept.end(), out.begin() + static_cast<std::ptrdiff_t>(assignedEnd), out.end());
+        out = std::move(kept);
+        lines = std::move(keptLines);
+    }
+
+    // Son geçiş: atanmamış noktalar tam taramadaki gibi tek RANSAC'tan geçer. Kalan küme
+    // küçüktür (çoğu nokta sektör doğrularındadır). Bulunan doğrular bir sektör doğrusunun
+    // devamı olabilir (sınırda ev noktaları minInliers'a yetmeyip atılan parça); aynı
+    // birleştirme ve yeniden oturtmadan geçerler: bölge 0 sektör doğruları, 1 son geçiş.
+    size_t assignedEnd = 0;
+    for (const LineT<T>& l : lines) assignedEnd = std::max<size_t>(assignedEnd, l.inlierOffset + l.inlierCount);
+    std::pmr::vector<PointT<T>> leftover(out.begin() + static_cast<std::ptrdiff_t>(assignedEnd), out.end(),
+                                         std::pmr::get_default_resource());
+    const std::pmr::vector<LineT<T>> extra =
+        findLinesRANSAC(leftover, minInliers, distanceThreshold, maxIterations, std::pmr::get_default_resource(),
+                        seed == 0 ? 0 : seed + static_cast<uint32_t>(sectors));
+    size_t mergedExtra = 0;
+    if (!extra.empty()) {
+        std::copy(leftover.begin(), leftover.end(), out.begin() + static_cast<std::ptrdiff_t>(assignedEnd));
+        std::pmr::vector<size_t> pass(lines.size(), 0, mr);
+        pass.resize(lines.size() + extra.size(), 1);
+        for (LineT<T> l : extra) {
+            l.inlierOffset += static_cast<uint32_t>(assignedEnd);
+            lines.push_back(l);
+        }
+        mergedExtra = mergeCollinearSegments(
+            out, lines, pass, [](size_t, size_t) { return true; }, distanceThreshold, params.mergeAngleDeg, mr);
+    }
+
+    points = std::move(out);
+    if (stats) {
+        *stats = ParallelRansacStats{sectors, threads, raw, merged + mergedExtra, dropped, extra.size()};
+    }
+    return lines;
+}
+
+template std::pmr::vector<LineT<float>> findLinesParallel(std::pmr::vector<PointT<float>>&, int, double, int,
+                                                          const ParallelRansacParams&, std::pmr::memory_resource*,
+                                                          uint32_t, ParallelRansacStats*);
+template std::pmr::vector<LineT<double>> findLinesParallel(std::pmr::vector<PointT<double>>&, int, double, int,
+                                                           const ParallelRansacParams&, std::pmr::memory_resource*,
+                                                           uint32_t, ParallelRansacStats*);
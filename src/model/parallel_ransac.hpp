@@ -0,0 +1,49 @@
+#pragma once
+#include "model/types.hpp"
+#include <cstddef>
+#include <cstdint>
+
+struct ParallelRansacParams {
+    size_t   sectors       = 8;    // Tam tur eşit açılı sektör sayısı
+    double   overlapDeg    = 3.0;  // Sektöre her iki yandan eklenen komşu bant (en fazla yarım sektör)
+    unsigned threads       = 0;    // 0: donanım iş parçacığı sayısı
+    double   mergeAngleDeg = 5.0;  // Sektörler arası birleştirmede en büyük açı farkı
+};
+
+struct ParallelRansacStats {
+    size_t   sectors = 0;
+    unsigned threads = 0;
+    size_t   rawSegments = 0;   // Sektör içi parçalar (yalnızca komşu bantta kalanlar hariç)
+    size_t   merged = 0;        // Birleştirmeyle azalan parça sayısı (sektör sınırı ve son geçiş)
+    size_t   dropped = 0;       // Ev noktaları minInliers'a yetmeyen parçalar
+    size_t   recovered = 0;     // Kalan noktalar üzerindeki son tam tarama geçişinin bulduğu
+                                // (birleştirmeden önce; sonuç = raw + recovered - merged - dropped)
+};
+
+// findLinesRANSAC'ın çok çekirdekli karşılığı. Nokta bulutu orijine göre açısal sektörlere
+// bölünür; her sektör kendi noktaları ve komşu sektörlerin sınıra overlapDeg yakın
+// noktalarıyla bağımsız olarak RANSAC'tan geçer (sektör k için tohum seed + k). Sınırı
+// kesen duvar her iki sektörde de yeterli inlier bulur; kopyalar ve sınırda bölünen
+// parçalar mergeCollinearSegments ile birleştirilip yeniden oturtulur. Hiçbir sektöre
+// sığmayan (inlier'ları birkaç sektöre seyrek dağılan) duvarlar için, sektörlerin atayamadığı
+// noktalar son olarak tek iş parçacığında findLinesRANSAC'tan geçirilir (tohum seed + sectors);
+// bulunan doğrular sektör doğrularıyla aynı birleştirmeden geçer.
+//
+// Her nokta kutupsal açısıyla tek bir "ev" sektörüne aittir; bir doğru yalnızca ev
+// noktalarını inlier olarak tutar, bu yüzden birleştirme sonrası hiçbir nokta iki doğruya
+// ait olmaz. Dönüşte points findLinesRANSAC ile aynı düzendedir (inlier aralıkları, sonra
+// atanmamışlar). Sektör işleri iş parçacıkları arasında dinamik dağıtılır; sektör
+// tamponları varsayılan kaynaktan, sonuçlar mr'den ayrılır.
+//
+// sectors <= 1 ise sonuç aynı tohumla findLinesRANSAC'ın kendisidir (stats.sectors = 1).
+template <typename T>
+std::pmr::vector<LineT<T>> findLinesParallel(
+    std::pmr::vector<PointT<T>>& points,
+    int minInliers,
+    double distanceThreshold,
+    int maxIterations,
+    const ParallelRansacParams& params,
+    std::pmr::memory_resource* mr = std::pmr::get_default_resource(),
+    uint32_t seed = 0,
+    ParallelRansacStats* stats = nullptr
+);
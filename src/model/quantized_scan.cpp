@@ -0,0 +1,56 @@
+#include "quantized_scan.hpp"
+#include <algorithm>
+#include <cmath>
+
+double quantizationScale(double rangeMax) {
+    if (!(rangeMax > 0.0) || !std::isfinite(rangeMax)) {
+        return 1e-3; // Bozuk başlık: mm çözünürlük
+    }
+    return rangeMax / static_cast<double>(RangeCode::MaxValue);
+}
+
+// Geçerli range -> kod; çözülmüş değer [rangeMin, rangeMax] dışına taşmayacak şekilde
+// bir kod kaydırılır (yuvarlama sınırdaki ışını düşürmesin)
+static uint16_t encodeValid(double r, double scale, double rangeMin, double rangeMax) {
+    double c = std::round(r / scale);
+    c = std::min(std::max(c, 0.0), static_cast<double>(RangeCode::MaxValue));
+    auto code = static_cast<uint16_t>(c);
+
+    while (code > 0 && static_cast<double>(code) * scale > rangeMax) --code;
+    while (code < RangeCode::MaxValue && static_cast<double>(code) * scale < rangeMin) ++code;
+    return code;
+}
+
+QuantizedScan quantizeScan(const LidarScan& scan, std::pmr::memory_resource* mr) {
+    QuantizedScan q{scan.angle_min, scan.angle_max, scan.angle_increment,
+                    scan.range_min, scan.range_max, quantizationScale(scan.range_max),
+                    std::pmr::vector<uint16_t>(mr)};
+    q.codes.reserve(scan.ranges.size());
+
+    for (double r : scan.ranges) {
+        uint16_t code;
+        if (r == -1.0) {
+            code = RangeCode::Dropout;
+        } else if (r == 999.0) {
+            code = RangeCode::NoReturn;
+        } else if (r == -999.0) {
+            code = RangeCode::Error;
+        } else if (!(r >= scan.range_min && r <= scan.range_max)) {
+            code = RangeCode::OutOfRange;
+        } else {
+            code = encodeValid(r, q.scale, scan.range_min, scan.range_max);
+        }
+        q.codes.push_back(code);
+    }
+    return q;
+}
+
+LidarScan dequantizeScan(const QuantizedScan& scan, std::pmr::memory_resource* mr) {
+    LidarScan out{scan.angle_min, scan.angle_max, scan.angle_increment,
+                  scan.range_min, scan.range_max, std::pmr::vector<double>(mr)};
+    out.ranges.reserve(scan.codes.size());
+    for (uint16_t c : scan.codes) {
+        out.ranges.push_back(decodeRange(c, scan.scale));
+    }
+    return out;
+}
@@ -1,90 +1,74 @@
 #include "ransac.hpp"
+#include "model/geometry.hpp"
 #include <iostream>
 #include <cmath>
 #include <random>
 #include <limits>
 #include <chrono>
 #include <numeric>
+#include <algorithm>
 
 // RANSAC YARDIMCI FONKSİYONLARI
-static Line lineFromPoints(const Point& p1, const Point& p2) {
-    Line line;
+template <typename T>
+static LineT<T> lineFromPoints(const PointT<T>& p1, const PointT<T>& p2) {
+    LineT<T> line;
     line.A = p2.y - p1.y;
     line.B = p1.x - p2.x;
     line.C = -line.A * p1.x - line.B * p1.y;
     return line;
 }
 
-static double distanceToLine(const Line& line, const Point& p) {
+template <typename T>
+static T distanceToLine(const LineT<T>& line, const PointT<T>& p) {
     return std::abs(line.A * p.x + line.B * p.y + line.C) / std::sqrt(line.A * line.A + line.B * line.B);
 }
 
-static double distanceSq(const Point& p1, const Point& p2) {
+template <typename T>
+static T distanceSq(const PointT<T>& p1, const PointT<T>& p2) {
     return (p1.x - p2.x) * (p1.x - p2.x) + (p1.y - p2.y) * (p1.y - p2.y);
 }
 
-static Line refineLineWithLeastSquares(const std::vector<Point>& inliers) {
+template <typename T>
+static LineT<T> refineLineWithLeastSquares(const std::pmr::vector<PointT<T>>& inliers) {
     if (inliers.size() < 2) {
-        return Line{};
+        return LineT<T>{};
     }
 
-    double sumX = 0.0;
-    double sumY = 0.0;
+    T sumX = 0;
+    T sumY = 0;
     for (const auto& p : inliers) {
         sumX += p.x;
         sumY += p.y;
     }
-    const double meanX = sumX / inliers.size();
-    const double meanY = sumY / inliers.size();
+    const T meanX = sumX / static_cast<T>(inliers.size());
+    const T meanY = sumY / static_cast<T>(inliers.size());
 
-    double Sxx = 0.0;
-    double Sxy = 0.0;
-    double Syy = 0.0;
+    T Sxx = 0;
+    T Sxy = 0;
+    T Syy = 0;
     for (const auto& p : inliers) {
-        double dx = p.x - meanX;
-        double dy = p.y - meanY;
+        T dx = p.x - meanX;
+        T dy = p.y - meanY;
         Sxx += dx * dx;
         Sxy += dx * dy;
         Syy += dy * dy;
     }
 
-    double T = Sxx + Syy;
-    double D = Sxx * Syy - Sxy * Sxy;
-    double lambda_small = T / 2.0 - std::sqrt(T * T / 4.0 - D);
-
-    double A = Sxy;
-    double B = lambda_small - Sxx;
-
-    double mag = std::sqrt(A * A + B * B);
-    if (mag < 1e-9) {
-        A = lambda_small - Syy;
-        B = Sxy;
-        mag = std::sqrt(A * A + B * B);
-
-        if (mag < 1e-9) {
-            return lineFromPoints(inliers.front(), inliers.back());
-        }
+    LineT<T> refinedLine;
+    if (!fitLineFromMoments(meanX, meanY, Sxx, Sxy, Syy, refinedLine)) {
+        return lineFromPoints(inliers.front(), inliers.back());
     }
-
-    A /= mag;
-    B /= mag;
-
-    double C = -A * meanX - B * meanY;
-
-    Line refinedLine;
-    refinedLine.A = A;
-    refinedLine.B = B;
-    refinedLine.C = C;
     return refinedLine;
 }
 
-static std::pair<Point, Point> findFarthestPoints(const std::vector<Point>& points) {
-    double maxDistSq = -1.0;
-    Point p1, p2;
+template <typename T>
+static std::pair<PointT<T>, PointT<T>> findFarthestPoints(const std::pmr::vector<PointT<T>>& points) {
+    T maxDistSq = -1;
+    PointT<T> p1, p2;
 
     for (size_t i = 0; i < points.size(); ++i) {
         for (size_t j = i + 1; j < points.size(); ++j) {
-            double dist = distanceSq(points[i], points[j]);
+            T dist = distanceSq(points[i], points[j]);
             if (dist > maxDistSq) {
                 maxDistSq = dist;
                 p1 = points[i];
@@ -95,87 +79,114 @@ static std::pair<Point, Point> findFarthestPoints(const std::vector<Point>& poin
     return {p1, p2};
 }
 
-static std::pair<Point, Point> shrinkSegment(Point p1, Point p2, double shrinkAmount) {
-    double dx = p2.x - p1.x;
-    double dy = p2.y - p1.y;
-    double mag = std::sqrt(dx * dx + dy * dy);
+template <typename T>
+static std::pair<PointT<T>, PointT<T>> shrinkSegment(PointT<T> p1, PointT<T> p2, T shrinkAmount) {
+    T dx = p2.x - p1.x;
+    T dy = p2.y - p1.y;
+    T mag = std::sqrt(dx * dx + dy * dy);
     if (mag < 2 * shrinkAmount) {
 
-        Point mid = {(p1.x + p2.x) / 2.0, (p1.y + p2.y) / 2.0};
+        PointT<T> mid = {(p1.x + p2.x) / T(2), (p1.y + p2.y) / T(2)};
         return {mid, mid};
     }
 
-    double norm_dx = dx / mag;
-    double norm_dy = dy / mag;
+    T norm_dx = dx / mag;
+    T norm_dy = dy / mag;
 
-    Point new_p1 = {p1.x + norm_dx * shrinkAmount, p1.y + norm_dy * shrinkAmount};
-    Point new_p2 = {p2.x - norm_dx * shrinkAmount, p2.y - norm_dy * shrinkAmount};
+    PointT<T> new_p1 = {p1.x + norm_dx * shrinkAmount, p1.y + norm_dy * shrinkAmount};
+    PointT<T> new_p2 = {p2.x - norm_dx * shrinkAmount, p2.y - norm_dy * shrinkAmount};
 
     return {new_p1, new_p2};
 }
 
 
 // ANA RANSAC FONKSİYONU
-std::vector<Line> findLinesRANSAC(
-    const std::vector<Point>& allPoints,
+template <typename T>
+std::pmr::vector<LineT<T>> findLinesRANSAC(
+    std::pmr::vector<PointT<T>>& points,
     int minInliers,
     double distanceThreshold,
-    int maxIterations)
+    int maxIterations,
+    std::pmr::memory_resource* mr,
+    uint32_t seed)
 {
-    std::vector<Line> foundLines;
-    std::vector<Point> remainingPoints = allPoints;
+    std::pmr::vector<LineT<T>> foundLines(mr);
+
+    // Kalan noktalar tamponun sonundaki [consumed, n) aralığı; öndeki kısım doğrulara atanmış
+    size_t consumed = 0;
+    auto remainingSize = [&] { return points.size() - consumed; };
+
+    // Aday doğrunun inlier'ları (yeniden kullanılır: döngüde yeni ayırma yapılmaz)
+    std::pmr::vector<PointT<T>> inliers(mr);
+    inliers.reserve(points.size());
 
-    auto seed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    const T threshold = static_cast<T>(distanceThreshold);
+
+    if (seed == 0) {
+        seed = static_cast<uint32_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    }
     std::mt19937 rng(seed);
 
     int iters = 0;
-    while (iters < maxIterations && remainingPoints.size() > minInliers) {
+    while (iters < maxIterations && remainingSize() > static_cast<size_t>(std::max(minInliers, 0))) {
         iters++;
 
-        std::uniform_int_distribution<int> dist(0, remainingPoints.size() - 1);
+        std::uniform_int_distribution<int> dist(0, static_cast<int>(remainingSize()) - 1);
         int idx1 = dist(rng);
         int idx2 = dist(rng);
         if (idx1 == idx2) continue;
 
-        Point p1 = remainingPoints[idx1];
-        Point p2 = remainingPoints[idx2];
+        PointT<T> p1 = points[consumed + idx1];
+        PointT<T> p2 = points[consumed + idx2];
 
-        Line candidateLine = lineFromPoints(p1, p2);
-        std::vector<Point> inliers;
+        LineT<T> candidateLine = lineFromPoints(p1, p2);
+        inliers.clear();
 
-        for (const auto& p : remainingPoints) {
-            double dist = distanceToLine(candidateLine, p);
-            if (dist < distanceThreshold) {
-                inliers.push_back(p);
+        for (size_t i = consumed; i < points.size(); ++i) {
+            T dist = distanceToLine(candidateLine, points[i]);
+            if (dist < threshold) {
+                inliers.push_back(points[i]);
             }
         }
 
         if (inliers.size() >= minInliers) {
 
-            Line refinedLine = refineLineWithLeastSquares(inliers);
+            LineT<T> refinedLine = refineLineWithLeastSquares(inliers);
 
             auto [farthest_p1, farthest_p2] = findFarthestPoints(inliers);
 
-            double shrinkAmount = distanceThreshold * 5.0; // örn: 0.1m
+            T shrinkAmount = threshold * T(5); // örn: 0.1m
             auto [final_p1, final_p2] = shrinkSegment(farthest_p1, farthest_p2, shrinkAmount);
 
-            refinedLine.inlierPoints = inliers;
-            refinedLine.startPoint = final_p1;
-            refinedLine.endPoint = final_p2;
-
-            foundLines.push_back(refinedLine);
-
-            std::vector<Point> nextRemainingPoints;
-
-            for (const auto& p : remainingPoints) {
-                if (distanceToLine(refinedLine, p) >= distanceThreshold) {
-                    nextRemainingPoints.push_back(p);
+            // İyileştirilmiş doğruya yakın noktalar kalan aralığın başına toplanır.
+            // Sondan başa gezilip kalanlar sona yazıldığından kalanların sırası korunur
+            // (örnekleme indeksleri kopyalı sürümle aynı kalır).
+            size_t write = points.size();
+            for (size_t i = points.size(); i-- > consumed;) {
+                if (distanceToLine(refinedLine, points[i]) >= threshold) {
+                    std::swap(points[i], points[--write]);
                 }
             }
-            remainingPoints = std::move(nextRemainingPoints);
+
+            LineT<T> line;
+            line.A = refinedLine.A;
+            line.B = refinedLine.B;
+            line.C = refinedLine.C;
+            line.inlierOffset = static_cast<uint32_t>(consumed);
+            line.inlierCount = static_cast<uint32_t>(write - consumed);
+            line.startPoint = final_p1;
+            line.endPoint = final_p2;
+            foundLines.push_back(line);
+
+            consumed = write;
         }
     }
 
 
     return foundLines;
-}
\ No newline at end of file
+}
+
+template std::pmr::vector<LineT<float>> findLinesRANSAC(
+    std::pmr::vector<PointT<float>>&, int, double, int, std::pmr::memory_resource*, uint32_t);
+template std::pmr::vector<LineT<double>> findLinesRANSAC(
+    std::pmr::vector<PointT<double>>&, int, double, int, std::pmr::memory_resource*, uint32_t);
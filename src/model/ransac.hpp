@@ -1,10 +1,18 @@
 #pragma once
 #include "model/types.hpp"
+#include <cstdint>
 #include <vector>
 
-std::vector<Line> findLinesRANSAC(
-    const std::vector<Point>& allPoints,
+// points yerinde yeniden sıralanır: her doğrunun inlier'ları ardışık bir aralığa toplanır
+// (LineT::inliers(points)), hiçbir doğruya atanmayan noktalar sonda kalır. Nokta kopyası yapılmaz;
+// sonuç ve aday inlier tamponu mr'den ayrılır.
+// seed == 0 ise saat tabanlı tohum kullanılır; sabit tohum tekrarlanabilir sonuç verir.
+template <typename T>
+std::pmr::vector<LineT<T>> findLinesRANSAC(
+    std::pmr::vector<PointT<T>>& points,
     int minInliers,
     double distanceThreshold,
-    int maxIterations
-);
\ No newline at end of file
+    int maxIterations,
+    std::pmr::memory_resource* mr = std::pmr::get_default_resource(),
+    uint32_t seed = 0
+);
@@ -0,0 +1,168 @@
+#include "scan_binary.hpp"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+static constexpr char kMagic[4] = {'L', 'S', 'C', 'N'};
+static constexpr uint32_t kVersion = 1;
+static constexpr uint32_t kQuantizedVersion = 2;
+
+// YARDIMCI FONKSİYONLAR
+template <typename T>
+static void writeRaw(std::ofstream& f, const T& v) {
+    f.write(reinterpret_cast<const char*>(&v), sizeof(T));
+}
+
+template <typename T>
+static bool readRaw(std::ifstream& f, T& v) {
+    return static_cast<bool>(f.read(reinterpret_cast<char*>(&v), sizeof(T)));
+}
+
+static bool openForWrite(const std::string& path, std::ofstream& f) {
+    f.open(path, std::ios::binary);
+    if (!f.is_open()) {
+        std::cerr << "Hata: ikili tarama dosyasi yazilamadi: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// İmza, sürüm ve ortak başlık alanları (sürüm 2'de scale dahil); değerler henüz okunmaz
+struct BinaryHeader {
+    uint32_t version = 0;
+    QuantizedScan fields;
+    uint64_t count = 0;
+};
+
+static bool readHeader(std::ifstream& f, const std::string& path, BinaryHeader& h) {
+    char magic[4];
+    if (!f.read(magic, sizeof(magic)) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+        !readRaw(f, h.version) || (h.version != kVersion && h.version != kQuantizedVersion)) {
+        std::cerr << "Hata: gecersiz ikili tarama dosyasi: " << path << std::endl;
+        return false;
+    }
+
+    QuantizedScan& s = h.fields;
+    if (!readRaw(f, s.angle_min) || !readRaw(f, s.angle_max) ||
+        !readRaw(f, s.angle_increment) || !readRaw(f, s.range_min) ||
+        !readRaw(f, s.range_max) ||
+        (h.version == kQuantizedVersion && !readRaw(f, s.scale)) ||
+        !readRaw(f, h.count)) {
+        std::cerr << "Hata: ikili tarama basligi eksik: " << path << std::endl;
+        return false;
+    }
+
+    // Bozuk başlık ile dev bellek ayırmayı önle
+    if (h.count > (uint64_t{1} << 32)) {
+        std::cerr << "Hata: gecersiz isin sayisi: " << h.count << std::endl;
+        return false;
+    }
+    return true;
+}
+
+template <typename V>
+static bool readValues(std::ifstream& f, const std::string& path, V& values, uint64_t count) {
+    values.resize(count);
+    if (!f.read(reinterpret_cast<char*>(values.data()),
+                static_cast<std::streamsize>(count * sizeof(typename V::value_type)))) {
+        std::cerr << "Hata: ikili tarama verisi eksik: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool saveScanBinary(const std::string& path, const LidarScan& scan) {
+    std::ofstream f;
+    if (!openForWrite(path, f)) return false;
+
+    f.write(kMagic, sizeof(kMagic));
+    writeRaw(f, kVersion);
+    writeRaw(f, scan.angle_min);
+    writeRaw(f, scan.angle_max);
+    writeRaw(f, scan.angle_increment);
+    writeRaw(f, scan.range_min);
+    writeRaw(f, scan.range_max);
+    writeRaw(f, static_cast<uint64_t>(scan.ranges.size()));
+    f.write(reinterpret_cast<const char*>(scan.ranges.data()),
+            static_cast<std::streamsize>(scan.ranges.size() * sizeof(double)));
+
+    return static_cast<bool>(f);
+}
+
+bool saveScanBinary(const std::string& path, const QuantizedScan& scan) {
+    std::ofstream f;
+    if (!openForWrite(path, f)) return false;
+
+    f.write(kMagic, sizeof(kMagic));
+    writeRaw(f, kQuantizedVersion);
+    writeRaw(f, scan.angle_min);
+    writeRaw(f, scan.angle_max);
+    writeRaw(f, scan.angle_increment);
+    writeRaw(f, scan.range_min);
+    writeRaw(f, scan.range_max);
+    writeRaw(f, scan.scale);
+    writeRaw(f, static_cast<uint64_t>(scan.codes.size()));
+    f.write(reinterpret_cast<const char*>(scan.codes.data()),
+            static_cast<std::streamsize>(scan.codes.size() * sizeof(uint16_t)));
+
+    return static_cast<bool>(f);
+}
+
+std::optional<LidarScan> loadScanBinary(const std::string& path, std::pmr::memory_resource* mr) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f.is_open()) {
+        std::cerr << "Hata: ikili tarama dosyasi acilamadi: " << path << std::endl;
+        return std::nullopt;
+    }
+
+    BinaryHeader h;
+    if (!readHeader(f, path, h)) {
+        return std::nullopt;
+    }
+
+    if (h.version == kQuantizedVersion) {
+        if (!readValues(f, path, h.fields.codes, h.count)) return std::nullopt;
+        return dequantizeScan(h.fields, mr);
+    }
+
+    const QuantizedScan& s = h.fields;
+    LidarScan scan{s.angle_min, s.angle_max, s.angle_increment, s.range_min, s.range_max,
+                   std::pmr::vector<double>(mr)};
+    if (!readValues(f, path, scan.ranges, h.count)) {
+        return std::nullopt;
+    }
+    return scan;
+}
+
+std::optional<QuantizedScan> loadQuantizedScanBinary(const std::string& path, std::pmr::memory_resource* mr) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f.is_open()) {
+        std::cerr << "Hata: ikili tarama dosyasi acilamadi: " << path << std::endl;
+        return std::nullopt;
+    }
+
+    BinaryHeader h;
+    if (!readHeader(f, path, h)) {
+        return std::nullopt;
+    }
+    if (h.version != kQuantizedVersion) {
+        std::cerr << "Hata: sikistirilmis (surum 2) tarama bekleniyordu: " << path << std::endl;
+        return std::nullopt;
+    }
+
+    // Ayırıcı atamayla devredilmez: vektör mr ile doğrudan kurulur
+    const QuantizedScan& s = h.fields;
+    QuantizedScan scan{s.angle_min, s.angle_max, s.angle_increment, s.range_min, s.range_max,
+                       s.scale, std::pmr::vector<uint16_t>(mr)};
+    if (!readValues(f, path, scan.codes, h.count)) {
+        return std::nullopt;
+    }
+    return scan;
+}
+
+bool isBinaryScanFile(const std::string& path) {
+    std::ifstream f(path, std::ios::binary);
+    char magic[4];
+    return f.read(magic, sizeof(magic)) && std::memcmp(magic, kMagic, sizeof(kMagic)) == 0;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "model/quantized_scan.hpp"
+#include "model/types.hpp"
+#include <optional>
+#include <string>
+
+// İkili tarama dosyası (büyük sentetik taramalar için, TOML'a göre ~3x küçük ve parse gerektirmez)
+//   char[4]  "LSCN"
+//   uint32   sürüm (1)
+//   double   angle_min, angle_max, angle_increment, range_min, range_max
+//   uint64   ışın sayısı
+//   double   ranges[ışın sayısı]
+// Sürüm 2 (sıkıştırılmış, bkz. quantized_scan.hpp): range_max'tan sonra double scale gelir,
+// ranges yerine uint16 kodlar yazılır (ışın başına 2 bayt).
+// Tüm alanlar little-endian.
+
+bool saveScanBinary(const std::string& path, const LidarScan& scan);
+bool saveScanBinary(const std::string& path, const QuantizedScan& scan);
+
+// Sürüm 2 dosyası açılırsa kodlar double'a çözülür
+std::optional<LidarScan> loadScanBinary(
+    const std::string& path,
+    std::pmr::memory_resource* mr = std::pmr::get_default_resource()
+);
+
+// Yalnızca sürüm 2 (kodlar olduğu gibi okunur)
+std::optional<QuantizedScan> loadQuantizedScanBinary(
+    const std::string& path,
+    std::pmr::memory_resource* mr = std::pmr::get_default_resource()
+);
+
+// Dosya "LSCN" imzası ile başlıyorsa true
+bool isBinaryScanFile(const std::string& path);
@@ -0,0 +1,314 @@
+#include "scan_stream.hpp"
+#include "quantized_scan.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+
+// YARDIMCI FONKSİYONLAR
+static bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static std::string trim(const std::string& str) {
+    size_t first = str.find_first_not_of(" \t\n\r");
+    if (std::string::npos == first) {
+        return std::string();
+    }
+    size_t last = str.find_last_not_of(" \t\n\r");
+    return str.substr(first, (last - first + 1));
+}
+
+// Baştaki '+' işaretini from_chars kabul etmez
+static bool parseNumber(const char* first, const char* last, double& out) {
+    if (first != last && *first == '+') ++first;
+    auto res = std::from_chars(first, last, out);
+    return res.ec == std::errc() && res.ptr == last;
+}
+
+static double parseDoubleValue(const std::string& line) {
+    size_t equalsPos = line.find('=');
+    if (equalsPos == std::string::npos) return 0.0;
+
+    const char* first = line.c_str() + equalsPos + 1;
+    const char* last = line.c_str() + line.size();
+    while (first != last && isSpace(*first)) ++first;
+    if (first != last && *first == '+') ++first;
+
+    // Satır sonu yorumları vb. değerden sonra yok sayılır
+    double v = 0.0;
+    auto res = std::from_chars(first, last, v);
+    return res.ec == std::errc() ? v : 0.0;
+}
+
+// TOML AKIŞ AYRIŞTIRICI
+TomlScanStreamParser::TomlScanStreamParser(RangeCallback onRange)
+    : m_onRange(std::move(onRange))
+{
+    m_line.reserve(256);
+}
+
+void TomlScanStreamParser::feed(const char* data, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        if (m_inRanges) {
+            feedRangesChar(data[i]);
+        } else {
+            feedHeaderChar(data[i]);
+        }
+    }
+}
+
+void TomlScanStreamParser::finish() {
+    if (m_inRanges) {
+        emitToken();
+        m_inRanges = false;
+    } else if (!m_line.empty()) {
+        processHeaderLine();
+        m_line.clear();
+    }
+}
+
+void TomlScanStreamParser::feedHeaderChar(char c) {
+    if (c == '\n') {
+        processHeaderLine();
+        m_line.clear();
+        return;
+    }
+
+    // "ranges = [" görüldüğü anda dizi moduna geç: uzun tek satırlık diziler tamponlanmaz
+    if (c == '[' && m_inScanSection) {
+        std::string t = trim(m_line);
+        if (t.rfind("ranges", 0) == 0 && t.find('=') != std::string::npos) {
+            m_inRanges = true;
+            m_line.clear();
+            return;
+        }
+    }
+
+    // Başlık değerleri kısa; ilgisiz uzun satırların yalnızca başı tutulur
+    if (m_line.size() < 256) {
+        m_line.push_back(c);
+    }
+}
+
+void TomlScanStreamParser::processHeaderLine() {
+    std::string line = trim(m_line);
+
+    if (line.empty() || line[0] == '#') {
+        return;
+    }
+
+    if (line == "[scan]") {
+        m_inScanSection = true;
+        return;
+    } else if (line[0] == '[') {
+        m_inScanSection = false;
+        return;
+    }
+
+    if (!m_inScanSection) {
+        return;
+    }
+
+    if (line.rfind("angle_min", 0) == 0) {
+        m_header.angle_min = parseDoubleValue(line);
+    } else if (line.rfind("angle_max", 0) == 0) {
+        m_header.angle_max = parseDoubleValue(line);
+    } else if (line.rfind("angle_increment", 0) == 0) {
+        m_header.angle_increment = parseDoubleValue(line);
+    } else if (line.rfind("range_min", 0) == 0) {
+        m_header.range_min = parseDoubleValue(line);
+    } else if (line.rfind("range_max", 0) == 0) {
+        m_header.range_max = parseDoubleValue(line);
+    }
+}
+
+void TomlScanStreamParser::feedRangesChar(char c) {
+    if (m_inComment) {
+        if (c == '\n') m_inComment = false;
+        return;
+    }
+
+    if (c == '#') {
+        emitToken();
+        m_inComment = true;
+    } else if (c == ']') {
+        emitToken();
+        m_inRanges = false;
+        m_line.clear();
+    } else if (c == ',' || isSpace(c)) {
+        emitToken();
+    } else if (m_tokenLen < sizeof(m_token)) {
+        m_token[m_tokenLen++] = c;
+    } else {
+        m_rangesStopped = true; // Sayı olamayacak kadar uzun
+    }
+}
+
+void TomlScanStreamParser::emitToken() {
+    if (m_tokenLen == 0) return;
+
+    double v = 0.0;
+    if (!m_rangesStopped && parseNumber(m_token, m_token + m_tokenLen, v)) {
+        m_onRange(m_header, m_count++, v);
+    } else {
+        // Eski davranışla aynı: ilk geçersiz değerde dizinin kalanı okunmaz
+        m_rangesStopped = true;
+    }
+    m_tokenLen = 0;
+}
+
+// İKİLİ AKIŞ AYRIŞTIRICI
+BinaryScanStreamParser::BinaryScanStreamParser(RangeCallback onRange)
+    : m_onRange(std::move(onRange))
+{
+}
+
+void BinaryScanStreamParser::parseHeader() {
+    if (m_headerSize == 8) {
+        if (std::memcmp(m_headerBuf, "LSCN", 4) != 0) {
+            m_error = "gecersiz ikili tarama imzasi";
+            return;
+        }
+
+        uint32_t version = 0;
+        std::memcpy(&version, m_headerBuf + 4, sizeof(version));
+        if (version != 1 && version != 2) {
+            m_error = "desteklenmeyen ikili tarama surumu";
+            return;
+        }
+        m_headerSize = version == 1 ? 56 : 64;
+        m_valueSize = version == 1 ? sizeof(double) : sizeof(uint16_t);
+        return;
+    }
+
+    const unsigned char* p = m_headerBuf + 8;
+    std::memcpy(&m_header.angle_min, p, sizeof(double));       p += sizeof(double);
+    std::memcpy(&m_header.angle_max, p, sizeof(double));       p += sizeof(double);
+    std::memcpy(&m_header.angle_increment, p, sizeof(double)); p += sizeof(double);
+    std::memcpy(&m_header.range_min, p, sizeof(double));       p += sizeof(double);
+    std::memcpy(&m_header.range_max, p, sizeof(double));       p += sizeof(double);
+    if (m_headerSize == 64) {
+        std::memcpy(&m_scale, p, sizeof(double));              p += sizeof(double);
+    }
+
+    uint64_t count = 0;
+    std::memcpy(&count, p, sizeof(count));
+    m_expected = static_cast<size_t>(count);
+}
+
+void BinaryScanStreamParser::emitValue(const unsigned char* p) {
+    double v;
+    if (m_valueSize == sizeof(double)) {
+        std::memcpy(&v, p, sizeof(double));
+    } else {
+        uint16_t code;
+        std::memcpy(&code, p, sizeof(code));
+        v = decodeRange(code, m_scale);
+    }
+    m_onRange(m_header, m_count++, v);
+}
+
+void BinaryScanStreamParser::feed(const char* data, size_t size) {
+    if (!m_error.empty()) return;
+
+    const unsigned char* in = reinterpret_cast<const unsigned char*>(data);
+    const unsigned char* end = in + size;
+
+    // Önce sürüm, ardından sürüme göre başlığın kalanı
+    while (m_headerLen < m_headerSize) {
+        size_t n = std::min(m_headerSize - m_headerLen, static_cast<size_t>(end - in));
+        std::memcpy(m_headerBuf + m_headerLen, in, n);
+        m_headerLen += n;
+        in += n;
+        if (m_headerLen < m_headerSize) return;
+
+        parseHeader();
+        if (!m_error.empty()) return;
+    }
+
+    if (m_carryLen > 0) {
+        size_t n = std::min(m_valueSize - m_carryLen, static_cast<size_t>(end - in));
+        std::memcpy(m_carry + m_carryLen, in, n);
+        m_carryLen += n;
+        in += n;
+        if (m_carryLen < m_valueSize) return;
+
+        m_carryLen = 0;
+        if (m_count < m_expected) emitValue(m_carry);
+    }
+
+    while (end - in >= static_cast<std::ptrdiff_t>(m_valueSize) && m_count < m_expected) {
+        emitValue(in);
+        in += m_valueSize;
+    }
+
+    if (m_count < m_expected && in < end) {
+        m_carryLen = static_cast<size_t>(end - in);
+        std::memcpy(m_carry, in, m_carryLen);
+    }
+}
+
+void BinaryScanStreamParser::finish() {
+    if (!m_error.empty()) return;
+
+    if (m_headerLen < m_headerSize) {
+        m_error = "ikili tarama basligi eksik";
+    } else if (m_count < m_expected) {
+        m_error = "ikili tarama verisi eksik";
+    }
+}
+
+// BİÇİM SEÇİCİ
+ScanStreamDecoder::ScanStreamDecoder(RangeCallback onRange)
+    : m_toml(onRange),
+      m_binary(std::move(onRange))
+{
+}
+
+void ScanStreamDecoder::decide() {
+    m_format = (m_sniffLen == 4 && std::memcmp(m_sniff, "LSCN", 4) == 0) ? Format::Binary : Format::Toml;
+    if (m_format == Format::Binary) {
+        m_binary.feed(m_sniff, m_sniffLen);
+    } else {
+        m_toml.feed(m_sniff, m_sniffLen);
+    }
+}
+
+void ScanStreamDecoder::feed(const char* data, size_t size) {
+    if (m_format == Format::Unknown) {
+        size_t n = std::min(sizeof(m_sniff) - m_sniffLen, size);
+        std::memcpy(m_sniff + m_sniffLen, data, n);
+        m_sniffLen += n;
+        data += n;
+        size -= n;
+        if (m_sniffLen < sizeof(m_sniff)) return;
+        decide();
+    }
+
+    if (m_format == Format::Binary) {
+        m_binary.feed(data, size);
+    } else {
+        m_toml.feed(data, size);
+    }
+}
+
+void ScanStreamDecoder::finish() {
+    if (m_format == Format::Unknown) {
+        decide();
+    }
+
+    if (m_format == Format::Binary) {
+        m_binary.finish();
+    } else {
+        m_toml.finish();
+    }
+}
+
+const LidarScan& ScanStreamDecoder::header() const {
+    return m_format == Format::Binary ? m_binary.header() : m_toml.header();
+}
+
+size_t ScanStreamDecoder::rangeCount() const {
+    return m_format == Format::Binary ? m_binary.rangeCount() : m_toml.rangeCount();
+}
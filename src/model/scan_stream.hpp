@@ -0,0 +1,101 @@
+#pragma once
+
+#include "model/types.hpp"
+#include <cstddef>
+#include <functional>
+#include <string>
+
+// Artımlı (push) tarama ayrıştırıcıları: bayt akışı parça parça feed() ile verilir,
+// her range değeri okunur okunmaz geri çağrı ile iletilir. Akışın tamamı
+// hiçbir zaman bellekte tutulmaz; stdin, FIFO ve HTTP akışları için kullanılır.
+//
+// Geri çağrıdaki header: başlık alanları dolu, ranges boş LidarScan.
+using RangeCallback = std::function<void(const LidarScan& header, size_t index, double range)>;
+
+// TOML: [scan] başlık alanları ranges dizisinden önce gelmelidir (örnek dosyalardaki gibi)
+class TomlScanStreamParser {
+public:
+    explicit TomlScanStreamParser(RangeCallback onRange);
+
+    void feed(const char* data, size_t size);
+    void finish();
+
+    const LidarScan& header() const { return m_header; }
+    size_t rangeCount() const { return m_count; }
+
+private:
+    void feedHeaderChar(char c);
+    void feedRangesChar(char c);
+    void processHeaderLine();
+    void emitToken();
+
+    RangeCallback m_onRange;
+    LidarScan m_header;
+    size_t m_count = 0;
+
+    std::string m_line;         // Başlık satırı (kısa)
+    char   m_token[64];         // Dizi içindeki tek sayı
+    size_t m_tokenLen = 0;
+    bool m_inScanSection = false;
+    bool m_inRanges = false;
+    bool m_inComment = false;
+    bool m_rangesStopped = false; // Geçersiz değerden sonra dizi yok sayılır
+};
+
+// İkili "LSCN" biçimi (bkz. scan_binary.hpp); sürüm 2'nin 16 bit kodları double'a çözülerek iletilir
+class BinaryScanStreamParser {
+public:
+    explicit BinaryScanStreamParser(RangeCallback onRange);
+
+    void feed(const char* data, size_t size);
+    void finish();
+
+    const LidarScan& header() const { return m_header; }
+    size_t rangeCount() const { return m_count; }
+    bool ok() const { return m_error.empty(); }
+    const std::string& error() const { return m_error; }
+
+private:
+    void parseHeader();
+
+    RangeCallback m_onRange;
+    LidarScan m_header;
+    size_t m_count = 0;
+    size_t m_expected = 0;
+
+    void emitValue(const unsigned char* p);
+
+    unsigned char m_headerBuf[64];
+    size_t m_headerLen = 0;
+    size_t m_headerSize = 8;    // Önce imza + sürüm; sürüme göre 56 (v1) ya da 64 (v2)
+    size_t m_valueSize = sizeof(double);
+    double m_scale = 0.0;       // Yalnızca sürüm 2
+    unsigned char m_carry[sizeof(double)]; // Parça sınırında bölünmüş değer
+    size_t m_carryLen = 0;
+    std::string m_error;
+};
+
+// İlk baytlara bakarak TOML / ikili ayrıştırıcıyı seçer
+class ScanStreamDecoder {
+public:
+    explicit ScanStreamDecoder(RangeCallback onRange);
+
+    void feed(const char* data, size_t size);
+    void finish();
+
+    const LidarScan& header() const;
+    size_t rangeCount() const;
+    bool ok() const { return m_binary.ok(); }
+    const std::string& error() const { return m_binary.error(); }
+
+private:
+    enum class Format { Unknown, Toml, Binary };
+
+    void decide();
+
+    Format m_format = Format::Unknown;
+    char   m_sniff[4];
+    size_t m_sniffLen = 0;
+    TomlScanStreamParser   m_toml;
+    BinaryScanStreamParser m_binary;
+};
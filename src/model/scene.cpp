@@ -0,0 +1,221 @@
+#include "scene.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// YARDIMCI FONKSİYONLAR
+static Point rotate(const Point& p, double c, double s) {
+    return {c * p.x - s * p.y, s * p.x + c * p.y};
+}
+
+// Dünya -> sensör çerçevesi
+static Point toSensorFrame(const Point& p, const SensorPose& pose) {
+    const double c = std::cos(-pose.yaw);
+    const double s = std::sin(-pose.yaw);
+    return rotate({p.x - pose.x, p.y - pose.y}, c, s);
+}
+
+static void addBox(Scene& scene, double cx, double cy, double w, double h, double yaw) {
+    const double c = std::cos(yaw);
+    const double s = std::sin(yaw);
+    Point corners[4] = {{-w / 2, -h / 2}, {w / 2, -h / 2}, {w / 2, h / 2}, {-w / 2, h / 2}};
+    for (auto& p : corners) {
+        p = rotate(p, c, s);
+        p.x += cx;
+        p.y += cy;
+    }
+    for (int k = 0; k < 4; ++k) {
+        scene.walls.push_back({corners[k], corners[(k + 1) % 4]});
+    }
+}
+
+// Işın (sensör çerçevesinde orijinden, yön (dx, dy)) ile duvarın kesişim mesafesi
+static double rayHitDistance(double dx, double dy, const Wall& w) {
+    const double ex = w.b.x - w.a.x;
+    const double ey = w.b.y - w.a.y;
+
+    const double det = ex * dy - ey * dx;
+    if (std::abs(det) < 1e-12) {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    const double t = (ex * w.a.y - ey * w.a.x) / det; // ışın parametresi
+    const double u = (dx * w.a.y - dy * w.a.x) / det; // duvar parametresi
+    if (t <= 0.0 || u < 0.0 || u > 1.0) {
+        return std::numeric_limits<double>::infinity();
+    }
+    return t;
+}
+
+// SAHNE YAPI TAŞLARI
+void addRoom(Scene& scene, double cx, double cy, double width, double height) {
+    addBox(scene, cx, cy, width, height, 0.0);
+}
+
+void addPolygonRoom(Scene& scene, double cx, double cy, int sides, double radius, double rotation) {
+    sides = std::max(3, sides);
+    std::vector<Point> corners(sides);
+    for (int k = 0; k < sides; ++k) {
+        const double a = rotation + 2.0 * M_PI * k / sides;
+        corners[k] = {cx + radius * std::cos(a), cy + radius * std::sin(a)};
+    }
+    for (int k = 0; k < sides; ++k) {
+        scene.walls.push_back({corners[k], corners[(k + 1) % sides]});
+    }
+}
+
+void addCorridor(Scene& scene, Point from, Point to, double width) {
+    const double dx = to.x - from.x;
+    const double dy = to.y - from.y;
+    const double len = std::sqrt(dx * dx + dy * dy);
+    if (len < 1e-9) return;
+
+    // Eksene dik yarım genişlik vektörü
+    const double nx = -dy / len * width / 2.0;
+    const double ny =  dx / len * width / 2.0;
+    scene.walls.push_back({{from.x + nx, from.y + ny}, {to.x + nx, to.y + ny}});
+    scene.walls.push_back({{from.x - nx, from.y - ny}, {to.x - nx, to.y - ny}});
+}
+
+void addRack(Scene& scene, double cx, double cy, double length, double depth, double yaw) {
+    addBox(scene, cx, cy, length, depth, yaw);
+}
+
+void addClutter(Scene& scene, int count, Point regionMin, Point regionMax, double maxSize, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> ux(regionMin.x, regionMax.x);
+    std::uniform_real_distribution<double> uy(regionMin.y, regionMax.y);
+    std::uniform_real_distribution<double> size(maxSize * 0.2, maxSize);
+    std::uniform_real_distribution<double> angle(0.0, M_PI);
+    std::uniform_int_distribution<int> kind(0, 1);
+
+    for (int i = 0; i < count; ++i) {
+        const double cx = ux(rng);
+        const double cy = uy(rng);
+        if (kind(rng) == 0) {
+            // Küçük kutu (kasa, kolon ...)
+            addBox(scene, cx, cy, size(rng), size(rng), angle(rng));
+        } else {
+            // Tek parça (pano, kapı kanadı ...)
+            const double a = angle(rng);
+            const double half = size(rng) / 2.0;
+            scene.walls.push_back({{cx - half * std::cos(a), cy - half * std::sin(a)},
+                                   {cx + half * std::cos(a), cy + half * std::sin(a)}});
+        }
+    }
+}
+
+// IŞIN İZLEME
+LidarScan simulateScan(const Scene& scene, const SensorPose& pose, const ScanSimConfig& cfg,
+                       std::vector<size_t>* wallHits)
+{
+    // Duvarlar bir kez sensör çerçevesine taşınır
+    std::vector<Wall> local;
+    local.reserve(scene.walls.size());
+    for (const auto& w : scene.walls) {
+        local.push_back({toSensorFrame(w.a, pose), toSensorFrame(w.b, pose)});
+    }
+    if (wallHits) wallHits->assign(local.size(), 0);
+
+    LidarScan scan;
+    scan.angle_min = cfg.angleMin;
+    scan.angle_increment = cfg.angleIncrement > 0.0
+        ? cfg.angleIncrement
+        : 2.0 * M_PI / static_cast<double>(std::max<size_t>(1, cfg.beams));
+    scan.angle_max = scan.angle_min + scan.angle_increment * (cfg.beams > 0 ? cfg.beams - 1 : 0);
+    scan.range_min = cfg.rangeMin;
+    scan.range_max = cfg.rangeMax;
+    scan.ranges.resize(cfg.beams);
+
+    std::mt19937 rng(cfg.seed);
+    std::normal_distribution<double> noise(0.0, cfg.noiseSigma > 0.0 ? cfg.noiseSigma : 1.0);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    for (size_t i = 0; i < cfg.beams; ++i) {
+        const double theta = scan.angle_min + i * scan.angle_increment;
+        const double dx = std::cos(theta);
+        const double dy = std::sin(theta);
+
+        double best = std::numeric_limits<double>::infinity();
+        size_t bestWall = 0;
+        for (size_t k = 0; k < local.size(); ++k) {
+            double d = rayHitDistance(dx, dy, local[k]);
+            if (d < best) {
+                best = d;
+                bestWall = k;
+            }
+        }
+
+        // Sentinel değerleri: önce hata, sonra kayıp dönüş, sonra menzil dışı
+        if (cfg.errorRate > 0.0 && unit(rng) < cfg.errorRate) {
+            scan.ranges[i] = cfg.errorValue;
+        } else if (cfg.dropoutRate > 0.0 && unit(rng) < cfg.dropoutRate) {
+            scan.ranges[i] = cfg.dropoutValue;
+        } else if (!std::isfinite(best) || best > cfg.rangeMax) {
+            scan.ranges[i] = cfg.noReturnValue;
+        } else {
+            if (wallHits) ++(*wallHits)[bestWall];
+            scan.ranges[i] = best + (cfg.noiseSigma > 0.0 ? noise(rng) : 0.0);
+        }
+    }
+
+    return scan;
+}
+
+// YER GERÇEĞİ
+static double angleBetweenWalls(const Wall& a, const Wall& b) {
+    const double ax = a.b.x - a.a.x, ay = a.b.y - a.a.y;
+    const double bx = b.b.x - b.a.x, by = b.b.y - b.a.y;
+    const double magA = std::sqrt(ax * ax + ay * ay);
+    const double magB = std::sqrt(bx * bx + by * by);
+    if (magA == 0 || magB == 0) return 0;
+
+    double cosTheta = std::max(-1.0, std::min(1.0, (ax * bx + ay * by) / (magA * magB)));
+    double deg = std::acos(cosTheta) * 180.0 / M_PI;
+    return deg > 90.0 ? 180.0 - deg : deg;
+}
+
+GroundTruth computeGroundTruth(const Scene& scene, const SensorPose& pose,
+                               const std::vector<size_t>& wallHits, double minAngleDeg)
+{
+    GroundTruth truth;
+    truth.walls.reserve(scene.walls.size());
+    for (size_t k = 0; k < scene.walls.size(); ++k) {
+        const Wall& w = scene.walls[k];
+        truth.walls.push_back({{toSensorFrame(w.a, pose), toSensorFrame(w.b, pose)},
+                               k < wallHits.size() ? wallHits[k] : 0});
+    }
+
+    // Köşe = görülen iki duvarın kesişimi; ortak uç noktalar tolerans ile yakalanır
+    constexpr double eps = 1e-6;
+    for (size_t i = 0; i < truth.walls.size(); ++i) {
+        if (truth.walls[i].hits == 0) continue;
+        for (size_t j = i + 1; j < truth.walls.size(); ++j) {
+            if (truth.walls[j].hits == 0) continue;
+
+            const Wall& a = truth.walls[i].wall;
+            const Wall& b = truth.walls[j].wall;
+            const double s1x = a.b.x - a.a.x, s1y = a.b.y - a.a.y;
+            const double s2x = b.b.x - b.a.x, s2y = b.b.y - b.a.y;
+            const double det = -s2x * s1y + s1x * s2y;
+            if (std::abs(det) < 1e-12) continue;
+
+            const double s = (-s1y * (a.a.x - b.a.x) + s1x * (a.a.y - b.a.y)) / det;
+            const double t = ( s2x * (a.a.y - b.a.y) - s2y * (a.a.x - b.a.x)) / det;
+            if (s < -eps || s > 1 + eps || t < -eps || t > 1 + eps) continue;
+
+            const double angle = angleBetweenWalls(a, b);
+            if (angle < minAngleDeg) continue;
+
+            Point p = {a.a.x + t * s1x, a.a.y + t * s1y};
+            truth.corners.push_back({p, angle, std::sqrt(p.x * p.x + p.y * p.y)});
+        }
+    }
+
+    return truth;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "model/types.hpp"
+#include <cstdint>
+#include <vector>
+
+// Sentetik 2D sahne: duvar parçalarından oluşur, sensör pozundan ışın izlenir.
+// Ölçeklenme ve stres testleri için tarama + yer gerçeği (duvar/köşe) üretir.
+
+struct Wall {
+    Point a;
+    Point b;
+};
+
+struct Scene {
+    std::vector<Wall> walls;
+};
+
+// Sensörün dünya koordinatındaki konumu ve yönü (yaw, radyan)
+struct SensorPose {
+    double x   = 0.0;
+    double y   = 0.0;
+    double yaw = 0.0;
+};
+
+// Sahne yapı taşları (koordinatlar dünya çerçevesinde, metre)
+void addRoom(Scene& scene, double cx, double cy, double width, double height);
+void addPolygonRoom(Scene& scene, double cx, double cy, int sides, double radius, double rotation = 0.3);
+void addCorridor(Scene& scene, Point from, Point to, double width);
+void addRack(Scene& scene, double cx, double cy, double length, double depth, double yaw);
+void addClutter(Scene& scene, int count, Point regionMin, Point regionMax, double maxSize, uint32_t seed);
+
+struct ScanSimConfig {
+    size_t   beams           = 360;
+    double   angleMin        = 0.0;
+    double   angleIncrement  = 0.0;    // 0 ise beams ile tam tur
+    double   rangeMin        = 0.05;
+    double   rangeMax        = 10.0;
+    double   noiseSigma      = 0.0;    // Gauss gürültüsü [m]
+    double   dropoutRate     = 0.0;    // Dönüşü kaybolan ışın oranı
+    double   dropoutValue    = -1.0;   // Kayıp ışın değeri
+    double   noReturnValue   = 999.0;  // Hiçbir duvara çarpmayan / menzil dışı ışın
+    double   errorRate       = 0.0;    // Donanım hatası oranı
+    double   errorValue      = -999.0; // Hatalı ışın değeri
+    uint32_t seed            = 42;
+};
+
+// wallHits verilirse her duvara çarpan ışın sayısı yazılır (scene.walls ile aynı sıra)
+LidarScan simulateScan(const Scene& scene, const SensorPose& pose, const ScanSimConfig& cfg,
+                       std::vector<size_t>* wallHits = nullptr);
+
+// Yer gerçeği: sensör çerçevesinde duvarlar (kaç ışın çarptığı ile) ve
+// görülen duvar çiftlerinin minAngleDeg üstü kesişimleri (köşeler)
+struct TruthWall {
+    Wall   wall;
+    size_t hits = 0;
+};
+
+struct TruthCorner {
+    Point  position;
+    double angleDeg = 0.0;
+    double distanceToRobot = 0.0;
+};
+
+struct GroundTruth {
+    std::vector<TruthWall>   walls;
+    std::vector<TruthCorner> corners;
+};
+
+GroundTruth computeGroundTruth(const Scene& scene, const SensorPose& pose,
+                               const std::vector<size_t>& wallHits, double minAngleDeg);
@@ -0,0 +1,181 @@
+#include "sector_scan.hpp"
+#include "model/geometry.hpp"
+#include "model/lidar.hpp"
+#include "model/ransac.hpp"
+#include "model/segment_merge.hpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+static double msBetween(std::chrono::steady_clock::time_point a, std::chrono::steady_clock::time_point b) {
+    return std::chrono::duration<double, std::milli>(b - a).count();
+}
+
+// SEKTÖR İŞLEMCİSİ
+template <typename T>
+SectorScanProcessor<T>::SectorScanProcessor(const SectorParams& params, std::pmr::memory_resource* mr)
+    : m_params(params),
+      m_mr(mr),
+      m_points(mr),
+      m_sector(mr),
+      m_segments(mr),
+      m_segmentSector(mr),
+      m_intersections(mr)
+{
+    m_params.sectorBeams = std::max<size_t>(m_params.sectorBeams, 1);
+    if (m_params.minSectorPoints == 0) {
+        m_params.minSectorPoints = 2 * static_cast<size_t>(std::max(m_params.minInliers, 1));
+    }
+}
+
+template <typename T>
+void SectorScanProcessor<T>::begin(const LidarScanT<T>& header) {
+    m_header.angle_min = header.angle_min;
+    m_header.angle_max = header.angle_max;
+    m_header.angle_increment = header.angle_increment;
+    m_header.range_min = header.range_min;
+    m_header.range_max = header.range_max;
+
+    m_points.clear();
+    m_segments.clear();
+    m_segmentSector.clear();
+    m_intersections.clear();
+    m_currentSector = 0;
+    m_sectorStart = 0;
+    m_stats = SectorStats{};
+    m_open = true;
+}
+
+template <typename T>
+void SectorScanProcessor<T>::addBeam(size_t index, T range) {
+    const size_t sector = index / m_params.sectorBeams;
+    if (sector != m_currentSector) {
+        // Önceki sektörün son ışını bir önceki çağrıda geldi
+        closeSector(Clock::now());
+        m_currentSector = sector;
+    }
+
+    PointT<T> p;
+    if (convertBeam(m_header, index, range, p)) {
+        m_points.push_back(p);
+    }
+}
+
+template <typename T>
+void SectorScanProcessor<T>::closeSector(Clock::time_point lastBeam) {
+    ++m_stats.sectors;
+    const size_t start = m_sectorStart;
+    const size_t n = m_points.size() - start;
+    m_sectorStart = m_points.size();
+
+    // Seyrek sektörde RANSAC duvarları minInliers altı parçalara böler: noktalar son geçişe kalır
+    if (n < static_cast<size_t>(std::max(m_params.minInliers, 2)) || n < m_params.minSectorPoints) {
+        return;
+    }
+
+    // RANSAC sektör tamponunu yeniden sıralar; sıralı hali ortak tampona geri yazılır,
+    // böylece inlier aralıkları points() içinde geçerli kalır
+    m_sector.assign(m_points.begin() + static_cast<std::ptrdiff_t>(start), m_points.end());
+    const uint32_t seed = m_params.seed == 0 ? 0 : m_params.seed + static_cast<uint32_t>(m_currentSector);
+    auto lines = findLinesRANSAC(m_sector, m_params.minInliers, m_params.epsilon, m_params.maxIters, m_mr, seed);
+    std::copy(m_sector.begin(), m_sector.end(), m_points.begin() + static_cast<std::ptrdiff_t>(start));
+
+    for (auto& l : lines) {
+        l.inlierOffset += static_cast<uint32_t>(start);
+        m_segments.push_back(l);
+        m_segmentSector.push_back(m_currentSector);
+    }
+    m_stats.rawSegments += lines.size();
+
+    // İlk köşe: o ana kadarki (birleştirilmemiş) parçalar arasında
+    if (!lines.empty() && m_stats.firstIntersectionMs < 0 &&
+        !findPhysicalIntersections(m_segments, m_params.angleThreshDeg, m_mr).empty()) {
+        m_firstFound = Clock::now();
+        m_stats.firstIntersectionMs = msBetween(lastBeam, m_firstFound);
+    }
+}
+
+template <typename T>
+void SectorScanProcessor<T>::finish() {
+    if (!m_open) return;
+    m_open = false;
+
+    const Clock::time_point lastBeam = Clock::now();
+    closeSector(lastBeam);
+    recoverLeftovers();
+    stitchSegments();
+    m_intersections = findPhysicalIntersections(m_segments, m_params.angleThreshDeg, m_mr);
+
+    const Clock::time_point done = Clock::now();
+    m_stats.finishMs = msBetween(lastBeam, done);
+    if (m_stats.firstIntersectionMs >= 0) {
+        m_stats.firstIntersectionLeadMs = msBetween(m_firstFound, lastBeam);
+    } else if (!m_intersections.empty()) {
+        // Köşe ancak birleştirmeden sonra görüldü: tam tarama ile aynı gecikme
+        m_stats.firstIntersectionMs = m_stats.finishMs;
+        m_stats.firstIntersectionLeadMs = -m_stats.finishMs;
+    }
+}
+
+// Komşu sektörlerdeki eş doğrusal, uçları yakın parçalar tek parçada birleştirilir. Son
+// geçişin doğruları (bölge lastSector + 1) tüm sektörlere komşudur: seyrek sektörlerden
+// geçen bir duvarın devamı olabilirler
+template <typename T>
+void SectorScanProcessor<T>::stitchSegments() {
+    const size_t lastSector = m_currentSector;
+    const size_t recovered = lastSector + 1;
+    const T span = (m_header.angle_max - m_header.angle_min) + std::abs(m_header.angle_increment);
+    const bool fullSweep = lastSector > 0 && span >= T(2 * M_PI) - T(1e-3);
+
+    m_stats.stitched = mergeCollinearSegments(
+        m_points, m_segments, m_segmentSector,
+        [fullSweep, lastSector, recovered](size_t a, size_t b) {
+            return b == a + 1 || b == recovered || (fullSweep && a == 0 && b == lastSector);
+        },
+        m_params.epsilon, m_params.stitchAngleDeg, m_mr);
+}
+
+// Sektörlere seyrek dağılan ya da sınırda minInliers'ın altına bölünen duvarlar hiçbir
+// sektörde bulunamaz: atanmamış noktalar (seyrek sektörlerinkiler dahil) tüm tarama üzerinde
+// bir kez daha RANSAC'tan geçer
+template <typename T>
+void SectorScanProcessor<T>::recoverLeftovers() {
+    // Parçaların inlier'ları başa, atanmamış noktalar m_sector tamponuna
+    std::pmr::vector<PointT<T>> ordered(m_mr);
+    ordered.reserve(m_points.size());
+    std::vector<char> used(m_points.size(), 0);
+    for (auto& l : m_segments) {
+        const uint32_t offset = static_cast<uint32_t>(ordered.size());
+        for (uint32_t i = l.inlierOffset; i < l.inlierOffset + l.inlierCount; ++i) {
+            ordered.push_back(m_points[i]);
+            used[i] = 1;
+        }
+        l.inlierOffset = offset;
+    }
+    const size_t assigned = ordered.size();
+    m_sector.clear();
+    for (size_t i = 0; i < m_points.size(); ++i) {
+        if (!used[i]) m_sector.push_back(m_points[i]);
+    }
+
+    if (m_sector.size() >= static_cast<size_t>(std::max(m_params.minInliers, 2))) {
+        // Geliş sırası korunur: tüm sektörler seyrekse sonuç tam taramayla birebir aynıdır
+        auto lines = findLinesRANSAC(m_sector, m_params.minInliers, m_params.epsilon, m_params.maxIters, m_mr,
+                                     m_params.seed);
+        for (auto& l : lines) {
+            l.inlierOffset += static_cast<uint32_t>(assigned);
+            m_segments.push_back(l);
+            m_segmentSector.push_back(m_currentSector + 1);
+        }
+        m_stats.recovered = lines.size();
+    }
+    ordered.insert(ordered.end(), m_sector.begin(), m_sector.end());
+    m_points = std::move(ordered);
+}
+
+template class SectorScanProcessor<float>;
+template class SectorScanProcessor<double>;
@@ -0,0 +1,86 @@
+#pragma once
+#include "model/types.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// Sektör akışı parametreleri (RANSAC / kesişim değerleri CLI ile aynı anlamda)
+struct SectorParams {
+    size_t   sectorBeams     = 90;    // Sektör başına ışın (indeks aralığı)
+    int      minInliers      = 8;
+    double   epsilon         = 0.02;
+    int      maxIters        = 2000;  // Sektör başına
+    size_t   minSectorPoints = 0;     // Daha az noktalı sektör RANSAC'sız kalır (0: 2 * minInliers)
+    uint32_t seed            = 0;     // 0: saat tabanlı; sektör k için seed + k
+    double   angleThreshDeg  = 60.0;
+    double   stitchAngleDeg  = 5.0;   // Birleştirilecek parçaların en büyük açı farkı
+};
+
+struct SectorStats {
+    size_t sectors = 0;
+    size_t rawSegments = 0;   // Birleştirme öncesi (sektör içi) parça sayısı
+    size_t stitched = 0;      // Birleştirmeyle azalan parça sayısı (sektör sınırı ve son geçiş)
+    size_t recovered = 0;     // Kalan noktalar üzerindeki son tam tarama geçişinin bulduğu
+    // İlk kesişimin, onu tamamlayan sektörün son ışınından sonra bulunma süresi; yoksa -1
+    double firstIntersectionMs = -1.0;
+    // İlk kesişim taramanın son ışınından ne kadar önce bulundu (tam tarama modunda <= 0)
+    double firstIntersectionLeadMs = 0.0;
+    // Son ışından nihai (birleştirilmiş) sonuçlara kadar geçen süre
+    double finishMs = 0.0;
+};
+
+// Dönen sensörden gelen taramayı açısal sektörler halinde işler: ışınlar geldikçe noktaya
+// dönüştürülür, her sektör tamamlanınca kendi içinde RANSAC çalışır ve o ana kadarki
+// parçalar arasında kesişim aranır.
+//
+// finish() önce hiçbir sektörün atayamadığı noktaları tüm tarama üzerinde tek bir RANSAC
+// geçişinden daha geçirir (tohum seed). Sonra sektör sınırlarında bölünmüş duvarları
+// (tam turda son sektör ilk sektörle de) ve son geçişin sektör parçalarının devamı olan
+// doğrularını birleştirir, nihai kesişimleri hesaplar. minSectorPoints altındaki sektörler
+// duvarları ayırmaya yetmez; noktaları doğrudan son geçişe kalır.
+//
+// finish() sonrası points() findLinesRANSAC düzenindedir: inlier aralıkları, sonra
+// atanmamışlar. Nokta ve parçalar mr'den ayrılır; parçaların inlier aralıkları points()
+// tamponuna işaret eder.
+template <typename T>
+class SectorScanProcessor {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    SectorScanProcessor(const SectorParams& params,
+                        std::pmr::memory_resource* mr = std::pmr::get_default_resource());
+
+    // Yeni tarama: başlık dizi başlamadan bilinir
+    void begin(const LidarScanT<T>& header);
+
+    // Işınlar artan indeksle gelir; geçersizler de sektör ilerlemesi için verilmelidir
+    void addBeam(size_t index, T range);
+
+    void finish();
+
+    std::pmr::vector<PointT<T>>& points() { return m_points; }
+    std::pmr::vector<LineT<T>>& segments() { return m_segments; }
+    std::pmr::vector<IntersectionT<T>>& intersections() { return m_intersections; }
+    const SectorStats& stats() const { return m_stats; }
+
+private:
+    void closeSector(Clock::time_point lastBeam);
+    void stitchSegments();
+    void recoverLeftovers();
+
+    SectorParams m_params;
+    std::pmr::memory_resource* m_mr;
+    LidarScanT<T> m_header;
+
+    std::pmr::vector<PointT<T>> m_points;
+    std::pmr::vector<PointT<T>> m_sector;   // Sektörün RANSAC tamponu (yeniden kullanılır)
+    std::pmr::vector<LineT<T>> m_segments;
+    std::pmr::vector<size_t> m_segmentSector; // Parçanın geldiği sektör
+    std::pmr::vector<IntersectionT<T>> m_intersections;
+
+    size_t m_currentSector = 0;
+    size_t m_sectorStart = 0;   // Açık sektörün m_points içindeki ilk noktası
+    bool m_open = false;
+    Clock::time_point m_firstFound;
+    SectorStats m_stats;
+};
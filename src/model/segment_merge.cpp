@@ -0,0 +1,168 @@
+#include "segment_merge.hpp"
+#include "model/geometry.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// YARDIMCI FONKSİYONLAR
+// Birden çok inlier aralığına toplam en küçük kareler doğrusu
+template <typename T>
+static bool fitLineToSpans(const std::pmr::vector<PointT<T>>& points,
+                           const std::vector<const LineT<T>*>& members, LineT<T>& out) {
+    T sumX = 0, sumY = 0;
+    size_t n = 0;
+    for (const LineT<T>* l : members) {
+        for (const auto& p : l->inliers(points)) { sumX += p.x; sumY += p.y; }
+        n += l->inlierCount;
+    }
+    if (n < 2) return false;
+
+    const T meanX = sumX / static_cast<T>(n);
+    const T meanY = sumY / static_cast<T>(n);
+    T Sxx = 0, Sxy = 0, Syy = 0;
+    for (const LineT<T>* l : members) {
+        for (const auto& p : l->inliers(points)) {
+            T dx = p.x - meanX, dy = p.y - meanY;
+            Sxx += dx * dx;
+            Sxy += dx * dy;
+            Syy += dy * dy;
+        }
+    }
+
+    return fitLineFromMoments(meanX, meanY, Sxx, Sxy, Syy, out);
+}
+
+template <typename T>
+static T lineDistance(const LineT<T>& l, const PointT<T>& p) {
+    return std::abs(l.A * p.x + l.B * p.y + l.C) / std::sqrt(l.A * l.A + l.B * l.B);
+}
+
+// a'nın yönündeki izdüşüm aralıkları arasındaki boşluk; üst üste binen parçalarda 0
+template <typename T>
+static T intervalGap(const LineT<T>& a, const LineT<T>& b) {
+    const T norm = std::sqrt(a.A * a.A + a.B * a.B);
+    const T dx = a.B / norm, dy = -a.A / norm;
+    auto t = [dx, dy](const PointT<T>& p) { return p.x * dx + p.y * dy; };
+    const T a0 = std::min(t(a.startPoint), t(a.endPoint)), a1 = std::max(t(a.startPoint), t(a.endPoint));
+    const T b0 = std::min(t(b.startPoint), t(b.endPoint)), b1 = std::max(t(b.startPoint), t(b.endPoint));
+    return std::max(T(0), std::max(a0, b0) - std::min(a1, b1));
+}
+
+// BİRLEŞTİRME
+template <typename T>
+size_t mergeCollinearSegments(
+    std::pmr::vector<PointT<T>>& points,
+    std::pmr::vector<LineT<T>>& segments,
+    const std::pmr::vector<size_t>& region,
+    const std::function<bool(size_t, size_t)>& adjacent,
+    double epsilon,
+    double maxAngleDeg,
+    std::pmr::memory_resource* mr)
+{
+    const size_t k = segments.size();
+    if (k < 2) return 0;
+
+    const T eps = static_cast<T>(epsilon);
+    const T maxSin = static_cast<T>(std::sin(maxAngleDeg * M_PI / 180.0));
+    // Uçlar her iki taraftan 5 * eps kısaltılır ve sınırdaki kesişen doğru birkaç inlier alabilir;
+    // izin verilen boşluk buna ek birkaç nokta aralığıdır (parçanın kendi yoğunluğundan)
+    auto spacing = [eps](const LineT<T>& l) {
+        T len = std::hypot(l.endPoint.x - l.startPoint.x, l.endPoint.y - l.startPoint.y) + T(10) * eps;
+        return len / static_cast<T>(std::max<uint32_t>(l.inlierCount, 2) - 1);
+    };
+
+    std::vector<size_t> parent(k);
+    std::iota(parent.begin(), parent.end(), size_t{0});
+    auto find = [&parent](size_t i) {
+        while (parent[i] != i) i = parent[i] = parent[parent[i]];
+        return i;
+    };
+
+    auto mergeable = [&](const LineT<T>& a, const LineT<T>& b) {
+        T cross = a.A * b.B - a.B * b.A;
+        T norms = std::sqrt((a.A * a.A + a.B * a.B) * (b.A * b.A + b.B * b.B));
+        if (norms <= T(0) || std::abs(cross) > maxSin * norms) return false;
+        if (lineDistance(a, b.startPoint) > T(2) * eps || lineDistance(a, b.endPoint) > T(2) * eps ||
+            lineDistance(b, a.startPoint) > T(2) * eps || lineDistance(b, a.endPoint) > T(2) * eps) {
+            return false;
+        }
+        return intervalGap(a, b) <= T(15) * eps + T(3) * std::max(spacing(a), spacing(b));
+    };
+
+    for (size_t i = 0; i < k; ++i) {
+        for (size_t j = i + 1; j < k; ++j) {
+            const size_t ri = std::min(region[i], region[j]), rj = std::max(region[i], region[j]);
+            if (ri != rj && adjacent(ri, rj) && mergeable(segments[i], segments[j])) {
+                parent[find(j)] = find(i);
+            }
+        }
+    }
+
+    // Gruplar ilk üyelerinin sırasıyla
+    std::vector<std::vector<const LineT<T>*>> groups;
+    std::vector<size_t> groupOf(k, k);
+    for (size_t i = 0; i < k; ++i) {
+        size_t root = find(i);
+        if (groupOf[root] == k) {
+            groupOf[root] = groups.size();
+            groups.emplace_back();
+        }
+        groups[groupOf[root]].push_back(&segments[i]);
+    }
+    if (groups.size() == k) return 0;
+
+    // Birleşen parçaların inlier'ları ardışık olacak şekilde nokta tamponu yeniden kurulur
+    std::pmr::vector<PointT<T>> rebuilt(mr);
+    rebuilt.reserve(points.size());
+    std::vector<char> used(points.size(), 0);
+    std::pmr::vector<LineT<T>> merged(mr);
+    merged.reserve(groups.size());
+
+    for (const auto& members : groups) {
+        LineT<T> line = *members.front();
+        if (members.size() > 1 && fitLineToSpans(points, members, line)) {
+            const T dx = line.B, dy = -line.A;
+            const PointT<T> base{-line.A * line.C, -line.B * line.C};
+            T tMin = std::numeric_limits<T>::max(), tMax = std::numeric_limits<T>::lowest();
+            for (const LineT<T>* l : members) {
+                for (const PointT<T>& e : {l->startPoint, l->endPoint}) {
+                    T t = (e.x - base.x) * dx + (e.y - base.y) * dy;
+                    tMin = std::min(tMin, t);
+                    tMax = std::max(tMax, t);
+                }
+            }
+            line.startPoint = {base.x + tMin * dx, base.y + tMin * dy};
+            line.endPoint = {base.x + tMax * dx, base.y + tMax * dy};
+        }
+
+        line.inlierOffset = static_cast<uint32_t>(rebuilt.size());
+        for (const LineT<T>* l : members) {
+            for (uint32_t i = l->inlierOffset; i < l->inlierOffset + l->inlierCount; ++i) {
+                rebuilt.push_back(points[i]);
+                used[i] = 1;
+            }
+        }
+        line.inlierCount = static_cast<uint32_t>(rebuilt.size()) - line.inlierOffset;
+        merged.push_back(line);
+    }
+
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (!used[i]) rebuilt.push_back(points[i]);
+    }
+
+    points = std::move(rebuilt);
+    segments = std::move(merged);
+    return k - groups.size();
+}
+
+template size_t mergeCollinearSegments(std::pmr::vector<PointT<float>>&, std::pmr::vector<LineT<float>>&,
+                                       const std::pmr::vector<size_t>&, const std::function<bool(size_t, size_t)>&,
+                                       double, double, std::pmr::memory_resource*);
+template size_t mergeCollinearSegments(std::pmr::vector<PointT<double>>&, std::pmr::vector<LineT<double>>&,
+                                       const std::pmr::vector<size_t>&, const std::function<bool(size_t, size_t)>&,
+                                       double, double, std::pmr::memory_resource*);
@@ -0,0 +1,26 @@
+#pragma once
+#include "model/types.hpp"
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+// Bölgeler (sektörler) halinde bulunmuş parçaları birleştirir: komşu bölgelerdeki eş
+// doğrusal (açı farkı < maxAngleDeg, uçları karşı doğruya 2 * epsilon içinde), üst üste binen
+// ya da arası birkaç nokta aralığını aşmayan parçalar tek parçaya iner. Her grup tüm
+// inlier'larına toplam en küçük kareler ile yeniden oturtulur; uçlar üye uçlarının yeni doğru
+// üzerindeki izdüşümlerinin en dışlarıdır.
+//
+// region[i]: i. parçanın bölgesi; adjacent(a, b) (a < b) o iki bölgenin komşu olup olmadığı.
+// Gruplar ilk üyelerinin sırasıyla dizilir. Birleşme olursa points yeniden kurulur: her
+// parçanın inlier'ları ardışık, hiçbir parçaya ait olmayanlar sonda (findLinesRANSAC ile
+// aynı düzen). Dönüş: birleşmeyle azalan parça sayısı.
+template <typename T>
+size_t mergeCollinearSegments(
+    std::pmr::vector<PointT<T>>& points,
+    std::pmr::vector<LineT<T>>& segments,
+    const std::pmr::vector<size_t>& region,
+    const std::function<bool(size_t, size_t)>& adjacent,
+    double epsilon,
+    double maxAngleDeg,
+    std::pmr::memory_resource* mr = std::pmr::get_default_resource()
+);
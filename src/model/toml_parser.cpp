@@ -1,115 +1,63 @@
 #include "toml_parser.hpp"
-#include <iostream>
+#include "scan_stream.hpp"
+#include <cstdio>
+#include <cstdlib>
 #include <fstream>
-#include <sstream>
-#include <string>
-#include <algorithm>
+#include <iostream>
 
-// YARDIMCI FONKSİYONLAR
-static std::string trim(const std::string& str) {
-    size_t first = str.find_first_not_of(" \t\n\r");
-    if (std::string::npos == first) {
-        return str;
+// ANA PARSER FONKSİYONU
+// Dosya sabit boyutlu parçalar halinde okunur; değerler akış ayrıştırıcısından
+// doğrudan ranges dizisine eklenir (ara metin tamponu yok).
+std::optional<LidarScan> loadScanFromFile(const std::string& path, std::pmr::memory_resource* mr) {
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        std::cerr << "Hata: TOML dosyasi acilamadi: " << path << std::endl;
+        return std::nullopt;
     }
-    size_t last = str.find_last_not_of(" \t\n\r");
-    return str.substr(first, (last - first + 1));
-}
 
-static std::optional<double> parseDoubleValue(std::string line) {
-    size_t equalsPos = line.find('=');
-    if (equalsPos == std::string::npos) return std::nullopt;
+    std::pmr::vector<double> ranges(mr);
+    TomlScanStreamParser parser([&ranges](const LidarScan&, size_t, double range) {
+        ranges.push_back(range);
+    });
 
-    std::string valueStr = trim(line.substr(equalsPos + 1));
-    try {
-        return std::stod(valueStr);
-    } catch (...) {
-        return std::nullopt;
+    char chunk[64 * 1024];
+    size_t n = 0;
+    while ((n = std::fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        parser.feed(chunk, n);
     }
+    std::fclose(file);
+    parser.finish();
+
+    const LidarScan& h = parser.header();
+    return LidarScan{h.angle_min, h.angle_max, h.angle_increment, h.range_min, h.range_max, std::move(ranges)};
 }
 
-// ANA PARSER FONKSİYONU
-std::optional<LidarScan> loadScanFromFile(const std::string& path) {
+// [pose] tablosunun "anahtar = değer" satırları; diğer tablolar atlanır
+std::optional<SensorPose> loadPoseFromTruthFile(const std::string& path) {
     std::ifstream file(path);
-    if (!file.is_open()) {
-        std::cerr << "Hata: TOML dosyasi acilamadi: " << path << std::endl;
-        return std::nullopt;
-    }
+    if (!file) return std::nullopt;
 
-    LidarScan scan;
+    SensorPose pose;
+    bool inPose = false, found = false;
     std::string line;
-    bool inScanSection = false;
-    bool inRangesArray = false;
-
-    std::stringstream rangesStream;
-
     while (std::getline(file, line)) {
-        line = trim(line);
-
-        if (line.empty() || line[0] == '#') {
+        const size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#') continue;
+        if (line[first] == '[') {
+            inPose = line.compare(first, 6, "[pose]") == 0;
+            found = found || inPose;
             continue;
         }
-
-        if (line == "[scan]") {
-            inScanSection = true;
-            continue;
-        } else if (line[0] == '[') {
-            inScanSection = false;
-            inRangesArray = false;
-            continue;
-        }
-
-        if (inRangesArray) {
-            size_t endPos = line.find(']');
-            if (endPos != std::string::npos) {
-                inRangesArray = false;
-                rangesStream << line.substr(0, endPos);
-            } else {
-                rangesStream << line << " ";
-            }
-            continue;
-        }
-
-        if (inScanSection) {
-            if (line.rfind("angle_min", 0) == 0) {
-                scan.angle_min = parseDoubleValue(line).value_or(0.0);
-            } else if (line.rfind("angle_max", 0) == 0) {
-                scan.angle_max = parseDoubleValue(line).value_or(0.0);
-            } else if (line.rfind("angle_increment", 0) == 0) {
-                scan.angle_increment = parseDoubleValue(line).value_or(0.0);
-            } else if (line.rfind("range_min", 0) == 0) {
-                scan.range_min = parseDoubleValue(line).value_or(0.0);
-            } else if (line.rfind("range_max", 0) == 0) {
-                scan.range_max = parseDoubleValue(line).value_or(0.0);
-            } else if (line.rfind("ranges", 0) == 0) {
-                inRangesArray = true;
-                size_t startPos = line.find('[');
-                size_t endPos = line.find(']');
-
-                if (startPos != std::string::npos) {
-                    std::string segment = line.substr(startPos + 1);
-
-                    if (endPos != std::string::npos && endPos > startPos) {
-                        segment = segment.substr(0, endPos - startPos - 1);
-                        inRangesArray = false;
-                    }
-                    rangesStream << segment << " ";
-                }
-            }
-        }
-    }
-
-    file.close();
-
-    std::string numStr;
-    double val;
-    std::string allRanges = rangesStream.str();
-    std::replace(allRanges.begin(), allRanges.end(), ',', ' ');
-
-    std::stringstream finalStream(allRanges);
-    while (finalStream >> val) {
-        scan.ranges.push_back(val);
+        const size_t eq = line.find('=');
+        if (!inPose || eq == std::string::npos) continue;
+
+        std::string key = line.substr(first, eq - first);
+        key.erase(key.find_last_not_of(" \t") + 1);
+        const double value = std::strtod(line.c_str() + eq + 1, nullptr);
+        if (key == "x") pose.x = value;
+        else if (key == "y") pose.y = value;
+        else if (key == "yaw") pose.yaw = value;
     }
-
-
-    return scan;
-}
\ No newline at end of file
+    if (!found) return std::nullopt;
+    return pose;
+}
@@ -1,7 +1,15 @@
 #pragma once
 
+#include "model/scene.hpp"
 #include "model/types.hpp"
 #include <string>
 #include <optional>
 
-std::optional<LidarScan> loadScanFromFile(const std::string& path);
\ No newline at end of file
+// ranges dizisi mr'den ayrılır
+std::optional<LidarScan> loadScanFromFile(
+    const std::string& path,
+    std::pmr::memory_resource* mr = std::pmr::get_default_resource()
+);
+
+// Yer gerçeği dosyasının (saveGroundTruthToFile) [pose] tablosu; dosya ya da tablo yoksa nullopt
+std::optional<SensorPose> loadPoseFromTruthFile(const std::string& path);
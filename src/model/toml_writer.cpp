@@ -0,0 +1,93 @@
+#include "toml_writer.hpp"
+#include <charconv>
+#include <fstream>
+#include <iostream>
+
+// YARDIMCI FONKSİYONLAR
+// En kısa, geri dönüşümlü (round-trip) ondalık gösterim
+static void appendNumber(std::string& out, double value) {
+    char buf[32];
+    auto res = std::to_chars(buf, buf + sizeof(buf), value);
+    out.append(buf, res.ptr);
+}
+
+static void appendKey(std::string& out, const char* key, double value) {
+    out += key;
+    out += " = ";
+    appendNumber(out, value);
+    out += '\n';
+}
+
+std::string formatScanAsToml(const LidarScan& scan) {
+    std::string out;
+    out.reserve(128 + scan.ranges.size() * 8);
+
+    out += "[scan]\n";
+    appendKey(out, "angle_min", scan.angle_min);
+    appendKey(out, "angle_max", scan.angle_max);
+    appendKey(out, "angle_increment", scan.angle_increment);
+    out += '\n';
+    appendKey(out, "range_min", scan.range_min);
+    appendKey(out, "range_max", scan.range_max);
+    out += '\n';
+
+    // Satır başına 10 değer (örnek veri dosyalarıyla aynı düzen)
+    out += "ranges = [\n";
+    for (size_t i = 0; i < scan.ranges.size(); ++i) {
+        if (i % 10 == 0) out += "    ";
+        appendNumber(out, scan.ranges[i]);
+        if (i + 1 < scan.ranges.size()) out += ',';
+        out += (i % 10 == 9 || i + 1 == scan.ranges.size()) ? '\n' : ' ';
+    }
+    out += "]\n";
+
+    return out;
+}
+
+static bool writeText(const std::string& path, const std::string& text) {
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Hata: TOML dosyasi yazilamadi: " << path << std::endl;
+        return false;
+    }
+
+    file.write(text.data(), static_cast<std::streamsize>(text.size()));
+    return static_cast<bool>(file);
+}
+
+bool saveScanToFile(const std::string& path, const LidarScan& scan) {
+    return writeText(path, formatScanAsToml(scan));
+}
+
+std::string formatGroundTruthAsToml(const GroundTruth& truth, const SensorPose& pose) {
+    std::string out;
+    out.reserve(256 + truth.walls.size() * 96 + truth.corners.size() * 96);
+
+    out += "[pose]\n";
+    appendKey(out, "x", pose.x);
+    appendKey(out, "y", pose.y);
+    appendKey(out, "yaw", pose.yaw);
+
+    for (const auto& w : truth.walls) {
+        out += "\n[[wall]]\n";
+        appendKey(out, "x1", w.wall.a.x);
+        appendKey(out, "y1", w.wall.a.y);
+        appendKey(out, "x2", w.wall.b.x);
+        appendKey(out, "y2", w.wall.b.y);
+        appendKey(out, "hits", static_cast<double>(w.hits));
+    }
+
+    for (const auto& c : truth.corners) {
+        out += "\n[[corner]]\n";
+        appendKey(out, "x", c.position.x);
+        appendKey(out, "y", c.position.y);
+        appendKey(out, "angle_deg", c.angleDeg);
+        appendKey(out, "distance", c.distanceToRobot);
+    }
+
+    return out;
+}
+
+bool saveGroundTruthToFile(const std::string& path, const GroundTruth& truth, const SensorPose& pose) {
+    return writeText(path, formatGroundTruthAsToml(truth, pose));
+}
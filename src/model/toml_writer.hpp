@@ -0,0 +1,15 @@
+#pragma once
+
+#include "model/scene.hpp"
+#include "model/types.hpp"
+#include <string>
+
+// LidarScan -> TOML metni ([scan] bölümü, loadScanFromFile ile geri okunabilir)
+std::string formatScanAsToml(const LidarScan& scan);
+
+bool saveScanToFile(const std::string& path, const LidarScan& scan);
+
+// Sentetik sahnenin yer gerçeği: [pose], [[wall]] ve [[corner]] tabloları (sensör çerçevesi)
+std::string formatGroundTruthAsToml(const GroundTruth& truth, const SensorPose& pose);
+
+bool saveGroundTruthToFile(const std::string& path, const GroundTruth& truth, const SensorPose& pose);
@@ -1,39 +1,75 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
 #include <vector>
 #include <string>
 
+// Model tipleri skaler tipe (float / double) göre şablondur; model fonksiyonları
+// her iki hassasiyet için de derlenir. Varsayılan adlar double sürümlerdir.
+
 // 2D Kartezyen nokta
-struct Point {
-    double x = 0.0;
-    double y = 0.0;
+template <typename T>
+struct PointT {
+    T x = 0;
+    T y = 0;
+};
+
+// Bir nokta tamponunun ardışık bir bölümü (sahiplik yok)
+template <typename T>
+struct PointSpanT {
+    const PointT<T>* first = nullptr;
+    size_t count = 0;
+
+    const PointT<T>* begin() const { return first; }
+    const PointT<T>* end() const { return first + count; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const PointT<T>& operator[](size_t i) const { return first[i]; }
 };
 
 // Ax + By + C = 0 şeklinde bir doğru denklemi
-struct Line {
-    double A = 0.0;
-    double B = 0.0;
-    double C = 0.0;
+template <typename T>
+struct LineT {
+    T A = 0;
+    T B = 0;
+    T C = 0;
 
-    // Bu doğruyu oluşturan RANSAC inlier noktaları
-    std::vector<Point> inlierPoints;
+    // Bu doğruya atanan inlier noktaları, taramanın ortak nokta tamponunda
+    // [inlierOffset, inlierOffset + inlierCount) aralığıdır (findLinesRANSAC tamponu buna göre sıralar).
+    // Nokta kopyası tutulmaz; doğru kopyalamak / taşımak sabit maliyetlidir.
+    uint32_t inlierOffset = 0;
+    uint32_t inlierCount = 0;
 
     // Doğru parçasının (küçültülmüş) başlangıç ve bitiş noktaları
-    Point startPoint;
-    Point endPoint;
+    PointT<T> startPoint;
+    PointT<T> endPoint;
+
+    // points: bu doğruyu üreten findLinesRANSAC çağrısına verilen tampon
+    PointSpanT<T> inliers(const std::pmr::vector<PointT<T>>& points) const {
+        return {points.data() + inlierOffset, inlierCount};
+    }
+};
+
+template <typename T>
+struct LidarScanT {
+    T angle_min = 0;
+    T angle_max = 0;
+    T angle_increment = 0;
+    T range_min = 0;
+    T range_max = 0;
+    std::pmr::vector<T> ranges;
 };
 
-struct LidarScan {
-    double angle_min = 0.0;
-    double angle_max = 0.0;
-    double angle_increment = 0.0;
-    double range_min = 0.0;
-    double range_max = 0.0;
-    std::vector<double> ranges;
+template <typename T>
+struct IntersectionT {
+    PointT<T> position;
+    T angleDeg = 0;
+    T distanceToRobot = 0;
 };
 
-struct Intersection {
-    Point position;
-    double angleDeg = 0.0;
-    double distanceToRobot = 0.0;
-};
\ No newline at end of file
+using Point        = PointT<double>;
+using Line         = LineT<double>;
+using LidarScan    = LidarScanT<double>;
+using Intersection = IntersectionT<double>;
@@ -0,0 +1,69 @@
+// Global operator new / delete kancaları (yalnızca LIDAR_ALLOC_PROFILE=ON, proje_calistir).
+// Her bloğun önüne boyut ve ayıran aşamayı tutan bir başlık konur; delete bunu okuyup
+// sayaçları ayıran aşamadan düşer (boyutsuz delete'te de boyut bilinir).
+#include "utils/alloc_profiler.hpp"
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+struct BlockHeader {
+    size_t size;
+    AllocStage stage;
+};
+
+// Başlık alanı: hizalı isteklerde hizanın katı, kullanıcı göstericisi hizalı kalır
+constexpr size_t kHeader = alignof(std::max_align_t);
+static_assert(sizeof(BlockHeader) <= kHeader, "blok basligi sigmiyor");
+
+void* allocate(size_t n, size_t align) {
+    const size_t offset = align > kHeader ? align : kHeader;
+    const size_t total = offset + (n ? n : 1);
+    void* base = align > kHeader ? std::aligned_alloc(align, (total + align - 1) / align * align)
+                                 : std::malloc(total);
+    if (!base) return nullptr;
+
+    const AllocStage stage = AllocProfiler::currentStage();
+    char* user = static_cast<char*>(base) + offset;
+    *reinterpret_cast<BlockHeader*>(user - sizeof(BlockHeader)) = BlockHeader{n, stage};
+    AllocProfiler::recordAlloc(stage, n);
+    return user;
+}
+
+void release(void* p, size_t align) {
+    if (!p) return;
+    const size_t offset = align > kHeader ? align : kHeader;
+    char* user = static_cast<char*>(p);
+    const BlockHeader h = *reinterpret_cast<BlockHeader*>(user - sizeof(BlockHeader));
+    AllocProfiler::recordFree(h.stage, h.size);
+    std::free(user - offset);
+}
+
+void* allocateOrThrow(size_t n, size_t align) {
+    if (void* p = allocate(n, align)) return p;
+    throw std::bad_alloc();
+}
+
+} // namespace
+
+void* operator new(size_t n) { return allocateOrThrow(n, 0); }
+void* operator new[](size_t n) { return allocateOrThrow(n, 0); }
+void* operator new(size_t n, const std::nothrow_t&) noexcept { return allocate(n, 0); }
+void* operator new[](size_t n, const std::nothrow_t&) noexcept { return allocate(n, 0); }
+void* operator new(size_t n, std::align_val_t al) { return allocateOrThrow(n, static_cast<size_t>(al)); }
+void* operator new[](size_t n, std::align_val_t al) { return allocateOrThrow(n, static_cast<size_t>(al)); }
+void* operator new(size_t n, std::align_val_t al, const std::nothrow_t&) noexcept { return allocate(n, static_cast<size_t>(al)); }
+void* operator new[](size_t n, std::align_val_t al, const std::nothrow_t&) noexcept { return allocate(n, static_cast<size_t>(al)); }
+
+void operator delete(void* p) noexcept { release(p, 0); }
+void operator delete[](void* p) noexcept { release(p, 0); }
+void operator delete(void* p, size_t) noexcept { release(p, 0); }
+void operator delete[](void* p, size_t) noexcept { release(p, 0); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { release(p, 0); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { release(p, 0); }
+void operator delete(void* p, std::align_val_t al) noexcept { release(p, static_cast<size_t>(al)); }
+void operator delete[](void* p, std::align_val_t al) noexcept { release(p, static_cast<size_t>(al)); }
+void operator delete(void* p, size_t, std::align_val_t al) noexcept { release(p, static_cast<size_t>(al)); }
+void operator delete[](void* p, size_t, std::align_val_t al) noexcept { release(p, static_cast<size_t>(al)); }
+void operator delete(void* p, std::align_val_t al, const std::nothrow_t&) noexcept { release(p, static_cast<size_t>(al)); }
+void operator delete[](void* p, std::align_val_t al, const std::nothrow_t&) noexcept { release(p, static_cast<size_t>(al)); }
@@ -0,0 +1,142 @@
+#include "alloc_profiler.hpp"
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <sys/resource.h>
+
+namespace {
+
+struct StageCounters {
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> frees{0};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<int64_t> live{0};
+    std::atomic<int64_t> peak{0};
+    std::atomic<uint64_t> arenaAllocations{0};
+    std::atomic<uint64_t> arenaBytes{0};
+};
+
+StageCounters g_stages[kAllocStageCount];
+std::atomic<int64_t> g_live{0};
+std::atomic<int64_t> g_peak{0};
+
+thread_local AllocStage t_stage = AllocStage::Other;
+
+void raisePeak(std::atomic<int64_t>& peak, int64_t value) {
+    int64_t seen = peak.load(std::memory_order_relaxed);
+    while (value > seen && !peak.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {
+    }
+}
+
+} // namespace
+
+const char* allocStageName(AllocStage stage) {
+    switch (stage) {
+        case AllocStage::Read:      return "read";
+        case AllocStage::Prefilter: return "prefilter";
+        case AllocStage::Ransac:    return "ransac";
+        case AllocStage::Intersect: return "intersect";
+        case AllocStage::Output:    return "output";
+        default:                    return "other";
+    }
+}
+
+namespace AllocProfiler {
+
+AllocStage currentStage() {
+    return t_stage;
+}
+
+AllocStage setStage(AllocStage stage) {
+    AllocStage previous = t_stage;
+    t_stage = stage;
+    return previous;
+}
+
+void recordAlloc(AllocStage stage, size_t bytes) {
+    StageCounters& c = g_stages[static_cast<size_t>(stage)];
+    const auto n = static_cast<int64_t>(bytes);
+    c.allocations.fetch_add(1, std::memory_order_relaxed);
+    c.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    raisePeak(c.peak, c.live.fetch_add(n, std::memory_order_relaxed) + n);
+    raisePeak(g_peak, g_live.fetch_add(n, std::memory_order_relaxed) + n);
+}
+
+void recordFree(AllocStage stage, size_t bytes) {
+    StageCounters& c = g_stages[static_cast<size_t>(stage)];
+    const auto n = static_cast<int64_t>(bytes);
+    c.frees.fetch_add(1, std::memory_order_relaxed);
+    c.live.fetch_sub(n, std::memory_order_relaxed);
+    g_live.fetch_sub(n, std::memory_order_relaxed);
+}
+
+void recordArena(AllocStage stage, size_t bytes) {
+    StageCounters& c = g_stages[static_cast<size_t>(stage)];
+    c.arenaAllocations.fetch_add(1, std::memory_order_relaxed);
+    c.arenaBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+AllocProfile snapshot() {
+    AllocProfile p;
+    for (size_t s = 0; s < kAllocStageCount; ++s) {
+        const StageCounters& c = g_stages[s];
+        p.stages[s].allocations = c.allocations.load(std::memory_order_relaxed);
+        p.stages[s].frees = c.frees.load(std::memory_order_relaxed);
+        p.stages[s].bytes = c.bytes.load(std::memory_order_relaxed);
+        p.stages[s].liveBytes = c.live.load(std::memory_order_relaxed);
+        p.stages[s].peakLiveBytes = c.peak.load(std::memory_order_relaxed);
+        p.stages[s].arenaAllocations = c.arenaAllocations.load(std::memory_order_relaxed);
+        p.stages[s].arenaBytes = c.arenaBytes.load(std::memory_order_relaxed);
+    }
+    p.peakLiveBytes = g_peak.load(std::memory_order_relaxed);
+
+    struct rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        p.peakRssKb = usage.ru_maxrss; // Linux: KiB
+    }
+    return p;
+}
+
+void reset() {
+    // Canlı bloklar sayılmaya devam eder: yalnızca sayaçlar ve tepe değerler sıfırlanır
+    for (auto& c : g_stages) {
+        c.allocations.store(0, std::memory_order_relaxed);
+        c.frees.store(0, std::memory_order_relaxed);
+        c.bytes.store(0, std::memory_order_relaxed);
+        c.arenaAllocations.store(0, std::memory_order_relaxed);
+        c.arenaBytes.store(0, std::memory_order_relaxed);
+        c.peak.store(c.live.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    g_peak.store(g_live.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+std::string toJson(const AllocProfile& profile) {
+    std::string out = "{\"schema\":\"lidar-alloc/1\",\"stages\":[";
+    char buf[384];
+    for (size_t s = 0; s < kAllocStageCount; ++s) {
+        const AllocStageStats& st = profile.stages[s];
+        std::snprintf(buf, sizeof(buf),
+                      "%s{\"stage\":\"%s\",\"allocations\":%llu,\"frees\":%llu,\"bytes\":%llu,"
+                      "\"live_bytes\":%lld,\"peak_live_bytes\":%lld,\"arena_allocations\":%llu,\"arena_bytes\":%llu}",
+                      s == 0 ? "" : ",", allocStageName(static_cast<AllocStage>(s)),
+                      static_cast<unsigned long long>(st.allocations), static_cast<unsigned long long>(st.frees),
+                      static_cast<unsigned long long>(st.bytes), static_cast<long long>(st.liveBytes),
+                      static_cast<long long>(st.peakLiveBytes), static_cast<unsigned long long>(st.arenaAllocations),
+                      static_cast<unsigned long long>(st.arenaBytes));
+        out += buf;
+    }
+    std::snprintf(buf, sizeof(buf), "],\"peak_live_bytes\":%lld,\"peak_rss_kb\":%ld}\n",
+                  static_cast<long long>(profile.peakLiveBytes), profile.peakRssKb);
+    out += buf;
+    return out;
+}
+
+bool saveJson(const std::string& path, const AllocProfile& profile) {
+    std::ofstream f(path, std::ios::binary);
+    if (!f) return false;
+    const std::string json = toJson(profile);
+    f.write(json.data(), static_cast<std::streamsize>(json.size()));
+    return static_cast<bool>(f);
+}
+
+} // namespace AllocProfiler
@@ -0,0 +1,80 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Heap profili: global operator new / delete kancaları (utils/alloc_hooks.cpp) her ayırmayı
+// o an çalışan akış aşamasına yazar. Kancalar yalnızca -DLIDAR_ALLOC_PROFILE=ON ile
+// proje_calistir'a bağlanır; varsayılan derlemede aşama kapsamları boş makrodur.
+//
+// Aşama iş parçacığına özeldir: füzyon okuyucuları ve arka plan çıktı yazıcısı kendi
+// kapsamlarını açar. Bırakılan bellek, onu ayıran aşamanın canlı baytından düşülür.
+//
+// Tarama tamponları ScanArena'nın önceden ayrılmış bloğundan gelir ve heap kancalarına
+// görünmez; arena her isteği o anki aşamaya ayrıca arena kullanımı olarak yazar.
+enum class AllocStage : uint8_t { Other, Read, Prefilter, Ransac, Intersect, Output, Count };
+
+constexpr size_t kAllocStageCount = static_cast<size_t>(AllocStage::Count);
+
+const char* allocStageName(AllocStage stage);
+
+struct AllocStageStats {
+    uint64_t allocations = 0;
+    uint64_t frees = 0;
+    uint64_t bytes = 0;          // Toplam ayrılan
+    int64_t liveBytes = 0;       // Anlık görüntüde hâlâ ayrılı
+    int64_t peakLiveBytes = 0;
+    uint64_t arenaAllocations = 0;   // ScanArena'dan istenen (taşıp heap'e gidenler dahil)
+    uint64_t arenaBytes = 0;
+};
+
+struct AllocProfile {
+    AllocStageStats stages[kAllocStageCount];
+    int64_t peakLiveBytes = 0;   // Tüm aşamalar birlikte
+    long peakRssKb = 0;          // Süreç en yüksek RSS (getrusage)
+};
+
+namespace AllocProfiler {
+    // Kancalar bu derlemede açıksa true
+    constexpr bool enabled() {
+#ifdef LIDAR_ALLOC_PROFILE
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    AllocStage currentStage();
+    AllocStage setStage(AllocStage stage);   // Öncekini döndürür
+
+    // Kancalardan çağrılır: kilitsiz, ayırma yapmaz
+    void recordAlloc(AllocStage stage, size_t bytes);
+    void recordFree(AllocStage stage, size_t bytes);
+    void recordArena(AllocStage stage, size_t bytes);
+
+    AllocProfile snapshot();
+    void reset();
+
+    // Şema "lidar-alloc/1"
+    std::string toJson(const AllocProfile& profile);
+    bool saveJson(const std::string& path, const AllocProfile& profile);
+}
+
+// Kapsam süresince bu iş parçacığının ayırmaları stage'e yazılır
+class AllocStageScope {
+public:
+    explicit AllocStageScope(AllocStage stage) : m_previous(AllocProfiler::setStage(stage)) {}
+    ~AllocStageScope() { AllocProfiler::setStage(m_previous); }
+
+    AllocStageScope(const AllocStageScope&) = delete;
+    AllocStageScope& operator=(const AllocStageScope&) = delete;
+
+private:
+    AllocStage m_previous;
+};
+
+#ifdef LIDAR_ALLOC_PROFILE
+#define LIDAR_ALLOC_STAGE(stage) AllocStageScope lidarAllocStageScope(AllocStage::stage)
+#else
+#define LIDAR_ALLOC_STAGE(stage) ((void)0)
+#endif
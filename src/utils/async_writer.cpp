@@ -0,0 +1,86 @@
+#include "utils/async_writer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iostream>
+
+AsyncWriter::AsyncWriter(size_t capacity, QueuePolicy policy)
+    : m_capacity(std::max<size_t>(capacity, 1)),
+      m_policy(policy),
+      m_worker([this] { workerLoop(); })
+{
+}
+
+AsyncWriter::~AsyncWriter() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_hasWork.notify_one();
+    m_worker.join(); // İşçi kuyruğu boşaltmadan çıkmaz
+}
+
+void AsyncWriter::submit(Job job) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    ++m_stats.submitted;
+
+    if (m_policy == QueuePolicy::LatestOnly) {
+        m_stats.dropped += m_queue.size();
+        m_queue.clear();
+    } else if (m_queue.size() >= m_capacity) {
+        if (m_policy == QueuePolicy::DropOldest) {
+            m_queue.pop_front();
+            ++m_stats.dropped;
+        } else {
+            const auto t0 = std::chrono::steady_clock::now();
+            m_hasSpace.wait(lock, [this] { return m_queue.size() < m_capacity; });
+            m_stats.blockedSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        }
+    }
+
+    m_queue.push_back(std::move(job));
+    lock.unlock();
+    m_hasWork.notify_one();
+}
+
+void AsyncWriter::flush() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    const auto t0 = std::chrono::steady_clock::now();
+    m_idle.wait(lock, [this] { return m_queue.empty() && !m_busy; });
+    m_stats.drainSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+AsyncWriter::Stats AsyncWriter::stats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+void AsyncWriter::workerLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_hasWork.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+        if (m_queue.empty()) {
+            return; // Durduruldu ve iş kalmadı
+        }
+
+        Job job = std::move(m_queue.front());
+        m_queue.pop_front();
+        m_busy = true;
+        lock.unlock();
+        m_hasSpace.notify_one();
+
+        try {
+            job();
+        } catch (const std::exception& e) {
+            std::cerr << "[!] Cikti yazilamadi: " << e.what() << "\n";
+        }
+        job = nullptr; // Yakalanan sonuçlar (ve arenaları) kilit dışında serbest bırakılır
+
+        lock.lock();
+        m_busy = false;
+        ++m_stats.written;
+        if (m_queue.empty()) {
+            m_idle.notify_all();
+        }
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// Kuyruk doluyken yeni iş geldiğinde:
+//   Block      - üretici yer açılana kadar bekler (hiçbir çıktı kaybolmaz)
+//   DropOldest - en eski bekleyen iş atılır
+//   LatestOnly - yalnızca en yeni iş bekler; her gönderim öncekini değiştirir
+enum class QueuePolicy { Block, DropOldest, LatestOnly };
+
+// Çıktı işlerini (SVG, raster, rapor) analiz iş parçacığından alıp arka planda sırayla
+// çalıştıran sınırlı kuyruk. İşler taşınarak (move) alınır; yıkıcı kalan tüm işleri bitirir.
+class AsyncWriter {
+public:
+    using Job = std::function<void()>;
+
+    struct Stats {
+        size_t submitted = 0;
+        size_t written = 0;
+        size_t dropped = 0;
+        double blockedSeconds = 0.0; // Üreticinin dolu kuyrukta beklediği toplam süre
+        double drainSeconds = 0.0;   // flush() içinde bekleme
+    };
+
+    AsyncWriter(size_t capacity, QueuePolicy policy);
+    ~AsyncWriter();
+
+    AsyncWriter(const AsyncWriter&) = delete;
+    AsyncWriter& operator=(const AsyncWriter&) = delete;
+
+    void submit(Job job);
+
+    // Kuyruk boşalıp son iş bitene kadar bekler
+    void flush();
+
+    Stats stats() const;
+
+private:
+    void workerLoop();
+
+    const size_t m_capacity;
+    const QueuePolicy m_policy;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_hasWork;
+    std::condition_variable m_hasSpace;
+    std::condition_variable m_idle;
+    std::deque<Job> m_queue;
+    bool m_busy = false;
+    bool m_stopping = false;
+    Stats m_stats;
+
+    std::thread m_worker; // Son üye: diğer alanlar hazır olduktan sonra başlar
+};
@@ -1,4 +1,5 @@
 #include "utils/cli.hpp"
+#include "utils/alloc_profiler.hpp"
 #include <iostream>
 #include <sstream>
 #include <vector>
@@ -41,21 +42,74 @@ static bool parse_size(const std::string& s, int& w, int& h) {
     return parse_int(sw, w) && parse_int(sh, h);
 }
 
+// "<yol>@x,y,yaw_derece" -> kaynak + montaj (yaw radyana çevrilir)
+static bool parse_sensor(const std::string& s, SensorSource& out) {
+    auto at = s.rfind('@');
+    if (at == std::string::npos || at == 0) return false;
+
+    std::vector<double> v;
+    std::stringstream ss(s.substr(at + 1));
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        double d = 0.0;
+        if (!parse_double(item, d)) return false;
+        v.push_back(d);
+    }
+    if (v.size() != 3) return false;
+
+    out.path = s.substr(0, at);
+    out.mount = SensorMount{v[0], v[1], v[2] * 3.14159265358979323846 / 180.0};
+    return true;
+}
+
 void print_cli_help(const char* exe) {
     std::cout
       << "Usage:\n  " << exe << " [--input <pathOrUrl>] [<pathOrUrl>] [options]\n\n"
       << "Required:\n"
-      << "  -i, --input <pathOrUrl>      TOML dosya yolu veya URL\n"
+      << "  -i, --input <pathOrUrl>      TOML / ikili tarama dosyasi, FIFO yolu, URL veya '-' (stdin)\n"
       << "                               (Eger flag kullanilmazsa ilk arguman olarak da verilebilir)\n\n"
+      << "Coklu Sensor (--input yerine):\n"
+      << "      --sensor <yol>@x,y,yaw   Sensor kaynagi ve arac cercevesinde montaji (m, m, derece); tekrarlanabilir\n"
+      << "      --sync-wait <ms>         Eksik sensor icin en fazla bekleme (default: " << CliParams{}.syncWaitMs << ")\n"
+      << "      --sync-skew <ms>         En yeni taramadan daha eski taramalar atilir, 0 = kapali (default: " << CliParams{}.syncSkewMs << ")\n\n"
       << "RANSAC / Geometri:\n"
       << "      --epsilon <m>            RANSAC mesafe esigi (default: " << CliParams{}.epsilon << ")\n"
       << "      --min-inliers <n>        RANSAC min inlier (default: " << CliParams{}.minInliers << ")\n"
       << "      --max-iters <n>          RANSAC iter sayisi (default: " << CliParams{}.maxIters << ")\n"
-      << "      --angle-thresh <deg>     Dogru cifti aci esigi (default: " << CliParams{}.angleThreshDeg << ")\n\n"
+      << "      --angle-thresh <deg>     Dogru cifti aci esigi (default: " << CliParams{}.angleThreshDeg << ")\n"
+      << "      --seed <n>               RANSAC tohumu, 0 = saat (default: " << CliParams{}.seed << ")\n"
+      << "      --precision <p>          float | double (default: double)\n"
+      << "      --sector-beams <n>       Taramayi n isinlik sektorler halinde geldikce isle, 0 = kapali (default: " << CliParams{}.sectorBeams << ")\n"
+      << "      --sector-min-points <n>  Daha az noktali sektorde RANSAC calistirma, 0 = 2 * min-inliers (default: " << CliParams{}.sectorMinPoints << ")\n"
+      << "      --parallel-sectors <n>   Bulutu n acisal sektorde paralel RANSAC'la isle, 0 = kapali (default: " << CliParams{}.parallelSectors << ")\n"
+      << "      --threads <n>            Paralel RANSAC is parcacigi, 0 = donanim (default: " << CliParams{}.threads << ")\n\n"
+      << "Aykiri Deger On Filtresi:\n"
+      << "      --outlier-window <n>     Her yonde n komsu isinla karsilastir, 0 = kapali (default: " << CliParams{}.outlierWindow << ")\n"
+      << "      --outlier-support <n>    Isini tutmak icin gereken destekleyen komsu (default: " << CliParams{}.outlierSupport << ")\n"
+      << "      --outlier-tol <m>        Komsu range farki toleransi (default: " << CliParams{}.outlierTol << ")\n"
+      << "      --outlier-slope <s>      Egik yuzey ek toleransi, s * r * aci_artisi * k (default: " << CliParams{}.outlierSlope << ")\n\n"
+      << "Seyreltme (RANSAC oncesi):\n"
+      << "      --voxel <m>              Hucre boyu; her hucre tek noktaya iner, 0 = kapali (default: " << CliParams{}.voxelSize << ")\n"
+      << "                               (dogru basina nokta azalir: --min-inliers buna gore secilmeli)\n"
+      << "      --voxel-policy <p>       centroid | first (default: centroid)\n"
+      << "      --max-points <n>         Seyreltme sonrasi nokta ust siniri, 0 = sinirsiz (default: " << CliParams{}.maxPoints << ")\n\n"
       << "SVG Cikti:\n"
       << "      --out-svg <path>         SVG cikti yolu (default: " << CliParams{}.outSvg << ")\n"
       << "      --svg-size <WxH>         Or: 1200x900 (default: " << CliParams{}.svgWidth << "x" << CliParams{}.svgHeight << ")\n"
-      << "      --svg-margin <px>        Kenar bosluk px (default: " << CliParams{}.svgMargin << ")\n\n"
+      << "      --svg-margin <px>        Kenar bosluk px (default: " << CliParams{}.svgMargin << ")\n"
+      << "      --svg-backend <b>        buffered | stream (default: buffered)\n"
+      << "      --svg-lod <n>            n noktadan fazlasinda piksel hucreli cizim, 0 = kapali (default: " << CliParams{}.svgLodThreshold << ")\n\n"
+      << "Sonuc Ciktisi:\n"
+      << "      --out-json <path>        Dogrular, kesisimler ve asama sureleri (JSON)\n"
+      << "      --out-bin <path>         Ayni icerik, uzunluk onekli ikili kayit (LRES)\n"
+      << "  -q, --quiet                  Konsol raporlarini yazdirma\n"
+      << "      --alloc-json <path>      Asama basina heap profili (JSON); -DLIDAR_ALLOC_PROFILE=ON derlemesi gerekir\n\n"
+      << "Cikti Asamasi:\n"
+      << "      --async-output           SVG / raster / raporu arka planda yaz\n"
+      << "      --output-queue <n>       Bekleyen cikti sayisi (default: " << CliParams{}.outputQueue << ")\n"
+      << "      --output-policy <p>      block | drop-oldest | latest (default: block)\n\n"
+      << "Raster Cikti:\n"
+      << "      --out-raster <path>      PGM (.pgm, gri) / PPM (renkli) goruntu; SVG ile ayni boyut ve eksenler\n\n"
       << "  -h, --help                   Bu yardimi goster\n";
 }
 
@@ -67,7 +121,8 @@ std::optional<CliParams> parse_cli(int argc, char* argv[]) {
 
 
     bool first_positional_used = false;
-    if (argc >= 2 && argv[1][0] != '-') {
+    // Tek başına "-" bayrak değil, stdin girdisidir
+    if (argc >= 2 && (argv[1][0] != '-' || std::string(argv[1]) == "-")) {
         p.inputPath = argv[1];
         first_positional_used = true;
     }
@@ -89,6 +144,26 @@ std::optional<CliParams> parse_cli(int argc, char* argv[]) {
             if (i + 1 >= argc) { std::cerr << "[!] " << a << " deger bekliyor\n"; return std::nullopt; }
             p.inputPath = argv[++i];
         }
+        else if (a == "--sensor") {
+            SensorSource src;
+            if (i + 1 >= argc || !parse_sensor(argv[i+1], src)) {
+                std::cerr << "[!] --sensor <yol>@x,y,yaw (ornegin data/on.toml@0.8,0,0)\n"; return std::nullopt;
+            }
+            p.sensors.push_back(src);
+            ++i;
+        }
+        else if (a == "--sync-wait") {
+            if (i + 1 >= argc || !parse_int(argv[i+1], p.syncWaitMs) || p.syncWaitMs < 0) {
+                std::cerr << "[!] --sync-wait <ms>\n"; return std::nullopt;
+            }
+            ++i;
+        }
+        else if (a == "--sync-skew") {
+            if (i + 1 >= argc || !parse_double(argv[i+1], p.syncSkewMs) || p.syncSkewMs < 0) {
+                std::cerr << "[!] --sync-skew <ms>\n"; return std::nullopt;
+            }
+            ++i;
+        }
         else if (a == "--epsilon") {
             if (i + 1 >= argc || !parse_double(argv[i+1], p.epsilon)) {
                 std::cerr << "[!] --epsilon <double>\n"; return std::nullopt;
@@ -113,6 +188,98 @@ std::optional<CliParams> parse_cli(int argc, char* argv[]) {
             }
             ++i;
         }
+        else if (a == "--seed") {
+            int seed = 0;
+            if (i + 1 >= argc || !parse_int(argv[i+1], seed) || seed < 0) {
+                std::cerr << "[!] --seed <int>\n"; return std::nullopt;
+            }
+            p.seed = static_cast<uint32_t>(seed);
+            ++i;
+        }
+        else if (a == "--precision") {
+            std::string v = i + 1 < argc ? argv[i+1] : "";
+            if (v != "float" && v != "double") {
+                std::cerr << "[!] --precision float|double\n"; return std::nullopt;
+            }
+            p.precision = v == "float" ? Precision::Float : Precision::Double;
+            ++i;
+        }
+        else if (a == "--sector-beams") {
+            int n = 0;
+            if (i + 1 >= argc || !parse_int(argv[i+1], n) || n < 0) {
+                std::cerr << "[!] --sector-beams <n>\n"; return std::nullopt;
+            }
+            p.sectorBeams = static_cast<size_t>(n);
+            ++i;
+        }
+        else if (a == "--sector-min-points") {
+            int n = 0;
+            if (i + 1 >= argc || !parse_int(argv[i+1], n) || n < 0) {
+                std::cerr << "[!] --sector-min-points <n>\n"; return std::nullopt;
+            }
+            p.sectorMinPoints = static_cast<size_t>(n);
+            ++i;
+        }
+        else if (a == "--parallel-sectors") {
+            int n = 0;
+            if (i + 1 >= argc || !parse_int(argv[i+1], n) || n < 0) {
+                std::cerr << "[!] --parallel-sectors <n>\n"; return std::nullopt;
+            }
+            p.parallelSectors = static_cast<size_t>(n);
+            ++i;
+        }
+        else if (a == "--threads") {
+            if (i + 1 >= argc || !parse_int(argv[i+1], p.threads) || p.threads < 0) {
+                std::cerr << "[!] --threads <n>\n"; return std::nullopt;
+            }
+            ++i;
+        }
+        else if (a == "--outlier-window") {
+            if (i + 1 >= argc || !parse_int(argv[i+1], p.outlierWindow) || p.outlierWindow < 0 || p.outlierWindow > 16) {
+                std::cerr << "[!] --outlier-window <n> (0..16)\n"; return std::nullopt;
+            }
+            ++i;
+        }
+        else if (a == "--outlier-support") {
+            if (i + 1 >= argc || !parse_int(argv[i+1], p.outlierSupport) || p.outlierSupport < 0) {
+                std::cerr << "[!] --outlier-support <n>\n"; return std::nullopt;
+            }
+            ++i;
+        }
+        else if (a == "--outlier-tol") {
+            if (i + 1 >= argc || !parse_double(argv[i+1], p.outlierTol) || p.outlierTol < 0) {
+                std::cerr << "[!] --outlier-tol <m>\n"; return std::nullopt;
+            }
+            ++i;
+        }
+        else if (a == "--outlier-slope") {
+            if (i + 1 >= argc || !parse_double(argv[i+1], p.outlierSlope) || p.outlierSlope < 0) {
+                std::cerr << "[!] --outlier-slope <s>\n"; return std::nullopt;
+            }
+            ++i;
+        }
+        else if (a == "--voxel") {
+            if (i + 1 >= argc || !parse_double(argv[i+1], p.voxelSize) || p.voxelSize < 0) {
+                std::cerr << "[!] --voxel <m>\n"; return std::nullopt;
+            }
+            ++i;
+        }
+        else if (a == "--voxel-policy") {
+            std::string v = i + 1 < argc ? argv[i+1] : "";
+            if (v != "centroid" && v != "first") {
+                std::cerr << "[!] --voxel-policy centroid|first\n"; return std::nullopt;
+            }
+            p.voxelPolicy = v == "first" ? VoxelPolicy::First : VoxelPolicy::Centroid;
+            ++i;
+        }
+        else if (a == "--max-points") {
+            int n = 0;
+            if (i + 1 >= argc || !parse_int(argv[i+1], n) || n < 0) {
+                std::cerr << "[!] --max-points <n>\n"; return std::nullopt;
+            }
+            p.maxPoints = static_cast<size_t>(n);
+            ++i;
+        }
 
         // --- Parametreler ---
         else if (a == "--out-svg") {
@@ -131,6 +298,63 @@ std::optional<CliParams> parse_cli(int argc, char* argv[]) {
             }
             ++i;
         }
+        else if (a == "--svg-backend") {
+            std::string v = i + 1 < argc ? argv[i+1] : "";
+            if (v != "buffered" && v != "stream") {
+                std::cerr << "[!] --svg-backend buffered|stream\n"; return std::nullopt;
+            }
+            p.svgStream = v == "stream";
+            ++i;
+        }
+        else if (a == "--out-json") {
+            if (i + 1 >= argc) { std::cerr << "[!] --out-json <path>\n"; return std::nullopt; }
+            p.outJson = argv[++i];
+        }
+        else if (a == "--out-bin") {
+            if (i + 1 >= argc) { std::cerr << "[!] --out-bin <path>\n"; return std::nullopt; }
+            p.outBin = argv[++i];
+        }
+        else if (a == "--alloc-json") {
+            if (i + 1 >= argc) { std::cerr << "[!] --alloc-json <path>\n"; return std::nullopt; }
+            if (!AllocProfiler::enabled()) {
+                std::cerr << "[!] --alloc-json icin -DLIDAR_ALLOC_PROFILE=ON ile derleyin.\n"; return std::nullopt;
+            }
+            p.outAllocJson = argv[++i];
+        }
+        else if (a == "-q" || a == "--quiet") {
+            p.quiet = true;
+        }
+        else if (a == "--async-output") {
+            p.asyncOutput = true;
+        }
+        else if (a == "--output-queue") {
+            int n = 0;
+            if (i + 1 >= argc || !parse_int(argv[i+1], n) || n < 1) {
+                std::cerr << "[!] --output-queue <n> (n >= 1)\n"; return std::nullopt;
+            }
+            p.outputQueue = static_cast<size_t>(n);
+            ++i;
+        }
+        else if (a == "--output-policy") {
+            std::string v = i + 1 < argc ? argv[i+1] : "";
+            if (v == "block") p.outputPolicy = QueuePolicy::Block;
+            else if (v == "drop-oldest") p.outputPolicy = QueuePolicy::DropOldest;
+            else if (v == "latest") p.outputPolicy = QueuePolicy::LatestOnly;
+            else { std::cerr << "[!] --output-policy block|drop-oldest|latest\n"; return std::nullopt; }
+            ++i;
+        }
+        else if (a == "--out-raster") {
+            if (i + 1 >= argc) { std::cerr << "[!] --out-raster <path>\n"; return std::nullopt; }
+            p.outRaster = argv[++i];
+        }
+        else if (a == "--svg-lod") {
+            int n = 0;
+            if (i + 1 >= argc || !parse_int(argv[i+1], n) || n < 0) {
+                std::cerr << "[!] --svg-lod <n>\n"; return std::nullopt;
+            }
+            p.svgLodThreshold = static_cast<size_t>(n);
+            ++i;
+        }
 
         else {
             std::cerr << "[!] Bilinmeyen veya hatali arguman: " << a << "\n\n";
@@ -139,7 +363,42 @@ std::optional<CliParams> parse_cli(int argc, char* argv[]) {
         }
     }
 
-    if (p.inputPath.empty()) {
+    if (!p.inputPath.empty() && !p.sensors.empty()) {
+        std::cerr << "[!] --input ve --sensor birlikte kullanilamaz.\n";
+        return std::nullopt;
+    }
+
+    if (p.sectorBeams > 0 && !p.sensors.empty()) {
+        std::cerr << "[!] --sector-beams tek sensorlu girdi (--input) ile kullanilir.\n";
+        return std::nullopt;
+    }
+
+    if (p.sectorBeams > 0 && (p.voxelSize > 0 || p.maxPoints > 0)) {
+        std::cerr << "[!] --voxel / --max-points sektor moduyla (--sector-beams) kullanilamaz.\n";
+        return std::nullopt;
+    }
+
+    if (p.sectorBeams > 0 && p.parallelSectors > 0) {
+        std::cerr << "[!] --parallel-sectors ve --sector-beams birlikte kullanilamaz.\n";
+        return std::nullopt;
+    }
+
+    if (p.sectorBeams > 0 && p.outlierWindow > 0) {
+        std::cerr << "[!] --outlier-window sektor moduyla (--sector-beams) kullanilamaz.\n";
+        return std::nullopt;
+    }
+
+    if (p.outlierSupport > 2 * p.outlierWindow && p.outlierWindow > 0) {
+        std::cerr << "[!] --outlier-support en fazla 2 * --outlier-window olabilir.\n";
+        return std::nullopt;
+    }
+
+    if (p.maxPoints > 0 && p.voxelSize <= 0) {
+        std::cerr << "[!] --max-points icin --voxel <m> gerekli.\n";
+        return std::nullopt;
+    }
+
+    if (p.inputPath.empty() && p.sensors.empty()) {
         std::cerr << "[!] Girdi dosyasi (--input) belirtilmedi.\n\n";
         print_cli_help(argv[0]);
         return std::nullopt;
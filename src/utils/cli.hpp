@@ -1,22 +1,72 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string>
+#include <vector>
+#include "model/downsample.hpp"
+#include "model/fusion.hpp"
+#include "model/outlier_filter.hpp"
+#include "utils/async_writer.hpp"
+
+// Model katmanının skaler tipi
+enum class Precision { Double, Float };
+
+// Çoklu sensör girdisi: kaynak ve araç çerçevesindeki montaj
+struct SensorSource {
+    std::string path;
+    SensorMount mount;
+};
 
 struct CliParams {
     // Girdi / çıktı
     std::string inputPath;
     std::string outSvg   = "data/output1.svg";
+    std::string outRaster;        // Boş değilse .pgm / .ppm raster çıktı
+    std::string outJson;          // Boş değilse yapılandırılmış sonuçlar (JSON)
+    std::string outBin;           // Boş değilse yapılandırılmış sonuçlar (uzunluk önekli ikili)
+    bool quiet           = false; // Konsol raporlarını tamamen atla
+    std::string outAllocJson;     // Boş değilse aşama başına heap profili (LIDAR_ALLOC_PROFILE)
+
+    // Füzyon: boş değilse inputPath yerine bu kaynaklar tek bulutta birleştirilir
+    std::vector<SensorSource> sensors;
+    int    syncWaitMs    = 1000;  // Eksik sensör için en fazla bekleme
+    double syncSkewMs    = 0.0;   // 0: zaman kayması denetimi yok
 
     // RANSAC / Geometri
     double epsilon       = 0.02;
     int    minInliers    = 8;
     int    maxIters      = 2000;
     double angleThreshDeg= 60.0;
+    uint32_t seed        = 0;     // 0: saat tabanlı
+    Precision precision  = Precision::Double;
+    size_t sectorBeams   = 0;     // 0: tam tarama; >0: ışınlar geldikçe sektör sektör işlenir
+    size_t sectorMinPoints = 0;   // Daha az noktalı sektör son geçişe kalır; 0: 2 * minInliers
+    size_t parallelSectors = 0;   // 0: tek iş parçacıklı RANSAC; >0: açısal sektörlerde paralel
+    int    threads       = 0;     // Paralel RANSAC iş parçacığı, 0: donanım
+
+    // Tarama sırası aykırı değer ön filtresi (nokta dönüşümünden önce)
+    int    outlierWindow = 0;     // 0: kapalı; >0: her yönde karşılaştırılan komşu ışın
+    int    outlierSupport = OutlierFilterParams{}.minSupport;
+    double outlierTol    = OutlierFilterParams{}.rangeTolerance;
+    double outlierSlope  = OutlierFilterParams{}.grazingSlope;
+
+    // RANSAC öncesi voxel seyreltme
+    double voxelSize     = 0.0;   // 0: kapalı
+    VoxelPolicy voxelPolicy = VoxelPolicy::Centroid;
+    size_t maxPoints     = 0;     // 0: sınırsız (voxel açıkken)
+
+    // Çıktı aşaması: açıksa SVG / raster / rapor arka plan iş parçacığında yazılır
+    bool asyncOutput     = false;
+    size_t outputQueue   = 2;
+    QueuePolicy outputPolicy = QueuePolicy::Block;
 
     // SVG görünüm
     int svgWidth  = 1200;
     int svgHeight = 900;
     int svgMargin = 40;
+    bool svgStream = false;   // true: eski ofstream yazıcısı
+    size_t svgLodThreshold = 50000; // 0: LOD kapalı
 };
 
 std::optional<CliParams> parse_cli(int argc, char* argv[]);
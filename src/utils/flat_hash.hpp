@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// uint64_t anahtarlı açık adresli tablo: Fibonacci karması (üst bitler indeks), doğrusal
+// yoklama, 2'nin kuvveti boyut, yük oranı <= 0.5. Silme yoktur; clear() kuşak damgasını
+// artırır, tablo belleği korunur (kare / tarama başına yeniden kullanım için).
+// Büyüme değerlere işaretçileri geçersiz kılar.
+template <typename V>
+class FlatHashMap {
+public:
+    explicit FlatHashMap(size_t capacity = 16) { reserve(capacity / 2); }
+
+    size_t size() const { return m_size; }
+    size_t capacity() const { return m_slots.size(); }
+
+    // Yük oranı 0.5'i aşmadan n anahtar sığacak kadar büyütür; küçültmez
+    void reserve(size_t n) {
+        size_t capacity = 16;
+        unsigned bits = 4;
+        while (capacity < 2 * n) {
+            capacity <<= 1;
+            ++bits;
+        }
+        if (capacity > m_slots.size()) rehash(capacity, bits);
+    }
+
+    // Tüm anahtarları siler
+    void clear() {
+        m_size = 0;
+        if (++m_generation == 0) {
+            // Damga taştı: tek seferlik temizlik
+            for (auto& s : m_slots) s.generation = 0;
+            m_generation = 1;
+        }
+    }
+
+    // Yoksa nullptr
+    V* find(uint64_t key) {
+        const size_t mask = m_slots.size() - 1;
+        size_t i = index(key);
+        while (m_slots[i].generation == m_generation) {
+            if (m_slots[i].key == key) return &m_slots[i].value;
+            i = (i + 1) & mask;
+        }
+        return nullptr;
+    }
+
+    const V* find(uint64_t key) const { return const_cast<FlatHashMap*>(this)->find(key); }
+
+    // Anahtar yoksa V{} ile eklenir; second: yeni eklendi mi
+    std::pair<V*, bool> tryEmplace(uint64_t key) {
+        // Tek yoklama: anahtar varsa da yük sınırında önce büyür
+        if (2 * (m_size + 1) > m_slots.size()) reserve(m_size + 1);
+        const size_t mask = m_slots.size() - 1;
+        size_t i = index(key);
+        while (m_slots[i].generation == m_generation) {
+            if (m_slots[i].key == key) return {&m_slots[i].value, false};
+            i = (i + 1) & mask;
+        }
+
+        Slot& s = m_slots[i];
+        s.key = key;
+        s.value = V{};
+        s.generation = m_generation;
+        ++m_size;
+        return {&s.value, true};
+    }
+
+    // Dolu yuvalar üzerinde f(key, value&); sıra tanımsız
+    template <typename F>
+    void forEach(F&& f) {
+        for (auto& s : m_slots) {
+            if (s.generation == m_generation) f(s.key, s.value);
+        }
+    }
+
+private:
+    struct Slot {
+        uint64_t key = 0;
+        V value{};
+        uint32_t generation = 0;   // != m_generation: boş
+    };
+
+    size_t index(uint64_t key) const {
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> m_shift);
+    }
+
+    size_t freeSlot(uint64_t key) const {
+        const size_t mask = m_slots.size() - 1;
+        size_t i = index(key);
+        while (m_slots[i].generation == m_generation) i = (i + 1) & mask;
+        return i;
+    }
+
+    void rehash(size_t capacity, unsigned bits) {
+        std::vector<Slot> old(capacity);
+        old.swap(m_slots);
+        m_shift = 64 - bits;
+        const uint32_t live = m_generation;
+        m_generation = 1;
+        for (auto& s : old) {
+            if (s.generation != live) continue;
+            Slot& d = m_slots[freeSlot(s.key)];
+            d.key = s.key;
+            d.value = std::move(s.value);
+            d.generation = m_generation;
+        }
+    }
+
+    std::vector<Slot> m_slots;
+    unsigned m_shift = 64;
+    uint32_t m_generation = 1;
+    size_t m_size = 0;
+};
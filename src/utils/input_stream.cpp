@@ -0,0 +1,138 @@
+#include "utils/input_stream.hpp"
+#include <cstdio>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#define popen _popen
+#define pclose _pclose
+#else
+#include <cerrno>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+extern char** environ;
+#endif
+
+bool isUrlSource(const std::string& source) {
+    return source.rfind("http://", 0) == 0 || source.rfind("https://", 0) == 0;
+}
+
+static void drain(std::FILE* f, const std::function<void(const char*, size_t)>& onChunk) {
+    char chunk[64 * 1024];
+    size_t n = 0;
+    while ((n = std::fread(chunk, 1, sizeof(chunk), f)) > 0) {
+        onChunk(chunk, n);
+    }
+}
+
+static std::string downloadError(const std::string& source) {
+    return "Dosya indirilemedi: " + source + " | Lutfen URL'yi veya internet baglantinizi kontrol edin.";
+}
+
+// curl kabuk olmadan çalıştırılır: URL tek argv öğesidir, içindeki $(...) / `...` yorumlanmaz.
+// -f: HTTP hata kodlarında gövde yazılmaz ve çıkış kodu sıfırdan farklı olur
+#ifdef _WIN32
+static bool readUrl(const std::string& source,
+                    const std::function<void(const char*, size_t)>& onChunk,
+                    std::string& error) {
+    // cmd.exe üzerinden: tırnak içinde bile yorumlanan karakterler reddedilir
+    if (source.find_first_of("\"%^&|<>!`$\r\n") != std::string::npos) {
+        error = "URL desteklenmeyen karakter iceriyor: " + source;
+        return false;
+    }
+    const std::string command = "curl -f -L -s -- \"" + source + "\"";
+    std::FILE* pipe = popen(command.c_str(), "rb");
+    if (!pipe) {
+        error = "curl baslatilamadi";
+        return false;
+    }
+    drain(pipe, onChunk);
+    if (pclose(pipe) != 0) {
+        error = downloadError(source);
+        return false;
+    }
+    return true;
+}
+#else
+static bool readUrl(const std::string& source,
+                    const std::function<void(const char*, size_t)>& onChunk,
+                    std::string& error) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        error = "curl baslatilamadi";
+        return false;
+    }
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, fds[1], STDOUT_FILENO);
+    posix_spawn_file_actions_addclose(&actions, fds[0]);
+    posix_spawn_file_actions_addclose(&actions, fds[1]);
+
+    std::string url = source;
+    char arg0[] = "curl", f[] = "-f", l[] = "-L", s[] = "-s", end[] = "--";
+    char* argv[] = {arg0, f, l, s, end, url.data(), nullptr};
+    pid_t pid = 0;
+    const int rc = posix_spawnp(&pid, "curl", &actions, nullptr, argv, environ);
+    posix_spawn_file_actions_destroy(&actions);
+    close(fds[1]);
+    if (rc != 0) {
+        close(fds[0]);
+        error = "curl baslatilamadi";
+        return false;
+    }
+
+    std::FILE* pipe = fdopen(fds[0], "r");
+    if (pipe) {
+        drain(pipe, onChunk);
+        std::fclose(pipe);
+    } else {
+        close(fds[0]);
+    }
+
+    int status = 0;
+    while (waitpid(pid, &status, 0) < 0 && errno == EINTR) {}
+    if (!pipe || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        error = downloadError(source);
+        return false;
+    }
+    return true;
+}
+#endif
+
+bool readInputChunks(
+    const std::string& source,
+    const std::function<void(const char* data, size_t size)>& onChunk,
+    std::string& error)
+{
+    if (source == "-") {
+#ifdef _WIN32
+        _setmode(_fileno(stdin), _O_BINARY);
+#endif
+        drain(stdin, onChunk);
+        if (std::ferror(stdin)) {
+            error = "stdin okunamadi";
+            return false;
+        }
+        return true;
+    }
+
+    if (isUrlSource(source)) {
+        return readUrl(source, onChunk, error);
+    }
+
+    std::FILE* file = std::fopen(source.c_str(), "rb");
+    if (!file) {
+        error = "Girdi acilamadi: " + source;
+        return false;
+    }
+    drain(file, onChunk);
+    const bool failed = std::ferror(file) != 0;
+    std::fclose(file);
+    if (failed) {
+        error = "Girdi okunamadi: " + source;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <string>
+
+// Girdi kaynağını sabit boyutlu parçalar halinde okur ve her parçayı onChunk'a verir:
+//   "-"            -> stdin (kayıt cihazı vb. üreticiden boru)
+//   http(s)://...  -> curl çıktısı boru ile okunur (geçici dosya yok)
+//   diğer          -> dosya yolu (adlandırılmış boru / FIFO dahil)
+// Hata durumunda false döner, error doldurulur.
+bool readInputChunks(
+    const std::string& source,
+    const std::function<void(const char* data, size_t size)>& onChunk,
+    std::string& error
+);
+
+bool isUrlSource(const std::string& source);
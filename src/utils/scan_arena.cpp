@@ -0,0 +1,80 @@
+#include "utils/scan_arena.hpp"
+#include "utils/alloc_profiler.hpp"
+#include <algorithm>
+
+void* ScanArena::CountingResource::do_allocate(size_t n, size_t align) {
+    ++allocations;
+    bytes += n;
+    if constexpr (AllocProfiler::enabled()) {
+        if (profiled) AllocProfiler::recordArena(AllocProfiler::currentStage(), n);
+    }
+    return upstream->allocate(n, align);
+}
+
+void ScanArena::CountingResource::do_deallocate(void* p, size_t n, size_t align) {
+    upstream->deallocate(p, n, align);
+}
+
+ScanArena::ScanArena(size_t initialBytes)
+    : m_capacity(std::max<size_t>(initialBytes, 4096)),
+      m_buffer(new std::byte[m_capacity])
+{
+    m_arena.emplace(m_buffer.get(), m_capacity, &m_upstream);
+    m_front.upstream = &*m_arena;
+    m_front.profiled = true;
+}
+
+void ScanArena::reset() {
+    // Önce arena yok edilir: upstream'den alınan bloklar iade edilir
+    m_arena.reset();
+
+    if (m_upstream.bytes > 0) {
+        // Toplam kullanımın 2 katına büyüt: benzer boyutta taramalar artık sığar
+        m_capacity = 2 * (m_capacity + m_upstream.bytes);
+        m_buffer.reset(new std::byte[m_capacity]);
+    }
+
+    m_upstream.allocations = 0;
+    m_upstream.bytes = 0;
+    m_front.allocations = 0;
+    m_front.bytes = 0;
+    m_arena.emplace(m_buffer.get(), m_capacity, &m_upstream);
+}
+
+ScanArenaPool::ScanArenaPool(size_t initialBytes)
+    : m_initialBytes(initialBytes),
+      m_state(std::make_shared<State>())
+{
+}
+
+std::shared_ptr<ScanArena> ScanArenaPool::acquire() {
+    std::unique_ptr<ScanArena> arena;
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        if (!m_state->idle.empty()) {
+            arena = std::move(m_state->idle.back());
+            m_state->idle.pop_back();
+        }
+    }
+    if (arena) {
+        arena->reset();
+    } else {
+        arena = std::make_unique<ScanArena>(m_initialBytes);
+    }
+
+    // Silici arenayı yok etmek yerine havuza geri koyar (kilit, yazıcı iş parçacığındaki
+    // son kullanım ile sonraki acquire() arasında sıralamayı sağlar)
+    std::weak_ptr<State> weak = m_state;
+    return std::shared_ptr<ScanArena>(arena.release(), [weak](ScanArena* a) {
+        std::unique_ptr<ScanArena> owned(a);
+        if (auto state = weak.lock()) {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->idle.push_back(std::move(owned));
+        }
+    });
+}
+
+size_t ScanArenaPool::idleCount() const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->idle.size();
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+// Tarama başına geçici bellek: tüm ara tamponlar tek bir monotonic arenadan ayrılır,
+// tarama bitince reset() ile topluca geri alınır.
+// Arena bir taramada taştıysa (upstream'e gittiyse) bir sonraki reset() tamponu büyütür;
+// böylece ısınmadan sonra kararlı durumda tarama başına heap ayırması sıfırdır.
+class ScanArena {
+public:
+    explicit ScanArena(size_t initialBytes = size_t{1} << 20);
+
+    ScanArena(const ScanArena&) = delete;
+    ScanArena& operator=(const ScanArena&) = delete;
+
+    std::pmr::memory_resource* resource() { return &m_front; }
+
+    // Önceki taramanın tüm ayırmalarını geçersiz kılar
+    void reset();
+
+    size_t capacity() const { return m_capacity; }
+
+    // Son reset()'ten beri arenadan istenen ayırma sayısı / bayt (taşanlar dahil)
+    size_t allocations() const { return m_front.allocations; }
+    size_t usedBytes() const { return m_front.bytes; }
+
+    // Son reset()'ten beri arenanın heap'e (upstream) gittiği ayırma sayısı / bayt
+    size_t overflowAllocations() const { return m_upstream.allocations; }
+    size_t overflowBytes() const { return m_upstream.bytes; }
+
+private:
+    // upstream üzerine sayaç. profiled ise her ayırma heap profilinde o anki aşamaya arena
+    // kullanımı olarak da yazılır (arena bloğundan gelen bayt kancalara görünmez)
+    struct CountingResource : std::pmr::memory_resource {
+        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource();
+        bool profiled = false;
+        size_t allocations = 0;
+        size_t bytes = 0;
+
+        void* do_allocate(size_t n, size_t align) override;
+        void do_deallocate(void* p, size_t n, size_t align) override;
+        bool do_is_equal(const std::pmr::memory_resource& o) const noexcept override { return this == &o; }
+    };
+
+    size_t m_capacity;
+    std::unique_ptr<std::byte[]> m_buffer;
+    CountingResource m_upstream;    // Arenanın heap'e taşan blokları
+    std::optional<std::pmr::monotonic_buffer_resource> m_arena;
+    CountingResource m_front;       // resource(): arenadan istenen her şey
+};
+
+// Asenkron çıktıda bir taramanın sonuçları yazılana kadar arenası canlı kalmalı.
+// acquire() sıfırlanmış bir arena verir; son shared_ptr kopyası bırakıldığında arena
+// havuza döner. Kararlı durumda yeni arena ayrılmaz (en fazla kuyruk derinliği + 2 arena).
+class ScanArenaPool {
+public:
+    explicit ScanArenaPool(size_t initialBytes = size_t{1} << 20);
+
+    std::shared_ptr<ScanArena> acquire();
+
+    // Havuzda bekleyen (kullanılmayan) arena sayısı
+    size_t idleCount() const;
+
+private:
+    struct State {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<ScanArena>> idle;
+    };
+
+    size_t m_initialBytes;
+    std::shared_ptr<State> m_state; // Dışarıdaki arenalar havuzdan uzun yaşayabilir
+};
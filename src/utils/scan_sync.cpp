@@ -0,0 +1,86 @@
+#include "utils/scan_sync.hpp"
+#include <algorithm>
+
+ScanSynchronizer::ScanSynchronizer(size_t sensors, double maxSkewSeconds, std::chrono::milliseconds maxWait)
+    : m_maxSkew(maxSkewSeconds),
+      m_maxWait(maxWait),
+      m_slots(sensors)
+{
+}
+
+void ScanSynchronizer::push(size_t sensor, double stamp, std::shared_ptr<const LidarScan> scan) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (sensor >= m_slots.size()) return;
+
+        Slot& slot = m_slots[sensor];
+        if (slot.scan) {
+            ++m_stats.overwritten;
+        }
+        slot.scan = std::move(scan);
+        slot.stamp = stamp;
+        if (!m_firstArrival) {
+            m_firstArrival = Clock::now();
+        }
+    }
+    m_changed.notify_all();
+}
+
+void ScanSynchronizer::close(size_t sensor) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (sensor < m_slots.size()) m_slots[sensor].closed = true;
+    }
+    m_changed.notify_all();
+}
+
+// Açık her sensörün bekleyen bir taraması var
+bool ScanSynchronizer::allReadyLocked() const {
+    return std::all_of(m_slots.begin(), m_slots.end(),
+                       [](const Slot& s) { return s.scan || s.closed; });
+}
+
+std::optional<ScanSynchronizer::Frame> ScanSynchronizer::next() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    // İlk tarama gelene kadar (ya da herkes kapanana kadar) süresiz bekle
+    m_changed.wait(lock, [this] { return m_firstArrival.has_value() || allReadyLocked(); });
+    if (!m_firstArrival) {
+        return std::nullopt; // Tüm sensörler kapandı, bekleyen yok
+    }
+
+    // Kalan sensörler için sınırlı bekleme
+    m_changed.wait_until(lock, *m_firstArrival + m_maxWait, [this] { return allReadyLocked(); });
+
+    Frame frame;
+    frame.scans.resize(m_slots.size());
+    double newest = -1e300;
+    for (const Slot& s : m_slots) {
+        if (s.scan) newest = std::max(newest, s.stamp);
+    }
+
+    for (size_t i = 0; i < m_slots.size(); ++i) {
+        Slot& s = m_slots[i];
+        if (!s.scan) continue;
+        if (newest - s.stamp > m_maxSkew) {
+            ++m_stats.skewDropped;
+        } else {
+            frame.scans[i] = s.scan;
+            ++frame.present;
+        }
+        s.scan.reset();
+    }
+    frame.stamp = newest;
+    m_firstArrival.reset();
+
+    ++m_stats.frames;
+    if (frame.present < m_slots.size()) {
+        ++m_stats.partialFrames;
+    }
+    return frame;
+}
+
+ScanSynchronizer::Stats ScanSynchronizer::stats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "model/types.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+// Birden çok sensörün taramalarını zaman damgasına göre kareler halinde gruplar.
+// Üreticiler hiç beklemez: sensör başına tek yuva vardır, tüketilmemiş tarama yenisiyle
+// değiştirilir. Tüketici bir kare için ilk taramanın gelişinden itibaren en fazla maxWait
+// bekler; o sürede gelmeyen sensörler ve en yeni taramadan maxSkew'den eski taramalar
+// o karede yer almaz (kare eksik sensörle işlenir, boru hattı tıkanmaz).
+class ScanSynchronizer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Frame {
+        std::vector<std::shared_ptr<const LidarScan>> scans; // Sensör sırası; nullptr = yok
+        double stamp = 0.0;   // Karedeki en yeni zaman damgası [s]
+        size_t present = 0;
+    };
+
+    struct Stats {
+        size_t frames = 0;
+        size_t partialFrames = 0; // En az bir sensörü eksik kareler
+        size_t skewDropped = 0;   // Zaman kayması nedeniyle atılan taramalar
+        size_t overwritten = 0;   // Tüketilmeden yenisi gelen taramalar
+    };
+
+    ScanSynchronizer(size_t sensors, double maxSkewSeconds, std::chrono::milliseconds maxWait);
+
+    // Üretici tarafı (her sensör kendi iş parçacığından çağırabilir)
+    void push(size_t sensor, double stamp, std::shared_ptr<const LidarScan> scan);
+
+    // Sensör artık veri göndermeyecek: kareler onu beklemez
+    void close(size_t sensor);
+
+    // Sıradaki kare; tüm sensörler kapalı ve bekleyen tarama yoksa nullopt
+    std::optional<Frame> next();
+
+    Stats stats() const;
+
+private:
+    struct Slot {
+        std::shared_ptr<const LidarScan> scan;
+        double stamp = 0.0;
+        bool closed = false;
+    };
+
+    bool allReadyLocked() const;
+
+    const double m_maxSkew;
+    const std::chrono::milliseconds m_maxWait;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_changed;
+    std::vector<Slot> m_slots;
+    std::optional<Clock::time_point> m_firstArrival; // Bekleyen karenin ilk taraması
+    Stats m_stats;
+};
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Tek yazar / çok okuyucu için kilitsiz anlık görüntü yayını (epoch tabanlı geri kazanım).
+//
+// Yazar beginWrite() ile geri kazanılmış (ya da yeni) bir nesneyi yerinde doldurur,
+// publish() tek atomik değiş tokuşla onu güncel yapar ve epoch'u bir artırır. Okuyucu read()
+// ile epoch'u kendi yuvasına yazar, güncel işaretçiyi alır ve epoch'un değişmediğini doğrular
+// (değiştiyse yeniden dener). Snapshot yaşadığı sürece nesne değişmez; kopya ya da kilit yoktur.
+//
+// Böylece epoch'u e olan okuyucu yalnızca e sırasında güncel olan (en çok iki) nesneden birini
+// tutabilir: [doğum, emeklilik) aralığında epoch'u olan etkin okuyucu kalmayan emekli nesne
+// yeniden kullanılır. Yazar hiç beklemez; yavaş okuyucu yalnızca bu nesneleri bekletir, havuz
+// en çok 2 x etkin okuyucu + 2 nesnede kalır.
+//
+// beginWrite / publish / stats yalnızca yazar iş parçacığından çağrılır. Reader tek iş
+// parçacığına aittir ve aynı anda tek Snapshot tutar; Reader'lar yayıncıdan önce yok edilmelidir.
+template <typename T>
+class SnapshotPublisher {
+    struct Node {
+        T value{};
+        uint64_t version = 0;
+        uint64_t birth = 0;     // Güncel olduğu ilk epoch (yalnızca yazar)
+    };
+
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> epoch{0};     // 0: okuma yok
+        std::atomic<bool> claimed{false};
+    };
+
+public:
+    static constexpr size_t kMaxReaders = 64;
+
+    struct Stats {
+        uint64_t published = 0;
+        size_t allocated = 0;   // Toplam ayrılan nesne (başlangıçtaki dahil)
+        size_t reused = 0;      // Geri kazanılıp yeniden doldurulan
+        size_t retired = 0;     // Okuyucu tuttuğu için henüz geri kazanılamayan
+    };
+
+    class Reader;
+
+    // Okuma süresince yayını sabitler; taşınabilir, kopyalanamaz
+    class Snapshot {
+    public:
+        Snapshot() = default;
+        Snapshot(Snapshot&& o) noexcept : m_reader(std::exchange(o.m_reader, nullptr)), m_node(o.m_node) {}
+        Snapshot& operator=(Snapshot&& o) noexcept {
+            if (this != &o) {
+                release();
+                m_reader = std::exchange(o.m_reader, nullptr);
+                m_node = o.m_node;
+            }
+            return *this;
+        }
+        ~Snapshot() { release(); }
+
+        const T& operator*() const { return m_node->value; }
+        const T* operator->() const { return &m_node->value; }
+        // Yayın sırası (1'den başlar; 0: henüz yayın yok, varsayılan nesne)
+        uint64_t version() const { return m_node->version; }
+
+    private:
+        friend class Reader;
+        Snapshot(Reader* reader, const Node* node) : m_reader(reader), m_node(node) {}
+        void release() {
+            if (m_reader) m_reader->m_slot->epoch.store(0, std::memory_order_release);
+            m_reader = nullptr;
+        }
+
+        Reader* m_reader = nullptr;
+        const Node* m_node = nullptr;
+    };
+
+    // Okuyucu yuvası; kurulumda bir kez alınır
+    class Reader {
+    public:
+        Reader(Reader&& o) noexcept : m_owner(std::exchange(o.m_owner, nullptr)), m_slot(o.m_slot) {}
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+        Reader& operator=(Reader&&) = delete;
+        ~Reader() {
+            if (m_owner) m_slot->claimed.store(false, std::memory_order_release);
+        }
+
+        // Yalnızca okuma sırasında yayın olursa yeniden dener (yazar ilerlemiş demektir)
+        Snapshot read() {
+            for (;;) {
+                const uint64_t e = m_owner->m_epoch.load(std::memory_order_seq_cst);
+                // Yuva yazımı işaretçi okumasından önce görünmeli (seq_cst: store -> load)
+                m_slot->epoch.store(e, std::memory_order_seq_cst);
+                const Node* node = m_owner->m_current.load(std::memory_order_seq_cst);
+                if (m_owner->m_epoch.load(std::memory_order_seq_cst) == e) return Snapshot(this, node);
+            }
+        }
+
+    private:
+        friend class SnapshotPublisher;
+        friend class Snapshot;
+        Reader(SnapshotPublisher* owner, Slot* slot) : m_owner(owner), m_slot(slot) {}
+
+        SnapshotPublisher* m_owner;
+        Slot* m_slot;
+    };
+
+    SnapshotPublisher() {
+        m_nodes.push_back(std::make_unique<Node>());
+        m_nodes.back()->birth = 1;
+        m_current.store(m_nodes.back().get(), std::memory_order_relaxed);
+        m_stats.allocated = 1;
+    }
+
+    SnapshotPublisher(const SnapshotPublisher&) = delete;
+    SnapshotPublisher& operator=(const SnapshotPublisher&) = delete;
+
+    // Boş yuva yoksa std::runtime_error
+    Reader reader() {
+        for (Slot& s : m_slots) {
+            bool expected = false;
+            if (!s.claimed.load(std::memory_order_relaxed) &&
+                s.claimed.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                return Reader(this, &s);
+            }
+        }
+        throw std::runtime_error("Anlik goruntu yayini: okuyucu yuvasi kalmadi");
+    }
+
+    // Yazılacak nesne: önceki bir yayının içeriğini taşır (kapasite korunur), tamamı üzerine
+    // yazılmalıdır. publish() çağrılana kadar aynı nesne döner.
+    T& beginWrite() {
+        if (!m_writing) {
+            reclaim();
+            if (!m_free.empty()) {
+                m_writing = m_free.back();
+                m_free.pop_back();
+                ++m_stats.reused;
+            } else {
+                m_nodes.push_back(std::make_unique<Node>());
+                m_writing = m_nodes.back().get();
+                ++m_stats.allocated;
+            }
+        }
+        return m_writing->value;
+    }
+
+    // beginWrite() ile doldurulan nesneyi yayınlar; bekleyen yazım yoksa etkisiz
+    void publish() {
+        if (!m_writing) return;
+        // Epoch'u yalnızca yazar değiştirir. Değiş tokuş ile artış arasında okuyan e = epoch
+        // okuyucusu iki nesneden birini görebilir: ikisinin aralığı da e'yi kapsar.
+        const uint64_t epoch = m_epoch.load(std::memory_order_relaxed);
+        m_writing->version = ++m_stats.published;
+        m_writing->birth = epoch;
+        Node* old = m_current.exchange(m_writing, std::memory_order_seq_cst);
+        m_epoch.store(epoch + 1, std::memory_order_seq_cst);
+        m_retired.push_back(Retired{old, epoch + 1});
+        m_writing = nullptr;
+        m_stats.retired = m_retired.size();
+    }
+
+    Stats stats() const { return m_stats; }
+
+private:
+    struct Retired {
+        Node* node;
+        uint64_t end;           // Güncel olduğu son epoch + 1
+    };
+
+    void reclaim() {
+        uint64_t active[kMaxReaders];
+        size_t count = 0;
+        for (const Slot& s : m_slots) {
+            const uint64_t e = s.epoch.load(std::memory_order_seq_cst);
+            if (e != 0) active[count++] = e;
+        }
+        size_t kept = 0;
+        for (const Retired& r : m_retired) {
+            bool held = false;
+            for (size_t i = 0; i < count && !held; ++i) {
+                held = active[i] >= r.node->birth && active[i] < r.end;
+            }
+            if (held) {
+                m_retired[kept++] = r;
+            } else {
+                m_free.push_back(r.node);
+            }
+        }
+        m_retired.resize(kept);
+        m_stats.retired = kept;
+    }
+
+    // Okuyucu tarafı
+    alignas(64) std::atomic<Node*> m_current{nullptr};
+    std::atomic<uint64_t> m_epoch{1};
+    Slot m_slots[kMaxReaders];
+
+    // Yazar tarafı
+    alignas(64) std::vector<std::unique_ptr<Node>> m_nodes;
+    std::vector<Node*> m_free;
+    std::vector<Retired> m_retired;
+    Node* m_writing = nullptr;
+    Stats m_stats;
+};
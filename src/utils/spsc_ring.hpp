@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+// Tek üretici / tek tüketici için kilitsiz, sınırlı halka tampon (sensör sürücüsü kuyruğu).
+// tryPush yalnızca üretici, tryPop yalnızca tüketici iş parçacığından çağrılır; ikisi de
+// beklemez. Sayaçlar taşana kadar monoton artar; indeks = sayaç & maske.
+// Her taraf karşı sayacın son okunan değerini önbellekte tutar: paylaşılan önbellek
+// satırına yalnızca halka dolu / boş göründüğünde gidilir.
+template <typename T>
+class SpscRing {
+public:
+    // Kapasite ikinin kuvvetine yukarı yuvarlanır (en az 2)
+    explicit SpscRing(size_t capacity) {
+        size_t n = 2;
+        while (n < capacity) n <<= 1;
+        m_mask = n - 1;
+        m_slots = std::make_unique<T[]>(n);
+    }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    // Doluysa false; değer yalnızca başarıda taşınır, doluysa çağıranda kalır
+    bool tryPush(T&& value) { return push(std::move(value)); }
+    bool tryPush(const T& value) { return push(value); }
+
+    // Boşsa false
+    bool tryPop(T& out) {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_cachedTail) {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if (head == m_cachedTail) return false;
+        }
+        out = std::move(m_slots[head & m_mask]);
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Eşzamanlı kullanımda yaklaşık değer
+    size_t size() const {
+        return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+    }
+
+    size_t capacity() const { return m_mask + 1; }
+
+private:
+    static constexpr size_t kCacheLine = 64;
+
+    template <typename U>
+    bool push(U&& value) {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_cachedHead > m_mask) {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if (tail - m_cachedHead > m_mask) return false;
+        }
+        m_slots[tail & m_mask] = std::forward<U>(value);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::unique_ptr<T[]> m_slots;
+    size_t m_mask = 0;
+
+    // Tüketici tarafı
+    alignas(kCacheLine) std::atomic<size_t> m_head{0};
+    size_t m_cachedTail = 0;
+
+    // Üretici tarafı
+    alignas(kCacheLine) std::atomic<size_t> m_tail{0};
+    size_t m_cachedHead = 0;
+};
@@ -4,45 +4,121 @@
 
 namespace ConsoleView {
 
+    // Çıktı iş parçacığı başlamadan önce bir kez ayarlanır
+    static bool s_quiet = false;
+
+    void setQuiet(bool quiet) {
+        s_quiet = quiet;
+    }
+
     void printControllerStart(const std::string& inputPath) {
+        if (s_quiet) return;
         std::cout << "Controller baslatildi.\n";
-        std::cout << "Okunacak dosya: " << inputPath << std::endl;
+        std::cout << "Okunacak dosya: " << inputPath << "\n";
     }
 
     void printAppRunning() {
+        if (s_quiet) return;
         std::cout << "Uygulama calisiyor...\n";
     }
 
     void printUrlDownload() {
-        std::cout << "[i] URL tespit edildi, indiriliyor...\n";
-    }
-
-    void printUrlDownloadFallback() {
-        std::cout << "[i] PowerShell basarisiz oldu, 'curl' ile deneniyor..." << std::endl;
+        if (s_quiet) return;
+        std::cout << "[i] URL tespit edildi, akis olarak okunuyor...\n";
     }
 
-    void printUrlDownloadSuccess(const std::string& localPath) {
-        std::cout << "[i] Dosya '" << localPath << "' olarak basariyla indirildi.\n";
+    void printUrlDownloadSuccess(const std::string& url) {
+        if (s_quiet) return;
+        std::cout << "[i] '" << url << "' akisi basariyla okundu.\n";
     }
 
     void printTomlResult(size_t rangeCount) {
-        std::cout << "TOML Parser: " << rangeCount << " adet 'range' degeri okundu." << std::endl;
+        if (s_quiet) return;
+        std::cout << "TOML Parser: " << rangeCount << " adet 'range' degeri okundu.\n";
     }
 
     void printFilterResult(size_t pointCount) {
-        std::cout << "Lidar Filtre: " << pointCount << " adet gecerli nokta bulundu." << std::endl;
+        if (s_quiet) return;
+        std::cout << "Lidar Filtre: " << pointCount << " adet gecerli nokta bulundu.\n";
+    }
+
+    void printFusionResult(size_t present, size_t sensors, size_t skewDropped) {
+        if (s_quiet) return;
+        std::cout << "Fuzyon: " << present << "/" << sensors << " sensor birlestirildi";
+        if (skewDropped > 0) {
+            std::cout << " (" << skewDropped << " tarama zaman kaymasi nedeniyle atildi)";
+        }
+        std::cout << ".\n";
+    }
+
+    void printSensorError(size_t sensor, const std::string& error) {
+        // Uyarı: sessiz kipte de gösterilir, kare eksik sensörle işlenir
+        std::cerr << "[!] Sensor #" << (sensor + 1) << " atlandi: " << error << "\n";
+    }
+
+    void printSectorResult(size_t sectors, size_t rawSegments, size_t stitched, size_t recovered,
+                           double firstIntersectionMs, double firstIntersectionLeadMs, double finishMs) {
+        if (s_quiet) return;
+        std::cout << "Sektor modu: " << sectors << " sektor, " << rawSegments << " parca, kalan noktalardan "
+                  << recovered << " parca daha (" << stitched << " tanesi birlestirildi).\n";
+        std::cout << std::fixed << std::setprecision(3);
+        if (firstIntersectionMs >= 0) {
+            std::cout << "  Ilk kesisim: son isindan " << firstIntersectionMs << " ms sonra";
+            if (firstIntersectionLeadMs > 0) {
+                std::cout << " (tarama bitmeden " << firstIntersectionLeadMs << " ms once)";
+            }
+            std::cout << "\n";
+        } else {
+            std::cout << "  Kesisim bulunamadi.\n";
+        }
+        std::cout << "  Son isindan nihai sonuca: " << finishMs << " ms\n";
+        std::cout.unsetf(std::ios::floatfield);
+        std::cout << std::setprecision(6);
+    }
+
+    void printParallelResult(size_t sectors, unsigned threads, size_t rawSegments, size_t merged, size_t dropped,
+                             size_t recovered) {
+        if (s_quiet) return;
+        std::cout << "Paralel RANSAC: " << sectors << " sektor, " << threads << " is parcacigi, "
+                  << rawSegments << " parca, kalan noktalardan " << recovered << " parca daha ("
+                  << merged << " tanesi birlestirildi, " << dropped
+                  << " tanesi yetersiz inlier nedeniyle atildi).\n";
+    }
+
+    void printOutlierResult(size_t validBeams, size_t removed, double filterMs) {
+        if (s_quiet) return;
+        const double fraction = validBeams > 0 ? 100.0 * static_cast<double>(removed) / static_cast<double>(validBeams) : 0.0;
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "Aykiri Filtre: " << removed << "/" << validBeams << " gecerli isin elendi (%"
+                  << std::setprecision(1) << fraction << std::setprecision(3) << "), " << filterMs << " ms\n";
+        std::cout.unsetf(std::ios::floatfield);
+        std::cout << std::setprecision(6);
+    }
+
+    void printDownsampleResult(size_t inputPoints, size_t cells, size_t outputPoints, double downsampleMs) {
+        if (s_quiet) return;
+        const double ratio = inputPoints > 0 ? static_cast<double>(outputPoints) / static_cast<double>(inputPoints) : 1.0;
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "Seyreltme: " << inputPoints << " -> " << outputPoints << " nokta ("
+                  << cells << " dolu hucre, oran " << ratio << "), " << downsampleMs << " ms\n";
+        std::cout.unsetf(std::ios::floatfield);
+        std::cout << std::setprecision(6);
     }
 
     void printRansacResult(size_t segmentCount) {
-        std::cout << "RANSAC (v2) tamamlandi. Toplam " << segmentCount << " adet dogru parcasi bulundu." << std::endl;
+        if (s_quiet) return;
+        std::cout << "RANSAC (v2) tamamlandi. Toplam " << segmentCount << " adet dogru parcasi bulundu.\n";
     }
 
     void printGeometryResult(size_t intersectionCount, double angleThresh) {
+        if (s_quiet) return;
         std::cout << "Geometri Analizi: Toplam " << intersectionCount
-                  << " adet gecerli ('" << angleThresh << " derece ustu') kesisim bulundu." << std::endl;
+                  << " adet gecerli ('" << angleThresh << " derece ustu') kesisim bulundu.\n";
     }
 
-    void printFinalReport(const std::vector<Intersection>& intersections) {
+    template <typename T>
+    void printFinalReport(const std::pmr::vector<IntersectionT<T>>& intersections) {
+        if (s_quiet) return;
         std::cout << "--- Kesisim Raporu ---\n";
         // Raporu yazdır
         for (size_t i = 0; i < intersections.size(); ++i) {
@@ -53,11 +129,58 @@ namespace ConsoleView {
         }
     }
 
+    template void printFinalReport(const std::pmr::vector<IntersectionT<float>>&);
+    template void printFinalReport(const std::pmr::vector<IntersectionT<double>>&);
+
     void printSvgSuccess(const std::string& outputPath) {
+        if (s_quiet) return;
         std::cout << "[i] SVG ciktisi su dosyaya kaydedildi: " << outputPath << "\n";
     }
 
+    void printRasterSuccess(const std::string& outputPath) {
+        if (s_quiet) return;
+        std::cout << "[i] Raster cikti su dosyaya kaydedildi: " << outputPath << "\n";
+    }
+
+    void printOutputStats(size_t submitted, size_t written, size_t dropped,
+                          double blockedSeconds, double drainSeconds) {
+        if (s_quiet) return;
+        std::cout << "[i] Asenkron cikti: " << written << "/" << submitted << " yazildi, "
+                  << dropped << " atildi | kuyrukta bekleme: " << blockedSeconds * 1000.0
+                  << " ms, kapanista bosaltma: " << drainSeconds * 1000.0 << " ms\n";
+    }
+
+    void printResultSuccess(const std::string& outputPath) {
+        if (s_quiet) return;
+        std::cout << "[i] Sonuclar su dosyaya kaydedildi: " << outputPath << "\n";
+    }
+
+    void printAllocProfile(const AllocProfile& profile) {
+        if (s_quiet) return;
+        auto kb = [](int64_t bytes) { return static_cast<double>(bytes) / 1024.0; };
+        std::cout << "--- Heap Profili (asama basina) ---\n";
+        std::cout << std::left << std::setw(10) << "asama" << std::right
+                  << std::setw(10) << "ayirma" << std::setw(10) << "birakma"
+                  << std::setw(14) << "toplam_kb" << std::setw(12) << "canli_kb" << std::setw(12) << "tepe_kb"
+                  << std::setw(14) << "arena_ayirma" << std::setw(12) << "arena_kb" << "\n";
+        std::cout << std::fixed << std::setprecision(1);
+        for (size_t s = 0; s < kAllocStageCount; ++s) {
+            const AllocStageStats& st = profile.stages[s];
+            if (st.allocations == 0 && st.arenaAllocations == 0) continue;
+            std::cout << std::left << std::setw(10) << allocStageName(static_cast<AllocStage>(s)) << std::right
+                      << std::setw(10) << st.allocations << std::setw(10) << st.frees
+                      << std::setw(14) << kb(static_cast<int64_t>(st.bytes)) << std::setw(12) << kb(st.liveBytes)
+                      << std::setw(12) << kb(st.peakLiveBytes) << std::setw(14) << st.arenaAllocations
+                      << std::setw(12) << kb(static_cast<int64_t>(st.arenaBytes)) << "\n";
+        }
+        std::cout << "Tepe canli heap: " << kb(profile.peakLiveBytes) << " KiB, tepe RSS: "
+                  << profile.peakRssKb << " KiB\n";
+        std::cout.unsetf(std::ios::floatfield);
+        std::cout << std::setprecision(6);
+    }
+
     void printAppComplete() {
+        if (s_quiet) return;
         std::cout << "Uygulama tamamlandi.\n";
     }
 
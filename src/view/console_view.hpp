@@ -3,21 +3,38 @@
 #include <string>
 #include <vector>
 #include "model/types.hpp"
+#include "utils/alloc_profiler.hpp"
 
 
 namespace ConsoleView {
 
+    // Sessiz kipte tüm print* çağrıları biçimlendirme yapmadan döner (hatalar std::cerr'e yine yazılır)
+    void setQuiet(bool quiet);
+
     void printControllerStart(const std::string& inputPath);
     void printAppRunning();
     void printUrlDownload();
-    void printUrlDownloadFallback();
-    void printUrlDownloadSuccess(const std::string& localPath);
+    void printUrlDownloadSuccess(const std::string& url);
     void printTomlResult(size_t rangeCount);
     void printFilterResult(size_t pointCount);
+    void printFusionResult(size_t present, size_t sensors, size_t skewDropped);
+    void printSensorError(size_t sensor, const std::string& error);
+    void printSectorResult(size_t sectors, size_t rawSegments, size_t stitched, size_t recovered,
+                           double firstIntersectionMs, double firstIntersectionLeadMs, double finishMs);
+    void printParallelResult(size_t sectors, unsigned threads, size_t rawSegments, size_t merged, size_t dropped,
+                             size_t recovered);
+    void printOutlierResult(size_t validBeams, size_t removed, double filterMs);
+    void printDownsampleResult(size_t inputPoints, size_t cells, size_t outputPoints, double downsampleMs);
     void printRansacResult(size_t segmentCount);
     void printGeometryResult(size_t intersectionCount, double angleThresh);
-    void printFinalReport(const std::vector<Intersection>& intersections);
+    template <typename T>
+    void printFinalReport(const std::pmr::vector<IntersectionT<T>>& intersections);
     void printSvgSuccess(const std::string& outputPath);
+    void printRasterSuccess(const std::string& outputPath);
+    void printResultSuccess(const std::string& outputPath);
+    void printOutputStats(size_t submitted, size_t written, size_t dropped,
+                          double blockedSeconds, double drainSeconds);
+    void printAllocProfile(const AllocProfile& profile);
     void printAppComplete();
 
 } // namespace ConsoleView
\ No newline at end of file
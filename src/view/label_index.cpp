@@ -0,0 +1,77 @@
+#include "view/label_index.hpp"
+#include <algorithm>
+#include <cmath>
+
+LabelIndex::LabelIndex(double width, double height, double cellSize, std::pmr::memory_resource* mr)
+    : m_cellSize(std::max(cellSize, 1.0)),
+      m_cols(std::max(1, static_cast<int>(std::ceil(std::max(width, 1.0) / m_cellSize)))),
+      m_rows(std::max(1, static_cast<int>(std::ceil(std::max(height, 1.0) / m_cellSize)))),
+      m_boxes(mr),
+      m_heads(static_cast<size_t>(m_cols) * m_rows, -1, mr),
+      m_entries(mr)
+{
+}
+
+// Tuval dışı koordinatlar kenar hücrelere sıkıştırılır; doğruluk bozulmaz, yalnızca o hücreler kalabalıklaşır
+int LabelIndex::cellX(double x) const
+{
+    double c = std::floor(x / m_cellSize);
+    if (!(c > 0.0)) return 0;
+    return static_cast<int>(std::min(c, static_cast<double>(m_cols - 1)));
+}
+
+int LabelIndex::cellY(double y) const
+{
+    double c = std::floor(y / m_cellSize);
+    if (!(c > 0.0)) return 0;
+    return static_cast<int>(std::min(c, static_cast<double>(m_rows - 1)));
+}
+
+bool LabelIndex::overlaps(double x, double y, double w, double h, double padding) const
+{
+    if (m_boxes.empty()) return false;
+
+    // NaN ile tüm karşılaştırmalar yanlış: kaba kuvvet sürümünde her kutuyla çakışır
+    if (std::isnan(x) || std::isnan(y)) return true;
+
+    // Kayıtlı kutular tam hücrelerine eklendiğinden sorgu padding kadar genişletilir
+    const int x0 = cellX(x - padding);
+    const int x1 = cellX(x + w + padding);
+    const int y0 = cellY(y - padding);
+    const int y1 = cellY(y + h + padding);
+
+    for (int cy = y0; cy <= y1; ++cy)
+    {
+        for (int cx = x0; cx <= x1; ++cx)
+        {
+            for (int32_t e = m_heads[static_cast<size_t>(cy) * m_cols + cx]; e >= 0; e = m_entries[e].next)
+            {
+                const Box& u = m_boxes[m_entries[e].box];
+                if (!(x + w + padding < u.x ||
+                    x > u.x + u.w + padding ||
+                    y + h + padding < u.y ||
+                    y > u.y + u.h + padding))
+                {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+void LabelIndex::insert(double x, double y, double w, double h)
+{
+    const uint32_t id = static_cast<uint32_t>(m_boxes.size());
+    m_boxes.push_back({x, y, w, h});
+
+    for (int cy = cellY(y); cy <= cellY(y + h); ++cy)
+    {
+        for (int cx = cellX(x); cx <= cellX(x + w); ++cx)
+        {
+            int32_t& head = m_heads[static_cast<size_t>(cy) * m_cols + cx];
+            m_entries.push_back({id, head});
+            head = static_cast<int32_t>(m_entries.size() - 1);
+        }
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+// Yerleştirilmiş etiket kutuları için ızgara kovalı doluluk dizini.
+// Çakışma sorgusu yalnızca kutunun (padding dahil) değdiği hücrelerdeki kutuları dener;
+// sonuç tüm kutuları tek tek denemekle aynıdır.
+class LabelIndex
+{
+public:
+    LabelIndex(double width, double height, double cellSize,
+               std::pmr::memory_resource* mr = std::pmr::get_default_resource());
+
+    // (x, y, w, h) kutusu, kayıtlı bir kutuya padding mesafesinden yakınsa true
+    bool overlaps(double x, double y, double w, double h, double padding) const;
+
+    void insert(double x, double y, double w, double h);
+
+    size_t size() const { return m_boxes.size(); }
+
+private:
+    struct Box
+    {
+        double x, y, w, h;
+    };
+
+    // Hücre listeleri: tek dizide bağlı liste (hücre başına ayrı vektör yok)
+    struct Entry
+    {
+        uint32_t box;
+        int32_t next;
+    };
+
+    int cellX(double x) const;
+    int cellY(double y) const;
+
+    double m_cellSize;
+    int m_cols;
+    int m_rows;
+    std::pmr::vector<Box> m_boxes;
+    std::pmr::vector<int32_t> m_heads;
+    std::pmr::vector<Entry> m_entries;
+};
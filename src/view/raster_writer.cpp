@@ -0,0 +1,267 @@
+#include "view/raster_writer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+
+// SVG paletinden
+static constexpr uint8_t kBackground[3] = {0xf8, 0xf9, 0xfa};
+static constexpr uint8_t kAxis[3]       = {0x6c, 0x75, 0x7d};
+static constexpr uint8_t kPoint[3]      = {0xad, 0xb5, 0xbd};
+static constexpr uint8_t kLine[3]       = {0x51, 0xcf, 0x66};
+static constexpr uint8_t kIntersect[3]  = {0xff, 0x92, 0x2b};
+static constexpr uint8_t kRobot[3]      = {0x4d, 0xab, 0xf7};
+
+RasterFormat rasterFormatForPath(const std::string& path)
+{
+    const bool pgm = path.size() >= 4 && path.compare(path.size() - 4, 4, ".pgm") == 0;
+    return pgm ? RasterFormat::Pgm : RasterFormat::Ppm;
+}
+
+void RasterRenderer::clear(Color c)
+{
+    if (m_channels == 1)
+    {
+        // Gri tonlamada ITU-R BT.601 parlaklığı
+        const uint8_t g = static_cast<uint8_t>((299 * c.r + 587 * c.g + 114 * c.b) / 1000);
+        std::fill(m_pixels.begin(), m_pixels.end(), g);
+        return;
+    }
+    // İlk satır doldurulur, kalan satırlar ondan kopyalanır
+    const size_t row = static_cast<size_t>(m_width) * 3;
+    for (size_t i = 0; i < row; i += 3)
+    {
+        m_pixels[i] = c.r;
+        m_pixels[i + 1] = c.g;
+        m_pixels[i + 2] = c.b;
+    }
+    for (size_t off = row; off < m_pixels.size(); off += row)
+    {
+        std::copy_n(m_pixels.begin(), row, m_pixels.begin() + off);
+    }
+}
+
+void RasterRenderer::plot(int x, int y, Color c)
+{
+    if (x < 0 || y < 0 || x >= m_width || y >= m_height) return;
+
+    const size_t i = (static_cast<size_t>(y) * m_width + x) * m_channels;
+    if (m_channels == 1)
+    {
+        m_pixels[i] = static_cast<uint8_t>((299 * c.r + 587 * c.g + 114 * c.b) / 1000);
+    }
+    else
+    {
+        m_pixels[i] = c.r;
+        m_pixels[i + 1] = c.g;
+        m_pixels[i + 2] = c.b;
+    }
+}
+
+// Liang-Barsky ile tuvale kırpılır, ardından tamsayı Bresenham
+void RasterRenderer::drawLine(double x0, double y0, double x1, double y1, Color c)
+{
+    if (!std::isfinite(x0) || !std::isfinite(y0) || !std::isfinite(x1) || !std::isfinite(y1)) return;
+
+    const double dx = x1 - x0;
+    const double dy = y1 - y0;
+    const double p[4] = {-dx, dx, -dy, dy};
+    const double q[4] = {x0, (m_width - 1) - x0, y0, (m_height - 1) - y0};
+
+    double t0 = 0.0;
+    double t1 = 1.0;
+    for (int k = 0; k < 4; ++k)
+    {
+        if (p[k] == 0.0)
+        {
+            if (q[k] < 0.0) return;
+            continue;
+        }
+        const double t = q[k] / p[k];
+        if (p[k] < 0.0)
+        {
+            t0 = std::max(t0, t);
+        }
+        else
+        {
+            t1 = std::min(t1, t);
+        }
+    }
+    if (!(t0 <= t1)) return; // NaN dahil
+
+    int ax = static_cast<int>(std::lround(x0 + t0 * dx));
+    int ay = static_cast<int>(std::lround(y0 + t0 * dy));
+    const int bx = static_cast<int>(std::lround(x0 + t1 * dx));
+    const int by = static_cast<int>(std::lround(y0 + t1 * dy));
+
+    const int sx = ax < bx ? 1 : -1;
+    const int sy = ay < by ? 1 : -1;
+    const int ex = std::abs(bx - ax);
+    const int ey = -std::abs(by - ay);
+    int err = ex + ey;
+
+    while (true)
+    {
+        plot(ax, ay, c);
+        if (ax == bx && ay == by) break;
+        const int e2 = 2 * err;
+        if (e2 >= ey)
+        {
+            err += ey;
+            ax += sx;
+        }
+        if (e2 <= ex)
+        {
+            err += ex;
+            ay += sy;
+        }
+    }
+}
+
+template <typename T>
+void RasterRenderer::render(const std::pmr::vector<PointT<T>>& points,
+                            const std::pmr::vector<LineT<T>>& segments,
+                            const std::pmr::vector<IntersectionT<T>>& intersections,
+                            const SvgParams& params,
+                            RasterFormat format)
+{
+    const int channels = format == RasterFormat::Pgm ? 1 : 3;
+    const int w = std::max(params.width, 1);
+    const int h = std::max(params.height, 1);
+    const size_t bytes = static_cast<size_t>(w) * h * channels;
+    if (m_pixels.size() != bytes)
+    {
+        m_pixels.assign(bytes, 0);
+    }
+    m_width = w;
+    m_height = h;
+    m_channels = channels;
+
+    const ScreenMapping map(params);
+    const Color bg{kBackground[0], kBackground[1], kBackground[2]};
+    const Color axis{kAxis[0], kAxis[1], kAxis[2]};
+    const Color point{kPoint[0], kPoint[1], kPoint[2]};
+    const Color line{kLine[0], kLine[1], kLine[2]};
+    const Color mark{kIntersect[0], kIntersect[1], kIntersect[2]};
+    const Color robot{kRobot[0], kRobot[1], kRobot[2]};
+
+    clear(bg);
+
+    // Eksenler
+    drawLine(map.x(map.minx), map.y(0), map.x(map.maxx), map.y(0), axis);
+    drawLine(map.x(0), map.y(map.miny), map.x(0), map.y(map.maxy), axis);
+
+    // Noktalar: piksel başına bir yazma, en sıcak döngü
+    for (const auto& p : points)
+    {
+        const double px = map.x(p.x);
+        const double py = map.y(p.y);
+        if (!(px >= 0.0 && py >= 0.0 && px < w && py < h)) continue;
+        plot(static_cast<int>(px), static_cast<int>(py), point);
+    }
+
+    // Doğrular: SVG'deki kalın çizgiye yakın görünmesi için 3 piksel kalınlık
+    for (const auto& s : segments)
+    {
+        const double x0 = map.x(s.startPoint.x);
+        const double y0 = map.y(s.startPoint.y);
+        const double x1 = map.x(s.endPoint.x);
+        const double y1 = map.y(s.endPoint.y);
+        const bool steep = std::abs(y1 - y0) > std::abs(x1 - x0);
+        for (int o = -1; o <= 1; ++o)
+        {
+            const double ox = steep ? o : 0.0;
+            const double oy = steep ? 0.0 : o;
+            drawLine(x0 + ox, y0 + oy, x1 + ox, y1 + oy, line);
+        }
+    }
+
+    // Kesişimler: SVG ile aynı boyutta çarpı
+    constexpr double markSize = 8;
+    for (const auto& inter : intersections)
+    {
+        const double ix = map.x(inter.position.x);
+        const double iy = map.y(inter.position.y);
+        drawLine(ix - markSize, iy - markSize, ix + markSize, iy + markSize, mark);
+        drawLine(ix - markSize, iy + markSize, ix + markSize, iy - markSize, mark);
+    }
+
+    // Robot: orijinde dolu kare
+    const int rx = static_cast<int>(std::lround(map.x(0)));
+    const int ry = static_cast<int>(std::lround(map.y(0)));
+    for (int dy = -5; dy <= 5; ++dy)
+    {
+        for (int dx = -5; dx <= 5; ++dx)
+        {
+            plot(rx + dx, ry + dy, robot);
+        }
+    }
+}
+
+void RasterRenderer::renderOccupancy(const OccupancyGrid& grid, RasterFormat format)
+{
+    const int channels = format == RasterFormat::Pgm ? 1 : 3;
+    const int side = grid.cellsPerSide();
+    const size_t bytes = static_cast<size_t>(side) * side * channels;
+    if (m_pixels.size() != bytes)
+    {
+        m_pixels.assign(bytes, 0);
+    }
+    m_width = side;
+    m_height = side;
+    m_channels = channels;
+
+    const int64_t ox = grid.originX();
+    const int64_t oy = grid.originY();
+    for (int y = 0; y < side; ++y)
+    {
+        // Görüntünün ilk satırı pencerenin en üst (en büyük y) hücre satırı
+        uint8_t* row = m_pixels.data() + static_cast<size_t>(side - 1 - y) * side * channels;
+        for (int x = 0; x < side; ++x)
+        {
+            const double freeP = 1.0 / (1.0 + std::exp(static_cast<double>(grid.logOdds(ox + x, oy + y))));
+            const auto g = static_cast<uint8_t>(std::lround(255.0 * freeP));
+            for (int c = 0; c < channels; ++c) row[x * channels + c] = g;
+        }
+    }
+
+    const double inv = 1.0 / grid.params().cellSize;
+    const int rx = static_cast<int>(std::floor(grid.lastPose().x * inv) - ox);
+    const int ry = side - 1 - static_cast<int>(std::floor(grid.lastPose().y * inv) - oy);
+    const Color robot{kRobot[0], kRobot[1], kRobot[2]};
+    for (int dy = -1; dy <= 1; ++dy)
+    {
+        for (int dx = -1; dx <= 1; ++dx)
+        {
+            plot(rx + dx, ry + dy, robot);
+        }
+    }
+}
+
+bool RasterRenderer::save(const std::string& path) const
+{
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file)
+    {
+        std::cerr << "[!] Raster cikti acilamadi: " << path << "\n";
+        return false;
+    }
+
+    char header[64];
+    const int n = std::snprintf(header, sizeof(header), "%s\n%d %d\n255\n",
+                                m_channels == 1 ? "P5" : "P6", m_width, m_height);
+    bool ok = std::fwrite(header, 1, static_cast<size_t>(n), file) == static_cast<size_t>(n);
+    ok = ok && std::fwrite(m_pixels.data(), 1, m_pixels.size(), file) == m_pixels.size();
+    ok = std::fclose(file) == 0 && ok;
+
+    if (!ok)
+    {
+        std::cerr << "[!] Raster cikti yazilamadi: " << path << "\n";
+    }
+    return ok;
+}
+
+template void RasterRenderer::render(const std::pmr::vector<PointT<float>>&, const std::pmr::vector<LineT<float>>&,
+                                     const std::pmr::vector<IntersectionT<float>>&, const SvgParams&, RasterFormat);
+template void RasterRenderer::render(const std::pmr::vector<PointT<double>>&, const std::pmr::vector<LineT<double>>&,
+                                     const std::pmr::vector<IntersectionT<double>>&, const SvgParams&, RasterFormat);
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "model/occupancy_grid.hpp"
+#include "model/types.hpp"
+#include "view/svg_writer.hpp"
+
+// Pgm: 8 bit gri (P5), Ppm: 24 bit renkli (P6)
+enum class RasterFormat { Pgm, Ppm };
+
+// Uzantıdan biçim: ".pgm" -> Pgm, diğerleri Ppm
+RasterFormat rasterFormatForPath(const std::string& path);
+
+// Her karede yenilenen panolar için SVG'ye hızlı alternatif: noktalar, doğrular (Bresenham),
+// kesişim işaretleri ve robot önceden ayrılmış 8 bitlik tampona çizilir.
+// Boyut / kenar boşluğu SvgParams'tan, eşleme ScreenMapping'den (SVG ile aynı) gelir.
+// Tampon kareler arasında yeniden kullanılır; yalnızca boyut veya biçim değişince yeniden ayrılır.
+class RasterRenderer
+{
+public:
+    RasterRenderer() = default;
+
+    template <typename T>
+    void render(const std::pmr::vector<PointT<T>>& points,
+                const std::pmr::vector<LineT<T>>& segments,
+                const std::pmr::vector<IntersectionT<T>>& intersections,
+                const SvgParams& params,
+                RasterFormat format);
+
+    // Doluluk ızgarası penceresi, hücre başına bir piksel (kuzey yukarı): gri ton 255 * (1 - p),
+    // bilinmeyen hücreler orta gri; son pozdaki robot işaretlenir
+    void renderOccupancy(const OccupancyGrid& grid, RasterFormat format);
+
+    // Son çizilen kareyi ikili PGM / PPM olarak yazar
+    bool save(const std::string& path) const;
+
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+    int channels() const { return m_channels; }
+    const std::vector<uint8_t>& pixels() const { return m_pixels; }
+
+private:
+    struct Color
+    {
+        uint8_t r, g, b;
+    };
+
+    void clear(Color c);
+    void plot(int x, int y, Color c);
+    void drawLine(double x0, double y0, double x1, double y1, Color c);
+
+    int m_width = 0;
+    int m_height = 0;
+    int m_channels = 3;
+    std::vector<uint8_t> m_pixels;
+};
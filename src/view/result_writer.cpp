@@ -0,0 +1,274 @@
+#include "view/result_writer.hpp"
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+static constexpr char kMagic[4] = {'L', 'R', 'E', 'S'};
+static constexpr uint32_t kVersion = 1;
+static constexpr size_t kFixedBytes = 4 * sizeof(uint32_t) + 3 * sizeof(double);
+static constexpr size_t kSegmentBytes = 7 * sizeof(double) + sizeof(uint64_t);
+static constexpr size_t kIntersectionBytes = 4 * sizeof(double);
+
+// YARDIMCI FONKSİYONLAR
+static void appendNumber(std::string& out, double value) {
+    if (!std::isfinite(value)) {
+        out += "null";
+        return;
+    }
+    char buf[32];
+    auto res = std::to_chars(buf, buf + sizeof(buf), value);
+    out.append(buf, res.ptr);
+}
+
+static void appendInteger(std::string& out, uint64_t value) {
+    char buf[24];
+    auto res = std::to_chars(buf, buf + sizeof(buf), value);
+    out.append(buf, res.ptr);
+}
+
+template <typename V>
+static void appendRaw(std::string& out, const V& v) {
+    out.append(reinterpret_cast<const char*>(&v), sizeof(V));
+}
+
+template <typename V>
+static bool readRaw(const std::string& data, size_t& pos, size_t end, V& v) {
+    if (end - pos < sizeof(V)) return false;
+    std::memcpy(&v, data.data() + pos, sizeof(V));
+    pos += sizeof(V);
+    return true;
+}
+
+static bool writeBytes(const std::string& path, const std::string& bytes) {
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Hata: sonuc dosyasi yazilamadi: " << path << std::endl;
+        return false;
+    }
+
+    file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    return static_cast<bool>(file);
+}
+
+// JSON
+template <typename T>
+std::string formatResultsAsJson(size_t pointCount,
+                                const std::pmr::vector<LineT<T>>& segments,
+                                const std::pmr::vector<IntersectionT<T>>& intersections,
+                                const StageTimings& timings) {
+    std::string out;
+    out.reserve(256 + segments.size() * 160 + intersections.size() * 96);
+
+    out += "{\"schema\":\"lidar-result/1\",\"points\":";
+    appendInteger(out, pointCount);
+    out += ",\"timings_ms\":{\"read\":";
+    appendNumber(out, timings.readMs);
+    out += ",\"ransac\":";
+    appendNumber(out, timings.ransacMs);
+    out += ",\"intersections\":";
+    appendNumber(out, timings.intersectMs);
+    out += "},\n\"segments\":[";
+
+    for (size_t i = 0; i < segments.size(); ++i) {
+        const auto& s = segments[i];
+        out += i == 0 ? "\n" : ",\n";
+        out += "{\"a\":";
+        appendNumber(out, s.A);
+        out += ",\"b\":";
+        appendNumber(out, s.B);
+        out += ",\"c\":";
+        appendNumber(out, s.C);
+        out += ",\"start\":[";
+        appendNumber(out, s.startPoint.x);
+        out += ',';
+        appendNumber(out, s.startPoint.y);
+        out += "],\"end\":[";
+        appendNumber(out, s.endPoint.x);
+        out += ',';
+        appendNumber(out, s.endPoint.y);
+        out += "],\"inliers\":";
+        appendInteger(out, s.inlierCount);
+        out += '}';
+    }
+
+    out += "],\n\"intersections\":[";
+    for (size_t i = 0; i < intersections.size(); ++i) {
+        const auto& k = intersections[i];
+        out += i == 0 ? "\n" : ",\n";
+        out += "{\"x\":";
+        appendNumber(out, k.position.x);
+        out += ",\"y\":";
+        appendNumber(out, k.position.y);
+        out += ",\"angle_deg\":";
+        appendNumber(out, k.angleDeg);
+        out += ",\"distance\":";
+        appendNumber(out, k.distanceToRobot);
+        out += '}';
+    }
+    out += "]}\n";
+
+    return out;
+}
+
+// İKİLİ KAYIT
+std::string resultFileHeader() {
+    std::string out(kMagic, sizeof(kMagic));
+    appendRaw(out, kVersion);
+    return out;
+}
+
+template <typename T>
+void appendResultRecord(std::string& out,
+                        size_t pointCount,
+                        const std::pmr::vector<LineT<T>>& segments,
+                        const std::pmr::vector<IntersectionT<T>>& intersections,
+                        const StageTimings& timings) {
+    const size_t payload = kFixedBytes + segments.size() * kSegmentBytes +
+                           intersections.size() * kIntersectionBytes;
+    out.reserve(out.size() + sizeof(uint32_t) + payload);
+
+    appendRaw(out, static_cast<uint32_t>(payload));
+    appendRaw(out, static_cast<uint32_t>(pointCount));
+    appendRaw(out, static_cast<uint32_t>(segments.size()));
+    appendRaw(out, static_cast<uint32_t>(intersections.size()));
+    appendRaw(out, uint32_t{0});
+    appendRaw(out, timings.readMs);
+    appendRaw(out, timings.ransacMs);
+    appendRaw(out, timings.intersectMs);
+
+    for (const auto& s : segments) {
+        const double v[7] = {static_cast<double>(s.A), static_cast<double>(s.B), static_cast<double>(s.C),
+                             static_cast<double>(s.startPoint.x), static_cast<double>(s.startPoint.y),
+                             static_cast<double>(s.endPoint.x), static_cast<double>(s.endPoint.y)};
+        out.append(reinterpret_cast<const char*>(v), sizeof(v));
+        appendRaw(out, static_cast<uint64_t>(s.inlierCount));
+    }
+    for (const auto& k : intersections) {
+        const double v[4] = {static_cast<double>(k.position.x), static_cast<double>(k.position.y),
+                             static_cast<double>(k.angleDeg), static_cast<double>(k.distanceToRobot)};
+        out.append(reinterpret_cast<const char*>(v), sizeof(v));
+    }
+}
+
+template <typename T>
+bool saveResultsJson(const std::string& path,
+                     size_t pointCount,
+                     const std::pmr::vector<LineT<T>>& segments,
+                     const std::pmr::vector<IntersectionT<T>>& intersections,
+                     const StageTimings& timings) {
+    return writeBytes(path, formatResultsAsJson(pointCount, segments, intersections, timings));
+}
+
+template <typename T>
+bool saveResultsBinary(const std::string& path,
+                       size_t pointCount,
+                       const std::pmr::vector<LineT<T>>& segments,
+                       const std::pmr::vector<IntersectionT<T>>& intersections,
+                       const StageTimings& timings) {
+    std::string out = resultFileHeader();
+    appendResultRecord(out, pointCount, segments, intersections, timings);
+    return writeBytes(path, out);
+}
+
+std::optional<std::vector<ResultFrame>> parseResultsBinary(const std::string& data) {
+    uint32_t version = 0;
+    size_t pos = sizeof(kMagic);
+    if (data.size() < sizeof(kMagic) || std::memcmp(data.data(), kMagic, sizeof(kMagic)) != 0 ||
+        !readRaw(data, pos, data.size(), version) || version != kVersion) {
+        return std::nullopt;
+    }
+
+    std::vector<ResultFrame> frames;
+    while (pos < data.size()) {
+        uint32_t length = 0;
+        if (!readRaw(data, pos, data.size(), length) || data.size() - pos < length) {
+            return std::nullopt;
+        }
+        const size_t end = pos + length;
+
+        ResultFrame fr;
+        uint32_t segCount = 0, xsCount = 0, reserved = 0;
+        if (!readRaw(data, pos, end, fr.pointCount) || !readRaw(data, pos, end, segCount) ||
+            !readRaw(data, pos, end, xsCount) || !readRaw(data, pos, end, reserved) ||
+            !readRaw(data, pos, end, fr.timings.readMs) || !readRaw(data, pos, end, fr.timings.ransacMs) ||
+            !readRaw(data, pos, end, fr.timings.intersectMs)) {
+            return std::nullopt;
+        }
+        if ((end - pos) < segCount * kSegmentBytes + static_cast<size_t>(xsCount) * kIntersectionBytes) {
+            return std::nullopt;
+        }
+
+        fr.segments.resize(segCount);
+        for (auto& s : fr.segments) {
+            readRaw(data, pos, end, s.A);
+            readRaw(data, pos, end, s.B);
+            readRaw(data, pos, end, s.C);
+            readRaw(data, pos, end, s.start.x);
+            readRaw(data, pos, end, s.start.y);
+            readRaw(data, pos, end, s.end.x);
+            readRaw(data, pos, end, s.end.y);
+            readRaw(data, pos, end, s.inliers);
+        }
+        fr.intersections.resize(xsCount);
+        for (auto& k : fr.intersections) {
+            readRaw(data, pos, end, k.position.x);
+            readRaw(data, pos, end, k.position.y);
+            readRaw(data, pos, end, k.angleDeg);
+            readRaw(data, pos, end, k.distanceToRobot);
+        }
+
+        frames.push_back(std::move(fr));
+        pos = end; // Sonraki sürümlerin eklediği alanlar atlanır
+    }
+    return frames;
+}
+
+// CANLI YAYIN
+template <typename T>
+void assignResultFrame(ResultFrame& out,
+                       size_t pointCount,
+                       const std::pmr::vector<LineT<T>>& segments,
+                       const std::pmr::vector<IntersectionT<T>>& intersections,
+                       const StageTimings& timings) {
+    out.pointCount = static_cast<uint32_t>(pointCount);
+    out.timings = timings;
+    out.segments.resize(segments.size());
+    for (size_t i = 0; i < segments.size(); ++i) {
+        const auto& s = segments[i];
+        ResultSegment& r = out.segments[i];
+        r.A = s.A;
+        r.B = s.B;
+        r.C = s.C;
+        r.start = Point{s.startPoint.x, s.startPoint.y};
+        r.end = Point{s.endPoint.x, s.endPoint.y};
+        r.inliers = s.inlierCount;
+    }
+    out.intersections.resize(intersections.size());
+    for (size_t i = 0; i < intersections.size(); ++i) {
+        const auto& k = intersections[i];
+        out.intersections[i] = Intersection{Point{k.position.x, k.position.y}, k.angleDeg, k.distanceToRobot};
+    }
+}
+
+template std::string formatResultsAsJson(size_t, const std::pmr::vector<LineT<float>>&,
+                                         const std::pmr::vector<IntersectionT<float>>&, const StageTimings&);
+template void appendResultRecord(std::string&, size_t, const std::pmr::vector<LineT<float>>&,
+                                 const std::pmr::vector<IntersectionT<float>>&, const StageTimings&);
+template bool saveResultsJson(const std::string&, size_t, const std::pmr::vector<LineT<float>>&,
+                              const std::pmr::vector<IntersectionT<float>>&, const StageTimings&);
+template bool saveResultsBinary(const std::string&, size_t, const std::pmr::vector<LineT<float>>&,
+                                const std::pmr::vector<IntersectionT<float>>&, const StageTimings&);
+template std::string formatResultsAsJson(size_t, const std::pmr::vector<LineT<double>>&,
+                                         const std::pmr::vector<IntersectionT<double>>&, const StageTimings&);
+template void appendResultRecord(std::string&, size_t, const std::pmr::vector<LineT<double>>&,
+                                 const std::pmr::vector<IntersectionT<double>>&, const StageTimings&);
+template bool saveResultsJson(const std::string&, size_t, const std::pmr::vector<LineT<double>>&,
+                              const std::pmr::vector<IntersectionT<double>>&, const StageTimings&);
+template bool saveResultsBinary(const std::string&, size_t, const std::pmr::vector<LineT<double>>&,
+                                const std::pmr::vector<IntersectionT<double>>&, const StageTimings&);
+template void assignResultFrame(ResultFrame&, size_t, const std::pmr::vector<LineT<float>>&,
+                                const std::pmr::vector<IntersectionT<float>>&, const StageTimings&);
+template void assignResultFrame(ResultFrame&, size_t, const std::pmr::vector<LineT<double>>&,
+                                const std::pmr::vector<IntersectionT<double>>&, const StageTimings&);
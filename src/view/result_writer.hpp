@@ -0,0 +1,87 @@
+#pragma once
+
+#include "model/types.hpp"
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Akış aşamalarının süreleri (ms)
+struct StageTimings {
+    double readMs = 0.0;       // Okuma + filtre / nokta dönüşümü (akış halinde birlikte)
+    double ransacMs = 0.0;
+    double intersectMs = 0.0;
+};
+
+// Aşağı akış tüketicileri (planlayıcı vb.) için yapılandırılmış sonuç çıktısı.
+//
+// JSON (--out-json): tek nesne, şema "lidar-result/1"; sayılar en kısa geri dönüşümlü
+// gösterimde, sonlu olmayan değerler null.
+//
+// İkili (--out-bin), little-endian:
+//   char[4]  "LRES"
+//   uint32   sürüm (1)
+//   kayıtlar (tarama başına bir tane, dosyaya eklenebilir):
+//     uint32  kayıt uzunluğu (bu alan hariç bayt)
+//     uint32  nokta sayısı, doğru sayısı, kesişim sayısı, 0 (ayrılmış)
+//     double  readMs, ransacMs, intersectMs
+//     doğrular:  double A, B, C, x1, y1, x2, y2; uint64 inlier sayısı
+//     kesişimler: double x, y, angleDeg, distanceToRobot
+// Tüketici bilmediği kayıt uzunluklarını atlayarak ileri uyumlu okuyabilir.
+
+struct ResultSegment {
+    double A = 0.0, B = 0.0, C = 0.0;
+    Point start;
+    Point end;
+    uint64_t inliers = 0;
+};
+
+struct ResultFrame {
+    uint32_t pointCount = 0;
+    StageTimings timings;
+    std::vector<ResultSegment> segments;
+    std::vector<Intersection> intersections;
+};
+
+template <typename T>
+std::string formatResultsAsJson(size_t pointCount,
+                                const std::pmr::vector<LineT<T>>& segments,
+                                const std::pmr::vector<IntersectionT<T>>& intersections,
+                                const StageTimings& timings);
+
+// Dosya başlığı olmadan tek kayıt (uzunluk öneki dahil) ekler
+template <typename T>
+void appendResultRecord(std::string& out,
+                        size_t pointCount,
+                        const std::pmr::vector<LineT<T>>& segments,
+                        const std::pmr::vector<IntersectionT<T>>& intersections,
+                        const StageTimings& timings);
+
+// "LRES" + sürüm başlığı
+std::string resultFileHeader();
+
+template <typename T>
+bool saveResultsJson(const std::string& path,
+                     size_t pointCount,
+                     const std::pmr::vector<LineT<T>>& segments,
+                     const std::pmr::vector<IntersectionT<T>>& intersections,
+                     const StageTimings& timings);
+
+template <typename T>
+bool saveResultsBinary(const std::string& path,
+                       size_t pointCount,
+                       const std::pmr::vector<LineT<T>>& segments,
+                       const std::pmr::vector<IntersectionT<T>>& intersections,
+                       const StageTimings& timings);
+
+// Sonuçları out'a yerinde yazar (vektör kapasiteleri korunur); canlı yayında kare başına
+// ayırma yapılmaz
+template <typename T>
+void assignResultFrame(ResultFrame& out,
+                       size_t pointCount,
+                       const std::pmr::vector<LineT<T>>& segments,
+                       const std::pmr::vector<IntersectionT<T>>& intersections,
+                       const StageTimings& timings);
+
+// Başlık + kayıtlar; bozuk / eksik veride nullopt
+std::optional<std::vector<ResultFrame>> parseResultsBinary(const std::string& data);
@@ -0,0 +1,84 @@
+#include "view/svg_buffer.hpp"
+#include <charconv>
+#include <cstring>
+
+SvgBuffer::SvgBuffer(std::FILE* file, std::pmr::memory_resource* mr, size_t capacity)
+    : m_file(file),
+      m_buf(capacity < 64 ? 64 : capacity, mr)
+{
+}
+
+SvgBuffer::~SvgBuffer() {
+    flush();
+}
+
+bool SvgBuffer::flush() {
+    if (m_len > 0 && m_ok) {
+        m_ok = std::fwrite(m_buf.data(), 1, m_len, m_file) == m_len;
+    }
+    m_len = 0;
+    return m_ok;
+}
+
+// Tamponda en az n bayt yer açar (n <= 64 çağrılarla sınırlı)
+char* SvgBuffer::reserve(size_t n) {
+    if (m_len + n > m_buf.size()) flush();
+    return m_buf.data() + m_len;
+}
+
+void SvgBuffer::append(const char* s, size_t n) {
+    if (m_len + n > m_buf.size()) {
+        flush();
+        if (n > m_buf.size()) {
+            if (m_ok) m_ok = std::fwrite(s, 1, n, m_file) == n;
+            return;
+        }
+    }
+    std::memcpy(m_buf.data() + m_len, s, n);
+    m_len += n;
+}
+
+SvgBuffer& SvgBuffer::operator<<(const char* s) {
+    append(s, std::strlen(s));
+    return *this;
+}
+
+SvgBuffer& SvgBuffer::operator<<(const std::string& s) {
+    append(s.data(), s.size());
+    return *this;
+}
+
+SvgBuffer& SvgBuffer::operator<<(char c) {
+    *reserve(1) = c;
+    ++m_len;
+    return *this;
+}
+
+SvgBuffer& SvgBuffer::appendInteger(long long v) {
+    char* p = reserve(24);
+    auto res = std::to_chars(p, p + 24, v);
+    m_len += static_cast<size_t>(res.ptr - p);
+    return *this;
+}
+
+SvgBuffer& SvgBuffer::operator<<(double v) {
+    // Sabit biçimde çok büyük değerler 64 bayta sığmayabilir
+    constexpr size_t kMax = 64;
+    char* p = reserve(kMax);
+    auto res = m_fixedDigits < 0
+        ? std::to_chars(p, p + kMax, v, std::chars_format::general, 6)
+        : std::to_chars(p, p + kMax, v, std::chars_format::fixed, m_fixedDigits);
+    if (res.ec != std::errc()) {
+        char big[400];
+        res = std::to_chars(big, big + sizeof(big), v, std::chars_format::fixed, m_fixedDigits);
+        append(big, static_cast<size_t>(res.ptr - big));
+        return *this;
+    }
+    m_len += static_cast<size_t>(res.ptr - p);
+    return *this;
+}
+
+SvgBuffer& SvgBuffer::operator<<(SvgFixed f) {
+    m_fixedDigits = f.digits;
+    return *this;
+}
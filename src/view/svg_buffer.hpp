@@ -0,0 +1,50 @@
+#pragma once
+#include <cstddef>
+#include <cstdio>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// std::fixed << std::setprecision(n) karşılığı; ostream ve SvgBuffer için ortak
+struct SvgFixed {
+    int digits;
+};
+
+// SVG için tamponlu çıktı: sayılar std::to_chars ile biçimlenir, büyük bloklar halinde yazılır.
+// Biçim std::ostream ile birebir aynıdır (varsayılan %.6g, SvgFixed sonrası %.nf ve kalıcı),
+// böylece iki arka uç bayt bayt aynı dosyayı üretir.
+class SvgBuffer {
+public:
+    SvgBuffer(std::FILE* file, std::pmr::memory_resource* mr, size_t capacity = size_t{256} << 10);
+    ~SvgBuffer();
+
+    SvgBuffer(const SvgBuffer&) = delete;
+    SvgBuffer& operator=(const SvgBuffer&) = delete;
+
+    SvgBuffer& operator<<(const char* s);
+    SvgBuffer& operator<<(const std::string& s);
+    SvgBuffer& operator<<(char c);
+    SvgBuffer& operator<<(double v);
+    SvgBuffer& operator<<(float v) { return *this << static_cast<double>(v); }
+    SvgBuffer& operator<<(SvgFixed f);
+
+    template <typename I, typename = std::enable_if_t<std::is_integral_v<I>>>
+    SvgBuffer& operator<<(I v) {
+        return appendInteger(static_cast<long long>(v));
+    }
+
+    // Tamponu dosyaya boşaltır; yazma hatası olduysa false
+    bool flush();
+
+private:
+    SvgBuffer& appendInteger(long long v);
+    void append(const char* s, size_t n);
+    char* reserve(size_t n);
+
+    std::FILE* m_file;
+    std::pmr::vector<char> m_buf;
+    size_t m_len = 0;
+    int m_fixedDigits = -1; // -1: varsayılan (%g)
+    bool m_ok = true;
+};
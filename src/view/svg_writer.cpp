@@ -1,8 +1,12 @@
 #include "view/svg_writer.hpp"
+#include "view/svg_buffer.hpp"
+#include "view/label_index.hpp"
+#include <cstdio>
 #include <iostream>
 #include <fstream>
 #include <iomanip>
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <sstream>
 
@@ -14,34 +18,102 @@ static void expandBounds(double& minx, double& miny, double& maxx, double& maxy,
     maxy = std::max(maxy, p.y);
 }
 
-void saveToSVG(const std::string& out,
-               const std::vector<Point>& pts,
-               const std::vector<Line>& segs,
-               const std::vector<Intersection>& xs,
-               const SvgParams& sp)
+ScreenMapping::ScreenMapping(const SvgParams& sp)
+    : margin(sp.margin), height(sp.height)
 {
-    std::ofstream f(out);
-    if (!f.is_open())
-    {
-        std::cerr << "[!] SVG acilamadi: " << out << "\n";
-        return;
-    }
-
-    // Eksen Oranı
-    double minx = -3.0;
-    double maxx = 3.0;
-    double miny = -3.0;
-    double maxy = 3.0;
-
     // Ölçekleme hesapla
     double W = sp.width - 2 * sp.margin;
     double H = sp.height - 2 * sp.margin;
     double sx = W / std::max(1e-9, (maxx - minx));
     double sy = H / std::max(1e-9, (maxy - miny));
-    double s = std::min(sx, sy);
+    scale = std::min(sx, sy);
+}
+
+static std::ostream& operator<<(std::ostream& os, SvgFixed f)
+{
+    return os << std::fixed << std::setprecision(f.digits);
+}
+
+// LOD: noktalar ekran piksellerine toplanır, dolu her piksel tek işaret olur.
+// Tek bir <path>: satır satır, göreli "m dx dy h(n)" hareketleri; yatay komşu pikseller
+// tek çizgi parçasına birleşir. Yuvarlak uçlu 3.5 px kalem, r=1.75 dairelerle aynı görünür.
+// Çıktı boyutu nokta sayısına değil yalnızca dolu piksel sayısına bağlıdır.
+template <typename Out, typename T, typename FX, typename FY>
+static void writeLodPoints(Out& f, const std::pmr::vector<PointT<T>>& pts,
+                           const FX& Sx, const FY& Sy, const SvgParams& sp,
+                           std::pmr::memory_resource* mr)
+{
+    const long w = std::max(sp.width, 1);
+    const long h = std::max(sp.height, 1);
+    std::pmr::vector<unsigned char> occupied(static_cast<size_t>(w * h), 0, mr);
+
+    size_t cells = 0;
+    for (auto& p : pts)
+    {
+        double px = std::floor(Sx(p.x));
+        double py = std::floor(Sy(p.y));
+        // Tuval dışı (ve NaN) noktalar zaten görünmez
+        if (!(px >= 0 && px < w && py >= 0 && py < h)) continue;
+
+        unsigned char& c = occupied[static_cast<size_t>(py) * w + static_cast<size_t>(px)];
+        cells += c == 0 ? 1 : 0;
+        c = 1;
+    }
+
+    f << " <path fill='none' stroke='#adb5bd' stroke-width='3.5' stroke-linecap='round' "
+        << "opacity='0.6' data-lod-cells='" << cells << "' d='";
 
-    auto Sx = [&](double x) { return sp.margin + (x - minx) * s; };
-    auto Sy = [&](double y) { return sp.height - (sp.margin + (y - miny) * s); };
+    // Kalem piksel merkezlerinde; ilk hareket mutlak, sonrakiler tamsayı göreli
+    bool first = true;
+    long cx = 0;
+    long cy = 0;
+    size_t runs = 0;
+    for (long y = 0; y < h; ++y)
+    {
+        const unsigned char* row = occupied.data() + y * w;
+        for (long x = 0; x < w; ++x)
+        {
+            if (!row[x]) continue;
+            long end = x;
+            while (end + 1 < w && row[end + 1]) ++end;
+
+            if (first)
+            {
+                f << 'M' << x << ".5 " << y << ".5";
+                first = false;
+            }
+            else
+            {
+                f << 'm' << (x - cx) << ' ' << (y - cy);
+            }
+            f << 'h' << (end - x);
+            cx = end;
+            cy = y;
+            x = end;
+
+            if (++runs % 32 == 0) f << '\n';
+        }
+    }
+    f << "'/>\n";
+}
+
+// Gövde her iki arka uç için aynı; Out std::ostream veya SvgBuffer
+template <typename Out, typename T>
+static void writeSvg(Out& f,
+                     const std::pmr::vector<PointT<T>>& pts,
+                     const std::pmr::vector<LineT<T>>& segs,
+                     const std::pmr::vector<IntersectionT<T>>& xs,
+                     const SvgParams& sp,
+                     std::pmr::memory_resource* mr)
+{
+    const ScreenMapping map(sp);
+    const double minx = map.minx;
+    const double maxx = map.maxx;
+    const double miny = map.miny;
+    const double maxy = map.maxy;
+
+    auto Sx = [&](double x) { return map.x(x); };
+    auto Sy = [&](double y) { return map.y(y); };
 
     // SVG başlangıcı
     f << "<?xml version='1.0' encoding='UTF-8'?>\n";
@@ -149,12 +221,19 @@ void saveToSVG(const std::string& out,
 
     // LIDAR noktaları
     f << "<g id='lidar-points'>\n";
-    for (auto& p : pts)
+    if (sp.lodThreshold > 0 && pts.size() > sp.lodThreshold)
     {
-        double px = Sx(p.x);
-        double py = Sy(p.y);
-        f << " <circle cx='" << px << "' cy='" << py
-            << "' r='1.75' fill='#adb5bd' opacity='0.6'/>\n";
+        writeLodPoints(f, pts, Sx, Sy, sp, mr);
+    }
+    else
+    {
+        for (auto& p : pts)
+        {
+            double px = Sx(p.x);
+            double py = Sy(p.y);
+            f << " <circle cx='" << px << "' cy='" << py
+                << "' r='1.75' fill='#adb5bd' opacity='0.6'/>\n";
+        }
     }
     f << "</g>\n\n";
 
@@ -175,7 +254,8 @@ void saveToSVG(const std::string& out,
     {
         f << "<g id='intersections'>\n";
 
-        std::vector<std::tuple<double, double, double, double>> used_boxes; // x, y, w, h
+        // Kutu + padding boyutunda hücreler: bir sorgu en fazla 3x3 hücreye bakar
+        LabelIndex used_boxes(sp.width, sp.height, 64.0, mr);
 
         for (size_t i = 0; i < xs.size(); i++)
         {
@@ -207,18 +287,18 @@ void saveToSVG(const std::string& out,
             double box_h = 32;
             double box_padding = 15;
 
-            std::vector<std::pair<double, double>> candidates = {
+            const std::array<std::pair<double, double>, 4> candidates = {{
                 {ix + 18, iy - box_h / 2}, // Sağ
                 {ix - box_w - 18, iy - box_h / 2}, // Sol
                 {ix - box_w / 2, iy - box_h - 18}, // Üst
                 {ix - box_w / 2, iy + 18} // Alt
-            };
+            }};
 
             double box_x = candidates[0].first;
             double box_y = candidates[0].second;
             bool found_spot = false;
 
-            for (auto& cand : candidates)
+            for (const auto& cand : candidates)
             {
                 double test_x = cand.first;
                 double test_y = cand.second;
@@ -229,23 +309,7 @@ void saveToSVG(const std::string& out,
                     continue;
                 }
 
-                bool overlaps = false;
-                for (auto& used : used_boxes)
-                {
-                    double ux = std::get<0>(used);
-                    double uy = std::get<1>(used);
-                    double uw = std::get<2>(used);
-                    double uh = std::get<3>(used);
-
-                    if (!(test_x + box_w + box_padding < ux ||
-                        test_x > ux + uw + box_padding ||
-                        test_y + box_h + box_padding < uy ||
-                        test_y > uy + uh + box_padding))
-                    {
-                        overlaps = true;
-                        break;
-                    }
-                }
+                bool overlaps = used_boxes.overlaps(test_x, test_y, box_w, box_h, box_padding);
 
                 if (!overlaps)
                 {
@@ -258,7 +322,7 @@ void saveToSVG(const std::string& out,
 
             if (found_spot)
             {
-                used_boxes.push_back({box_x, box_y, box_w, box_h});
+                used_boxes.insert(box_x, box_y, box_w, box_h);
             }
 
             f << " <rect x='" << box_x << "' y='" << box_y
@@ -269,7 +333,7 @@ void saveToSVG(const std::string& out,
             f << " <text x='" << (box_x + box_w / 2) << "' y='" << (box_y + 13)
                 << "' text-anchor='middle' font-family='Arial, sans-serif' "
                 << "font-size='11' font-weight='bold' fill='#ff6b6b'>"
-                << std::fixed << std::setprecision(2) << inter.distanceToRobot << " m</text>\n";
+                << SvgFixed{2} << inter.distanceToRobot << " m</text>\n";
 
             f << " <text x='" << (box_x + box_w / 2) << "' y='" << (box_y + 25)
                 << "' text-anchor='middle' font-family='Arial, sans-serif' "
@@ -385,5 +449,146 @@ void saveToSVG(const std::string& out,
     f << "</g>\n";
 
     f << "</svg>\n";
-    f.close();
-}
\ No newline at end of file
+}
+
+template <typename T>
+void saveToSVG(const std::string& out,
+               const std::pmr::vector<PointT<T>>& pts,
+               const std::pmr::vector<LineT<T>>& segs,
+               const std::pmr::vector<IntersectionT<T>>& xs,
+               const SvgParams& sp,
+               std::pmr::memory_resource* mr)
+{
+    if (sp.backend == SvgBackend::Stream)
+    {
+        std::ofstream f(out);
+        if (!f.is_open())
+        {
+            std::cerr << "[!] SVG acilamadi: " << out << "\n";
+            return;
+        }
+        writeSvg(f, pts, segs, xs, sp, mr);
+        return;
+    }
+
+    std::FILE* file = std::fopen(out.c_str(), "wb");
+    if (!file)
+    {
+        std::cerr << "[!] SVG acilamadi: " << out << "\n";
+        return;
+    }
+
+    bool ok = false;
+    {
+        SvgBuffer buf(file, mr);
+        writeSvg(buf, pts, segs, xs, sp, mr);
+        ok = buf.flush();
+    }
+    if (std::fclose(file) != 0 || !ok)
+    {
+        std::cerr << "[!] SVG yazilamadi: " << out << "\n";
+    }
+}
+
+template void saveToSVG(const std::string&, const std::pmr::vector<PointT<float>>&,
+                        const std::pmr::vector<LineT<float>>&, const std::pmr::vector<IntersectionT<float>>&,
+                        const SvgParams&, std::pmr::memory_resource*);
+template void saveToSVG(const std::string&, const std::pmr::vector<PointT<double>>&,
+                        const std::pmr::vector<LineT<double>>&, const std::pmr::vector<IntersectionT<double>>&,
+                        const SvgParams&, std::pmr::memory_resource*);
+
+// Bir durumdaki hücreler: satır başına yatay koşular, her koşu bir dikdörtgen alt yolu
+template <typename Out>
+static size_t writeOccupancyRuns(Out& f, const OccupancyGrid& grid, CellState want,
+                                 double x0, double y0, double cell)
+{
+    const int side = grid.cellsPerSide();
+    const int64_t ox = grid.originX();
+    const int64_t oy = grid.originY();
+    size_t runs = 0;
+    for (int y = 0; y < side; ++y)
+    {
+        const double top = y0 + (side - 1 - y) * cell;
+        for (int x = 0; x < side; ++x)
+        {
+            if (grid.state(ox + x, oy + y) != want) continue;
+            int end = x;
+            while (end + 1 < side && grid.state(ox + end + 1, oy + y) == want) ++end;
+
+            f << 'M' << (x0 + x * cell) << ' ' << top << 'h' << ((end - x + 1) * cell)
+              << 'v' << cell << 'h' << (-(end - x + 1) * cell) << 'z';
+            if (++runs % 16 == 0) f << '\n';
+            x = end;
+        }
+    }
+    return runs;
+}
+
+template <typename Out>
+static void writeOccupancySvg(Out& f, const OccupancyGrid& grid, const SvgParams& sp)
+{
+    const int side = grid.cellsPerSide();
+    const double cell = std::max(1e-3, std::min(sp.width - 2.0 * sp.margin, sp.height - 2.0 * sp.margin) / side);
+    const double x0 = (sp.width - side * cell) / 2;
+    const double y0 = (sp.height - side * cell) / 2;
+    const double cellSize = grid.params().cellSize;
+
+    f << "<?xml version='1.0' encoding='UTF-8'?>\n";
+    f << "<svg xmlns='http://www.w3.org/2000/svg' width='" << sp.width
+        << "' height='" << sp.height << "'>\n";
+    f << "<rect width='100%' height='100%' fill='#f8f9fa'/>\n";
+    f << "<g data-cell-size='" << cellSize << "' data-origin-x='" << grid.originX()
+        << "' data-origin-y='" << grid.originY() << "' data-cells='" << side << "'>\n";
+    f << " <rect x='" << x0 << "' y='" << y0 << "' width='" << side * cell << "' height='" << side * cell
+        << "' fill='#ced4da'/>\n";
+
+    f << " <path fill='#ffffff' d='";
+    writeOccupancyRuns(f, grid, CellState::Free, x0, y0, cell);
+    f << "'/>\n";
+    f << " <path fill='#343a40' d='";
+    writeOccupancyRuns(f, grid, CellState::Occupied, x0, y0, cell);
+    f << "'/>\n";
+
+    // Robot: son poz, hücre merkezinde
+    const SensorPose& pose = grid.lastPose();
+    const double rx = x0 + (pose.x / cellSize - grid.originX()) * cell;
+    const double ry = y0 + (side - (pose.y / cellSize - grid.originY())) * cell;
+    f << " <circle cx='" << rx << "' cy='" << ry << "' r='" << std::max(3.0, 2 * cell)
+        << "' fill='#4dabf7' stroke='#1971c2' stroke-width='1'/>\n";
+    f << "</g>\n";
+    f << "</svg>\n";
+}
+
+void saveOccupancyToSVG(const std::string& out, const OccupancyGrid& grid, const SvgParams& sp,
+                        std::pmr::memory_resource* mr)
+{
+    if (sp.backend == SvgBackend::Stream)
+    {
+        std::ofstream f(out);
+        if (!f.is_open())
+        {
+            std::cerr << "[!] SVG acilamadi: " << out << "\n";
+            return;
+        }
+        writeOccupancySvg(f, grid, sp);
+        return;
+    }
+
+    std::FILE* file = std::fopen(out.c_str(), "wb");
+    if (!file)
+    {
+        std::cerr << "[!] SVG acilamadi: " << out << "\n";
+        return;
+    }
+
+    bool ok = false;
+    {
+        SvgBuffer buf(file, mr);
+        writeOccupancySvg(buf, grid, sp);
+        ok = buf.flush();
+    }
+    if (std::fclose(file) != 0 || !ok)
+    {
+        std::cerr << "[!] SVG yazilamadi: " << out << "\n";
+    }
+}
@@ -1,18 +1,55 @@
 #pragma once
+#include <cstddef>
 #include <string>
 #include <vector>
+#include "model/occupancy_grid.hpp"
 #include "model/types.hpp"
 
+// Stream: std::ofstream operator<< (eski yol), Buffered: to_chars + blok yazma (aynı çıktı)
+enum class SvgBackend { Stream, Buffered };
+
 struct SvgParams {
     int width  = 1200;
     int height = 900;
     int margin = 40;
+    SvgBackend backend = SvgBackend::Buffered;
+    size_t lodThreshold = 50000; // Bundan fazla noktada piksel hücreli LOD çizimi; 0: kapalı
+};
+
+// Dünya (m) -> ekran (px) dönüşümü; SVG ve raster çıktı aynı eşlemeyi kullanır.
+// Görünüm sabit: her iki eksende [-3, 3] m, en-boy oranı korunur.
+struct ScreenMapping {
+    double minx = -3.0;
+    double maxx = 3.0;
+    double miny = -3.0;
+    double maxy = 3.0;
+    double scale = 1.0;
+    int margin = 0;
+    int height = 0;
+
+    explicit ScreenMapping(const SvgParams& sp);
+
+    double x(double wx) const { return margin + (wx - minx) * scale; }
+    double y(double wy) const { return height - (margin + (wy - miny) * scale); }
 };
 
+// Etiket yerleşimi için geçici tamponlar mr'den ayrılır (float ve double için derlenir)
+template <typename T>
 void saveToSVG(
     const std::string& outputPath,
-    const std::vector<Point>& allPoints,
-    const std::vector<Line>& segments,
-    const std::vector<Intersection>& intersections,
-    const SvgParams& params
+    const std::pmr::vector<PointT<T>>& allPoints,
+    const std::pmr::vector<LineT<T>>& segments,
+    const std::pmr::vector<IntersectionT<T>>& intersections,
+    const SvgParams& params,
+    std::pmr::memory_resource* mr = std::pmr::get_default_resource()
+);
+
+// Doluluk ızgarası penceresi: pencere tuvale sığdırılır (kare hücreler, kuzey yukarı). Boş ve
+// dolu hücreler satır satır birleşik koşular halinde iki <path> olarak çizilir; bilinmeyenler
+// arka plandır. Son pozdaki robot işaretlenir.
+void saveOccupancyToSVG(
+    const std::string& outputPath,
+    const OccupancyGrid& grid,
+    const SvgParams& params,
+    std::pmr::memory_resource* mr = std::pmr::get_default_resource()
 );
@@ -0,0 +1,55 @@
+#include "fixtures.hpp"
+#include "model/lidar.hpp"
+
+#include <random>
+
+namespace fixtures {
+
+LidarScan roomScan(const RoomScanConfig& cfg) {
+    Scene scene;
+    addRoom(scene, 0.0, 0.0, cfg.width, cfg.height);
+    if (cfg.clutter > 0) {
+        addClutter(scene, cfg.clutter, cfg.clutterMin, cfg.clutterMax, cfg.clutterSize, cfg.clutterSeed);
+    }
+    return simulateScan(scene, cfg.pose, cfg.sim);
+}
+
+std::pmr::vector<Point> roomPoints(const RoomScanConfig& cfg) {
+    return filterAndConvertToPoints(roomScan(cfg));
+}
+
+std::vector<Point> scenePoints(uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> u(0.0, 1.0);
+
+    Scene scene;
+    if (seed % 2 == 0) {
+        addRoom(scene, 0.0, 0.0, 4.0 + 2.0 * u(rng), 3.0 + 2.0 * u(rng));
+    } else {
+        addPolygonRoom(scene, 0.0, 0.0, 5 + static_cast<int>(seed % 3), 2.5 + u(rng), u(rng));
+    }
+    addClutter(scene, 3, {-1.0, -1.0}, {1.0, 1.0}, 0.4, seed);
+
+    ScanSimConfig cfg;
+    cfg.beams = 720;
+    cfg.noiseSigma = 0.004;
+    cfg.dropoutRate = 0.05;
+    cfg.seed = seed;
+    SensorPose pose{0.3 * (u(rng) - 0.5), 0.3 * (u(rng) - 0.5), u(rng)};
+    LidarScan scan = simulateScan(scene, pose, cfg);
+
+    auto pts = filterAndConvertToPoints(scan);
+    return std::vector<Point>(pts.begin(), pts.end());
+}
+
+Line segment(Point a, Point b) {
+    Line l;
+    l.A = b.y - a.y;
+    l.B = a.x - b.x;
+    l.C = -l.A * a.x - l.B * a.y;
+    l.startPoint = a;
+    l.endPoint = b;
+    return l;
+}
+
+} // namespace fixtures
@@ -0,0 +1,40 @@
+#pragma once
+// Testlerin ortak sentetik verileri: simüle oda taramaları ve elle kurulan parçalar.
+
+#include "model/scene.hpp"
+#include "model/types.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fixtures {
+
+// Orijin merkezli width x height oda; clutter > 0 ise içine addClutter ile engeller.
+// Işın sayısı, gürültü, kayıp / hata oranları ve tohum sim'den.
+struct RoomScanConfig {
+    explicit RoomScanConfig(size_t beams = 720, double noise = 0.003) {
+        sim.beams = beams;
+        sim.noiseSigma = noise;
+    }
+
+    double width = 6.0;
+    double height = 4.0;
+    int clutter = 0;
+    Point clutterMin{-2.0, -1.5};
+    Point clutterMax{2.0, 1.5};
+    double clutterSize = 0.5;
+    uint32_t clutterSeed = 0;
+    SensorPose pose;
+    ScanSimConfig sim;
+};
+
+LidarScan roomScan(const RoomScanConfig& cfg);
+std::pmr::vector<Point> roomPoints(const RoomScanConfig& cfg);
+
+// Tohuma göre biçimi (dikdörtgen ya da çokgen oda), engelleri ve sensör pozu değişen gürültülü sahne
+std::vector<Point> scenePoints(uint32_t seed);
+
+// a'dan b'ye parça (doğru katsayıları normalize edilmemiş)
+Line segment(Point a, Point b);
+
+} // namespace fixtures
@@ -0,0 +1,240 @@
+#include "reference.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace reference {
+
+// TOML
+static std::string trim(const std::string& s) {
+    size_t first = s.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos) return std::string();
+    size_t last = s.find_last_not_of(" \t\r\n");
+    return s.substr(first, last - first + 1);
+}
+
+// "anahtar = değer" satırının değeri; sayı değilse 0
+static double valueOf(const std::string& line) {
+    std::string rest = trim(line.substr(line.find('=') + 1));
+    if (!rest.empty() && rest[0] == '+') rest.erase(0, 1);
+    return std::strtod(rest.c_str(), nullptr);
+}
+
+std::optional<LidarScan> parseScanToml(const std::string& text) {
+    LidarScan scan;
+    std::istringstream in(text);
+    std::string line;
+    bool inScan = false;
+
+    while (std::getline(in, line)) {
+        std::string t = trim(line);
+        if (t.empty() || t[0] == '#') continue;
+        if (t[0] == '[' && t.find('=') == std::string::npos) {
+            inScan = (t == "[scan]");
+            continue;
+        }
+        if (!inScan || t.find('=') == std::string::npos) continue;
+
+        std::string key = trim(t.substr(0, t.find('=')));
+        if (key == "angle_min")            scan.angle_min = valueOf(t);
+        else if (key == "angle_max")       scan.angle_max = valueOf(t);
+        else if (key == "angle_increment") scan.angle_increment = valueOf(t);
+        else if (key == "range_min")       scan.range_min = valueOf(t);
+        else if (key == "range_max")       scan.range_max = valueOf(t);
+        else if (key == "ranges") {
+            // Dizinin tamamı (birden çok satır olabilir) ']' görülene kadar toplanır;
+            // satır sonu yorumları önce atılır
+            std::string row = line.substr(line.find('[') + 1);
+            std::string cleaned;
+            for (;;) {
+                row = row.substr(0, row.find('#'));
+                size_t close = row.find(']');
+                cleaned += row.substr(0, close);
+                cleaned += ' ';
+                if (close != std::string::npos || !std::getline(in, row)) break;
+            }
+            std::replace(cleaned.begin(), cleaned.end(), ',', ' ');
+
+            std::istringstream tokens(cleaned);
+            std::string tok;
+            while (tokens >> tok) {
+                const char* first = tok.c_str();
+                if (*first == '+') ++first;
+                char* end = nullptr;
+                double v = std::strtod(first, &end);
+                if (end == first || *end != '\0') break; // İlk geçersiz değerde dizi biter
+                scan.ranges.push_back(v);
+            }
+        }
+    }
+    return scan;
+}
+
+// DÖNÜŞÜM
+std::vector<Point> convertScan(const LidarScan& scan) {
+    std::vector<Point> out;
+    for (size_t i = 0; i < scan.ranges.size(); ++i) {
+        double r = scan.ranges[i];
+        if (r == -1.0 || r == 999.0 || r == -999.0) continue;
+        if (r < scan.range_min || r > scan.range_max) continue;
+
+        double angle = scan.angle_min + static_cast<double>(i) * scan.angle_increment;
+        if (angle > scan.angle_max) continue;
+
+        out.push_back({r * std::cos(angle), r * std::sin(angle)});
+    }
+    return out;
+}
+
+// RANSAC
+static double distanceToLine(double A, double B, double C, const Point& p) {
+    return std::abs(A * p.x + B * p.y + C) / std::sqrt(A * A + B * B);
+}
+
+// Toplam en küçük kareler (kovaryansın küçük özdeğeri)
+static void fitLine(const std::vector<Point>& pts, double& A, double& B, double& C) {
+    double meanX = 0, meanY = 0;
+    for (const auto& p : pts) { meanX += p.x; meanY += p.y; }
+    meanX /= static_cast<double>(pts.size());
+    meanY /= static_cast<double>(pts.size());
+
+    double Sxx = 0, Sxy = 0, Syy = 0;
+    for (const auto& p : pts) {
+        double dx = p.x - meanX, dy = p.y - meanY;
+        Sxx += dx * dx;
+        Sxy += dx * dy;
+        Syy += dy * dy;
+    }
+
+    double trace = Sxx + Syy;
+    double D = Sxx * Syy - Sxy * Sxy;
+    double lambda = trace / 2 - std::sqrt(std::max(0.0, trace * trace / 4 - D));
+
+    A = Sxy;
+    B = lambda - Sxx;
+    double mag = std::sqrt(A * A + B * B);
+    if (mag < 1e-9) {
+        A = lambda - Syy;
+        B = Sxy;
+        mag = std::sqrt(A * A + B * B);
+        if (mag < 1e-9) {
+            A = pts.back().y - pts.front().y;
+            B = pts.front().x - pts.back().x;
+            C = -A * pts.front().x - B * pts.front().y;
+            return;
+        }
+    }
+    A /= mag;
+    B /= mag;
+    C = -A * meanX - B * meanY;
+}
+
+std::vector<RefLine> findLines(const std::vector<Point>& points, int minInliers,
+                               double distanceThreshold, int maxIterations, uint32_t seed) {
+    std::vector<RefLine> lines;
+    std::vector<Point> remaining = points;
+    std::mt19937 rng(seed);
+
+    int iters = 0;
+    while (iters < maxIterations && remaining.size() > static_cast<size_t>(std::max(minInliers, 0))) {
+        iters++;
+
+        std::uniform_int_distribution<int> dist(0, static_cast<int>(remaining.size()) - 1);
+        int idx1 = dist(rng);
+        int idx2 = dist(rng);
+        if (idx1 == idx2) continue;
+
+        const Point p1 = remaining[idx1];
+        const Point p2 = remaining[idx2];
+        double a = p2.y - p1.y, b = p1.x - p2.x;
+        double c = -a * p1.x - b * p1.y;
+
+        std::vector<Point> inliers;
+        for (const auto& p : remaining) {
+            if (distanceToLine(a, b, c, p) < distanceThreshold) inliers.push_back(p);
+        }
+        if (inliers.size() < static_cast<size_t>(minInliers)) continue;
+
+        RefLine line;
+        fitLine(inliers, line.A, line.B, line.C);
+
+        // Uç noktalar: en uzak inlier çifti, her uçtan 5 * eşik kısaltılmış
+        double best = -1;
+        Point e1, e2;
+        for (size_t i = 0; i < inliers.size(); ++i) {
+            for (size_t j = i + 1; j < inliers.size(); ++j) {
+                double dx = inliers[i].x - inliers[j].x, dy = inliers[i].y - inliers[j].y;
+                if (dx * dx + dy * dy > best) {
+                    best = dx * dx + dy * dy;
+                    e1 = inliers[i];
+                    e2 = inliers[j];
+                }
+            }
+        }
+        double shrink = distanceThreshold * 5;
+        double dx = e2.x - e1.x, dy = e2.y - e1.y;
+        double mag = std::sqrt(dx * dx + dy * dy);
+        if (mag < 2 * shrink) {
+            line.startPoint = line.endPoint = {(e1.x + e2.x) / 2, (e1.y + e2.y) / 2};
+        } else {
+            line.startPoint = {e1.x + dx / mag * shrink, e1.y + dy / mag * shrink};
+            line.endPoint = {e2.x - dx / mag * shrink, e2.y - dy / mag * shrink};
+        }
+
+        // Doğruya atanan noktalar: iyileştirilmiş doğruya eşikten yakın olanlar
+        std::vector<Point> rest;
+        for (const auto& p : remaining) {
+            if (distanceToLine(line.A, line.B, line.C, p) < distanceThreshold) {
+                line.inliers.push_back(p);
+            } else {
+                rest.push_back(p);
+            }
+        }
+        remaining.swap(rest);
+        lines.push_back(std::move(line));
+    }
+    return lines;
+}
+
+// KESİŞİMLER
+static double cross(double ax, double ay, double bx, double by) {
+    return ax * by - ay * bx;
+}
+
+std::vector<Intersection> findIntersections(const std::vector<Line>& segments, double minAngleDeg) {
+    std::vector<Intersection> out;
+    for (size_t i = 0; i < segments.size(); ++i) {
+        for (size_t j = i + 1; j < segments.size(); ++j) {
+            const Line& a = segments[i];
+            const Line& b = segments[j];
+
+            double rx = a.endPoint.x - a.startPoint.x, ry = a.endPoint.y - a.startPoint.y;
+            double sx = b.endPoint.x - b.startPoint.x, sy = b.endPoint.y - b.startPoint.y;
+            double denom = cross(rx, ry, sx, sy);
+            if (std::abs(denom) < 1e-9) continue;
+
+            double qx = b.startPoint.x - a.startPoint.x, qy = b.startPoint.y - a.startPoint.y;
+            double t = cross(qx, qy, sx, sy) / denom;
+            double u = cross(qx, qy, rx, ry) / denom;
+            if (t < 0 || t > 1 || u < 0 || u > 1) continue;
+
+            // Doğru yönleri (B, -A) arasındaki yönsüz açı, [0, 90]
+            double angle = std::abs(std::atan2(cross(a.B, -a.A, b.B, -b.A),
+                                               a.B * b.B + a.A * b.A)) * 180.0 / M_PI;
+            if (angle > 90.0) angle = 180.0 - angle;
+            if (angle < minAngleDeg) continue;
+
+            Point p{a.startPoint.x + t * rx, a.startPoint.y + t * ry};
+            out.push_back({p, angle, std::hypot(p.x, p.y)});
+        }
+    }
+    return out;
+}
+
+} // namespace reference
@@ -0,0 +1,34 @@
+#pragma once
+// Hızlı yolların karşılaştırıldığı sade referans gerçeklemeler.
+// Amaç doğruluk: akış, arena, yerinde sıralama gibi optimizasyonlar yok;
+// her biri ilk sürümlerin davranışını en düz haliyle tekrar eder.
+
+#include "model/types.hpp"
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace reference {
+
+// Satır satır TOML okuma (istringstream + strtod)
+std::optional<LidarScan> parseScanToml(const std::string& text);
+
+// Işın filtresi ve kartezyen dönüşüm (tarama sırasıyla)
+std::vector<Point> convertScan(const LidarScan& scan);
+
+// Kopyalayan RANSAC: her doğru kendi inlier kopyasını taşır
+struct RefLine {
+    double A = 0.0, B = 0.0, C = 0.0;
+    Point startPoint;
+    Point endPoint;
+    std::vector<Point> inliers;
+};
+
+std::vector<RefLine> findLines(const std::vector<Point>& points, int minInliers,
+                               double distanceThreshold, int maxIterations, uint32_t seed);
+
+// Tüm segment çiftleri; açı atan2 ile, kesişim yön/yönelim testi ile bağımsız hesaplanır
+std::vector<Intersection> findIntersections(const std::vector<Line>& segments, double minAngleDeg);
+
+} // namespace reference
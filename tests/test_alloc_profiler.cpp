@@ -0,0 +1,74 @@
+#include "test_framework.hpp"
+#include "utils/alloc_profiler.hpp"
+
+#include <string>
+#include <thread>
+
+// Test ikilisinde kanca yok: sayaçlar yalnızca elle kaydedilenleri görür
+TEST(alloc_profiler_attributes_to_allocating_stage) {
+    AllocProfiler::reset();
+    const AllocProfile before = AllocProfiler::snapshot();
+    const auto ransac = static_cast<size_t>(AllocStage::Ransac);
+    const auto output = static_cast<size_t>(AllocStage::Output);
+
+    {
+        AllocStageScope scope(AllocStage::Ransac);
+        CHECK(AllocProfiler::currentStage() == AllocStage::Ransac);
+        AllocProfiler::recordAlloc(AllocProfiler::currentStage(), 1000);
+        AllocProfiler::recordAlloc(AllocProfiler::currentStage(), 500);
+    }
+    CHECK(AllocProfiler::currentStage() == AllocStage::Other);
+
+    // Çıktı aşamasında bırakılan RANSAC bloğu RANSAC'ın canlı baytından düşer
+    {
+        AllocStageScope scope(AllocStage::Output);
+        AllocProfiler::recordFree(AllocStage::Ransac, 1000);
+        AllocProfiler::recordAlloc(AllocProfiler::currentStage(), 200);
+    }
+
+    const AllocProfile p = AllocProfiler::snapshot();
+    CHECK_EQ(p.stages[ransac].allocations - before.stages[ransac].allocations, uint64_t{2});
+    CHECK_EQ(p.stages[ransac].frees - before.stages[ransac].frees, uint64_t{1});
+    CHECK_EQ(p.stages[ransac].bytes - before.stages[ransac].bytes, uint64_t{1500});
+    CHECK_EQ(p.stages[ransac].liveBytes - before.stages[ransac].liveBytes, int64_t{500});
+    CHECK_EQ(p.stages[ransac].peakLiveBytes - before.stages[ransac].peakLiveBytes, int64_t{1500});
+    CHECK_EQ(p.stages[output].liveBytes - before.stages[output].liveBytes, int64_t{200});
+    CHECK(p.peakLiveBytes - before.peakLiveBytes >= 1500);
+
+    AllocProfiler::recordFree(AllocStage::Ransac, 500);
+    AllocProfiler::recordFree(AllocStage::Output, 200);
+}
+
+TEST(alloc_profiler_reports_arena_use_per_stage) {
+    AllocProfiler::reset();
+    const AllocProfile before = AllocProfiler::snapshot();
+    const auto ransac = static_cast<size_t>(AllocStage::Ransac);
+
+    // Arena ayırması heap sayaçlarına dokunmaz
+    AllocProfiler::recordArena(AllocStage::Ransac, 4096);
+    AllocProfiler::recordArena(AllocStage::Ransac, 64);
+
+    const AllocProfile p = AllocProfiler::snapshot();
+    CHECK_EQ(p.stages[ransac].arenaAllocations, uint64_t{2});
+    CHECK_EQ(p.stages[ransac].arenaBytes, uint64_t{4160});
+    CHECK_EQ(p.stages[ransac].allocations, before.stages[ransac].allocations);
+    CHECK_EQ(p.stages[ransac].liveBytes, before.stages[ransac].liveBytes);
+    CHECK(AllocProfiler::toJson(p).find("\"arena_bytes\":4160") != std::string::npos);
+
+    AllocProfiler::reset();
+    CHECK_EQ(AllocProfiler::snapshot().stages[ransac].arenaBytes, uint64_t{0});
+}
+
+TEST(alloc_profiler_stage_is_per_thread_and_json) {
+    AllocStageScope scope(AllocStage::Read);
+    AllocStage seen = AllocStage::Read;
+    std::thread([&seen] { seen = AllocProfiler::currentStage(); }).join();
+    CHECK(seen == AllocStage::Other);
+    CHECK(AllocProfiler::currentStage() == AllocStage::Read);
+
+    const std::string json = AllocProfiler::toJson(AllocProfiler::snapshot());
+    CHECK(json.find("\"schema\":\"lidar-alloc/1\"") != std::string::npos);
+    CHECK(json.find("\"stage\":\"prefilter\"") != std::string::npos);
+    CHECK(json.find("\"peak_rss_kb\":") != std::string::npos);
+    CHECK_EQ(json.back(), '\n');
+}
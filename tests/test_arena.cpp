@@ -0,0 +1,62 @@
+#include "test_framework.hpp"
+#include "fixtures.hpp"
+#include "model/geometry.hpp"
+#include "model/lidar.hpp"
+#include "model/ransac.hpp"
+#include "utils/scan_arena.hpp"
+
+// 4 m x 3 m oda, hafif gürültü
+static LidarScan roomScan(size_t beams) {
+    fixtures::RoomScanConfig room(beams);
+    room.width = 4.0;
+    room.height = 3.0;
+    return fixtures::roomScan(room);
+}
+
+TEST(arena_results_live_in_arena) {
+    ScanArena arena;
+    LidarScan scan = roomScan(720);
+
+    auto pts = filterAndConvertToPoints(scan, arena.resource());
+    auto lines = findLinesRANSAC(pts, 8, 0.02, 500, arena.resource());
+    auto xs = findPhysicalIntersections(lines, 60.0, arena.resource());
+
+    CHECK(pts.get_allocator().resource() == arena.resource());
+    CHECK(lines.get_allocator().resource() == arena.resource());
+    CHECK(xs.get_allocator().resource() == arena.resource());
+    CHECK(!lines.empty());
+    for (const auto& l : lines) {
+        // Inlier'lar ayrı kopya değil, arenadaki nokta tamponunun bir aralığı
+        CHECK(l.inliers(pts).begin() >= pts.data());
+        CHECK(l.inliers(pts).end() <= pts.data() + pts.size());
+    }
+}
+
+TEST(arena_grows_then_stops_overflowing) {
+    ScanArena arena(4096); // Bilerek küçük: ilk tarama taşar
+    LidarScan scan = roomScan(20000);
+
+    auto runScan = [&] {
+        auto pts = filterAndConvertToPoints(scan, arena.resource());
+        auto lines = findLinesRANSAC(pts, 8, 0.02, 300, arena.resource());
+        auto xs = findPhysicalIntersections(lines, 60.0, arena.resource());
+        return xs.size();
+    };
+
+    runScan();
+    CHECK(arena.overflowAllocations() > 0);
+    // Arena kullanımı her isteği sayar; taşma yalnızca yeni upstream bloklarını
+    CHECK(arena.allocations() > arena.overflowAllocations());
+    const size_t grownCapacity = (arena.reset(), arena.capacity());
+    CHECK(grownCapacity > 4096);
+
+    for (int i = 0; i < 3; ++i) {
+        runScan();
+        CHECK_EQ(arena.overflowAllocations(), size_t{0});
+        CHECK(arena.usedBytes() > 0);
+        arena.reset();
+        CHECK_EQ(arena.allocations(), size_t{0});
+        CHECK_EQ(arena.usedBytes(), size_t{0});
+    }
+    CHECK_EQ(arena.capacity(), grownCapacity);
+}
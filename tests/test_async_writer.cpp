@@ -0,0 +1,115 @@
+#include "test_framework.hpp"
+#include "utils/async_writer.hpp"
+#include "utils/scan_arena.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// İşçiyi ilk işte tutan kapı: sonraki gönderimler kuyrukta birikir
+struct Gate {
+    std::promise<void> open;
+    std::shared_future<void> opened = open.get_future().share();
+    std::promise<void> entered;
+};
+
+static std::vector<int> runPolicy(QueuePolicy policy, size_t capacity, AsyncWriter::Stats& stats) {
+    std::vector<int> written;
+    std::mutex m;
+    Gate gate;
+    {
+        AsyncWriter writer(capacity, policy);
+        writer.submit([&] {
+            gate.entered.set_value();
+            gate.opened.wait();
+        });
+        gate.entered.get_future().wait();
+
+        for (int i = 1; i <= 5; ++i) {
+            writer.submit([&, i] {
+                std::lock_guard<std::mutex> lock(m);
+                written.push_back(i);
+            });
+        }
+        gate.open.set_value();
+        writer.flush();
+        stats = writer.stats();
+    }
+    return written;
+}
+
+TEST(async_writer_drop_oldest_keeps_newest_jobs) {
+    AsyncWriter::Stats st;
+    std::vector<int> w = runPolicy(QueuePolicy::DropOldest, 2, st);
+    CHECK(w == std::vector<int>({4, 5}));
+    CHECK_EQ(st.submitted, size_t{6});
+    CHECK_EQ(st.dropped, size_t{3});
+    CHECK_EQ(st.written, size_t{3});
+}
+
+TEST(async_writer_latest_only_keeps_last_job) {
+    AsyncWriter::Stats st;
+    std::vector<int> w = runPolicy(QueuePolicy::LatestOnly, 4, st);
+    CHECK(w == std::vector<int>({5}));
+    CHECK_EQ(st.dropped, size_t{4});
+}
+
+TEST(async_writer_block_keeps_all_and_reports_wait) {
+    std::vector<int> written;
+    Gate gate;
+    AsyncWriter::Stats st;
+    {
+        AsyncWriter writer(1, QueuePolicy::Block);
+        writer.submit([&] {
+            gate.entered.set_value();
+            gate.opened.wait();
+        });
+        gate.entered.get_future().wait();
+        writer.submit([&] { written.push_back(1); }); // Kuyruk doldu
+
+        // Üçüncü gönderim kapı açılana kadar beklemeli
+        auto opener = std::async(std::launch::async, [&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(30));
+            gate.open.set_value();
+        });
+        writer.submit([&] { written.push_back(2); });
+        opener.wait();
+        writer.flush();
+        st = writer.stats();
+    }
+    CHECK(written == std::vector<int>({1, 2}));
+    CHECK_EQ(st.dropped, size_t{0});
+    CHECK(st.blockedSeconds >= 0.02);
+}
+
+TEST(async_writer_destructor_drains_queue) {
+    std::atomic<int> count{0};
+    {
+        AsyncWriter writer(64, QueuePolicy::Block);
+        for (int i = 0; i < 50; ++i) {
+            writer.submit([&] {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                ++count;
+            });
+        }
+    }
+    CHECK_EQ(count.load(), 50);
+}
+
+// İşte tutulan arena iş bitince havuza döner ve yeniden kullanılır
+TEST(arena_pool_recycles_arenas_released_by_writer) {
+    ScanArenaPool pool(4096);
+    std::shared_ptr<ScanArena> a = pool.acquire();
+    ScanArena* raw = a.get();
+    {
+        AsyncWriter writer(2, QueuePolicy::Block);
+        writer.submit([a] { std::pmr::vector<int> v(100, 1, a->resource()); });
+        a.reset();
+        writer.flush();
+    }
+    CHECK_EQ(pool.idleCount(), size_t{1});
+    CHECK(pool.acquire().get() == raw);
+}
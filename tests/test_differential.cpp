@@ -0,0 +1,210 @@
+// Farksal testler: hızlı yollar (akış ayrıştırıcı, dönüşüm, yerinde RANSAC,
+// kesişimler) rastgele ve sentetik taramalarda reference.hpp ile karşılaştırılır.
+#include "test_framework.hpp"
+#include "fixtures.hpp"
+#include "reference.hpp"
+#include "model/geometry.hpp"
+#include "model/lidar.hpp"
+#include "model/ransac.hpp"
+#include "model/scan_stream.hpp"
+#include "model/toml_writer.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+// Rastgele başlık; değerlerin bir kısmı sentinel veya menzil dışı
+static LidarScan randomScan(std::mt19937& rng, size_t beams) {
+    std::uniform_real_distribution<double> u(0.0, 1.0);
+    LidarScan scan;
+    scan.angle_min = -3.2 + u(rng) * 1.5;
+    scan.angle_increment = (0.2 + u(rng)) * 6.0 / static_cast<double>(beams);
+    scan.angle_max = scan.angle_min + scan.angle_increment * static_cast<double>(beams) * (0.6 + 0.5 * u(rng));
+    scan.range_min = 0.05 + u(rng) * 0.3;
+    scan.range_max = 2.0 + u(rng) * 8.0;
+
+    const double sentinels[] = {-1.0, 999.0, -999.0};
+    for (size_t i = 0; i < beams; ++i) {
+        double p = u(rng);
+        if (p < 0.1) {
+            scan.ranges.push_back(sentinels[rng() % 3]);
+        } else if (p < 0.15) {
+            scan.ranges.push_back(u(rng) * 0.1);       // range_min altı olabilir
+        } else {
+            scan.ranges.push_back(u(rng) * 12.0);      // range_max üstü olabilir
+        }
+    }
+    return scan;
+}
+
+// Aynı taramayı rastgele düzenle (boşluk, satır sonu, yorum, '+', ilgisiz bölümler) yazar
+static std::string randomLayoutToml(const LidarScan& scan, std::mt19937& rng) {
+    auto num = [&rng](double v) {
+        char buf[40];
+        const char* fmt = rng() % 2 ? "%.17g" : "%.17e";
+        std::snprintf(buf, sizeof(buf), fmt, v);
+        std::string s = buf;
+        if (v >= 0 && rng() % 4 == 0) s = "+" + s;
+        return s;
+    };
+    auto space = [&rng]() { return std::string(rng() % 3, rng() % 2 ? ' ' : '\t'); };
+
+    std::string out = "# rastgele duzen\n[header]\nframe_id = \"laser\"\nangle_min = 99\n\n[scan]\n";
+    out += "angle_min" + space() + "=" + space() + num(scan.angle_min) + "\n";
+    out += "  angle_max = " + num(scan.angle_max) + "   # yorum\n";
+    out += "angle_increment= " + num(scan.angle_increment) + "\r\n";
+    out += "time_increment = 0.0\n";
+    out += "range_min =" + num(scan.range_min) + "\n";
+    out += "range_max = " + num(scan.range_max) + "\n\n";
+    out += "ranges = [";
+    for (size_t i = 0; i < scan.ranges.size(); ++i) {
+        out += space() + num(scan.ranges[i]);
+        if (i + 1 < scan.ranges.size()) out += ",";
+        switch (rng() % 8) {
+            case 0: out += "\n"; break;
+            case 1: out += "  # satir yorumu, ] icerir\n"; break;
+            case 2: out += "\r\n    "; break;
+            default: break;
+        }
+    }
+    out += "\n]\n\n[other]\nranges = [1, 2, 3]\n";
+    return out;
+}
+
+template <typename V>
+static bool sameRanges(const V& a, const std::vector<double>& b) {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+}
+
+TEST(diff_toml_stream_parser_matches_reference) {
+    std::mt19937 rng(2024);
+    for (int round = 0; round < 25; ++round) {
+        LidarScan scan = randomScan(rng, 50 + rng() % 400);
+        std::string text = round % 5 == 0 ? formatScanAsToml(scan) : randomLayoutToml(scan, rng);
+
+        auto ref = reference::parseScanToml(text);
+        CHECK(ref.has_value());
+        if (!ref) return;
+
+        // Hızlı yol rastgele parça boyutlarıyla beslenir (parça sınırında kalan sayılar)
+        std::vector<double> ranges;
+        TomlScanStreamParser parser([&ranges](const LidarScan&, size_t, double r) { ranges.push_back(r); });
+        for (size_t pos = 0; pos < text.size();) {
+            size_t n = std::min<size_t>(1 + rng() % 97, text.size() - pos);
+            parser.feed(text.data() + pos, n);
+            pos += n;
+        }
+        parser.finish();
+
+        const LidarScan& h = parser.header();
+        CHECK_EQ(h.angle_min, ref->angle_min);
+        CHECK_EQ(h.angle_max, ref->angle_max);
+        CHECK_EQ(h.angle_increment, ref->angle_increment);
+        CHECK_EQ(h.range_min, ref->range_min);
+        CHECK_EQ(h.range_max, ref->range_max);
+        CHECK_EQ(ranges.size(), ref->ranges.size());
+        CHECK(sameRanges(ref->ranges, ranges));
+        CHECK(sameRanges(scan.ranges, ranges)); // Yazılan değerler bit düzeyinde geri okunur
+    }
+}
+
+TEST(diff_convert_matches_reference) {
+    std::mt19937 rng(7);
+    for (int round = 0; round < 20; ++round) {
+        LidarScan scan = randomScan(rng, 100 + rng() % 2000);
+        std::vector<Point> ref = reference::convertScan(scan);
+
+        auto fast = filterAndConvertToPoints(scan);
+        CHECK_EQ(fast.size(), ref.size());
+        if (fast.size() != ref.size()) return;
+        for (size_t i = 0; i < ref.size(); ++i) {
+            CHECK_NEAR(fast[i].x, ref[i].x, 1e-12);
+            CHECK_NEAR(fast[i].y, ref[i].y, 1e-12);
+        }
+
+        // Float yolu: eşik sınırındaki ışınlar farklı düşebilir, sayı ve konum yakın olmalı
+        LidarScanT<float> scanF = convertScanHeader<float>(scan);
+        for (double r : scan.ranges) scanF.ranges.push_back(static_cast<float>(r));
+        auto fastF = filterAndConvertToPoints(scanF);
+        CHECK(fastF.size() + 2 >= ref.size() && fastF.size() <= ref.size() + 2);
+        if (fastF.size() == ref.size()) {
+            for (size_t i = 0; i < ref.size(); ++i) {
+                CHECK_NEAR(fastF[i].x, ref[i].x, 1e-4);
+                CHECK_NEAR(fastF[i].y, ref[i].y, 1e-4);
+            }
+        }
+    }
+}
+
+static bool lessPoint(const Point& a, const Point& b) {
+    return a.x < b.x || (a.x == b.x && a.y < b.y);
+}
+
+TEST(diff_ransac_in_place_matches_copying_reference) {
+    for (uint32_t seed = 1; seed <= 8; ++seed) {
+        std::vector<Point> input = fixtures::scenePoints(seed);
+        std::vector<reference::RefLine> ref = reference::findLines(input, 12, 0.02, 2000, seed);
+
+        std::pmr::vector<Point> pts(input.begin(), input.end());
+        auto fast = findLinesRANSAC(pts, 12, 0.02, 2000, std::pmr::get_default_resource(), seed);
+
+        CHECK_EQ(fast.size(), ref.size());
+        if (fast.size() != ref.size()) return;
+
+        for (size_t i = 0; i < ref.size(); ++i) {
+            CHECK_NEAR(fast[i].A, ref[i].A, 1e-9);
+            CHECK_NEAR(fast[i].B, ref[i].B, 1e-9);
+            CHECK_NEAR(fast[i].C, ref[i].C, 1e-9);
+            CHECK_NEAR(fast[i].startPoint.x, ref[i].startPoint.x, 1e-9);
+            CHECK_NEAR(fast[i].startPoint.y, ref[i].startPoint.y, 1e-9);
+            CHECK_NEAR(fast[i].endPoint.x, ref[i].endPoint.x, 1e-9);
+            CHECK_NEAR(fast[i].endPoint.y, ref[i].endPoint.y, 1e-9);
+
+            // Aralık ile kopya aynı nokta kümesini göstermeli (sıra serbest)
+            auto span = fast[i].inliers(pts);
+            std::vector<Point> a(span.begin(), span.end());
+            std::vector<Point> b = ref[i].inliers;
+            std::sort(a.begin(), a.end(), lessPoint);
+            std::sort(b.begin(), b.end(), lessPoint);
+            CHECK(a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(),
+                  [](const Point& p, const Point& q) { return p.x == q.x && p.y == q.y; }));
+        }
+    }
+}
+
+static void checkIntersectionsMatch(const std::pmr::vector<Line>& segs, double minAngleDeg) {
+    std::vector<Line> plain(segs.begin(), segs.end());
+    std::vector<Intersection> ref = reference::findIntersections(plain, minAngleDeg);
+    auto fast = findPhysicalIntersections(segs, minAngleDeg);
+
+    CHECK_EQ(fast.size(), ref.size());
+    if (fast.size() != ref.size()) return;
+    for (size_t i = 0; i < ref.size(); ++i) {
+        CHECK_NEAR(fast[i].position.x, ref[i].position.x, 1e-9);
+        CHECK_NEAR(fast[i].position.y, ref[i].position.y, 1e-9);
+        CHECK_NEAR(fast[i].angleDeg, ref[i].angleDeg, 1e-6);
+        CHECK_NEAR(fast[i].distanceToRobot, ref[i].distanceToRobot, 1e-9);
+    }
+}
+
+TEST(diff_intersections_match_reference) {
+    std::mt19937 rng(99);
+    std::uniform_real_distribution<double> u(-3.0, 3.0);
+    for (int round = 0; round < 10; ++round) {
+        std::pmr::vector<Line> segs;
+        for (int i = 0; i < 150; ++i) {
+            segs.push_back(fixtures::segment({u(rng), u(rng)}, {u(rng), u(rng)}));
+        }
+        checkIntersectionsMatch(segs, 10.0 * round);
+    }
+
+    // RANSAC çıktısı: gerçek köşeler ve paralel duvarlar
+    for (uint32_t seed = 1; seed <= 4; ++seed) {
+        std::vector<Point> input = fixtures::scenePoints(seed);
+        std::pmr::vector<Point> pts(input.begin(), input.end());
+        auto lines = findLinesRANSAC(pts, 12, 0.02, 2000, std::pmr::get_default_resource(), seed);
+        checkIntersectionsMatch(lines, 60.0);
+    }
+}
@@ -0,0 +1,63 @@
+#include "test_framework.hpp"
+#include "model/downsample.hpp"
+
+#include <random>
+
+TEST(voxel_centroid_averages_each_cell_in_scan_order) {
+    VoxelDownsampler<double> voxel(VoxelParams{0.1, VoxelPolicy::Centroid, 0});
+    // Üç hücre, biri negatif koordinatlarda; hücreler ilk görülme sırasıyla çıkar
+    std::pmr::vector<Point> pts = {
+        {0.01, 0.01}, {-0.05, -0.05}, {0.03, 0.05}, {0.25, 0.01}, {-0.03, -0.09}, {0.08, 0.03}
+    };
+    auto out = voxel.apply(pts);
+    CHECK_EQ(out.size(), size_t{3});
+    CHECK_NEAR(out[0].x, 0.04, 1e-12);
+    CHECK_NEAR(out[0].y, 0.03, 1e-12);
+    CHECK_NEAR(out[1].x, -0.04, 1e-12);
+    CHECK_NEAR(out[1].y, -0.07, 1e-12);
+    CHECK_NEAR(out[2].x, 0.25, 1e-12);
+    CHECK_EQ(voxel.stats().inputPoints, size_t{6});
+    CHECK_EQ(voxel.stats().cells, size_t{3});
+}
+
+TEST(voxel_first_policy_keeps_original_points) {
+    VoxelDownsampler<float> voxel(VoxelParams{0.1, VoxelPolicy::First, 0});
+    std::pmr::vector<PointT<float>> pts = {{0.01f, 0.01f}, {0.05f, 0.05f}, {0.15f, 0.01f}, {0.19f, 0.09f}};
+    auto out = voxel.apply(pts);
+    CHECK_EQ(out.size(), size_t{2});
+    CHECK_EQ(out[0].x, 0.01f);
+    CHECK_EQ(out[1].x, 0.15f);
+}
+
+TEST(voxel_table_reuse_and_point_cap) {
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> pos(-20.0, 20.0);
+
+    // Büyük kare tabloyu büyütür; sonraki küçük kareler önceki karenin girdilerini görmemeli
+    VoxelDownsampler<double> voxel(VoxelParams{0.5, VoxelPolicy::First, 0});
+    std::pmr::vector<Point> big;
+    for (int i = 0; i < 20000; ++i) big.push_back({pos(rng), pos(rng)});
+    auto thinned = voxel.apply(big);
+    CHECK(thinned.size() < big.size());
+    CHECK(thinned.size() <= size_t{80 * 80});
+
+    for (int frame = 0; frame < 3; ++frame) {
+        std::pmr::vector<Point> small = {{1.1, 1.1}, {1.2, 1.2}, {-3.0, 4.0}};
+        auto out = voxel.apply(small);
+        CHECK_EQ(out.size(), size_t{2});
+        CHECK_EQ(out[0].x, 1.1);
+    }
+
+    // Üst sınır: eşit aralıklı seçim, sıra korunur
+    VoxelDownsampler<double> capped(VoxelParams{0.01, VoxelPolicy::Centroid, 100});
+    std::pmr::vector<Point> line;
+    for (int i = 0; i < 1000; ++i) line.push_back({i * 0.1, 0.0});
+    auto out = capped.apply(line);
+    CHECK_EQ(out.size(), size_t{100});
+    CHECK_EQ(capped.stats().cells, size_t{1000});
+    CHECK_EQ(capped.stats().outputPoints, size_t{100});
+    bool increasing = true;
+    for (size_t i = 1; i < out.size(); ++i) increasing = increasing && out[i].x > out[i - 1].x;
+    CHECK(increasing);
+    CHECK_NEAR(out[1].x, 1.0, 1e-9);
+}
@@ -0,0 +1,51 @@
+#include "test_framework.hpp"
+#include "utils/flat_hash.hpp"
+
+#include <cstdint>
+
+TEST(flat_hash_inserts_finds_and_grows) {
+    FlatHashMap<uint32_t> map;
+    CHECK_EQ(map.capacity(), size_t{16});
+    CHECK(map.find(7) == nullptr);
+
+    // Aynı üst bitlere düşen anahtarlar da (yalnızca alt bitleri farklı) doğrusal yoklamayla ayrışır
+    const uint32_t n = 1000;
+    for (uint32_t i = 0; i < n; ++i) {
+        auto [v, inserted] = map.tryEmplace(uint64_t{i} << 32 | (i & 3));
+        CHECK(inserted);
+        CHECK_EQ(*v, uint32_t{0});
+        *v = i;
+    }
+    CHECK_EQ(map.size(), size_t{n});
+    CHECK(map.capacity() >= 2 * map.size());
+
+    for (uint32_t i = 0; i < n; ++i) {
+        const uint32_t* v = map.find(uint64_t{i} << 32 | (i & 3));
+        CHECK(v != nullptr);
+        if (v) CHECK_EQ(*v, i);
+    }
+    auto [again, inserted] = map.tryEmplace(uint64_t{5} << 32 | 1);
+    CHECK(!inserted);
+    CHECK_EQ(*again, uint32_t{5});
+    CHECK(map.find(uint64_t{5} << 32) == nullptr);
+
+    uint64_t sum = 0;
+    size_t visited = 0;
+    map.forEach([&](uint64_t, uint32_t& v) { sum += v; ++visited; });
+    CHECK_EQ(visited, size_t{n});
+    CHECK_EQ(sum, uint64_t{n} * (n - 1) / 2);
+}
+
+TEST(flat_hash_clear_keeps_capacity) {
+    FlatHashMap<int> map;
+    map.reserve(100);
+    const size_t capacity = map.capacity();
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 100; ++i) *map.tryEmplace(static_cast<uint64_t>(round * 1000 + i)).first = i;
+        CHECK_EQ(map.size(), size_t{100});
+        map.clear();
+        CHECK_EQ(map.size(), size_t{0});
+        CHECK(map.find(static_cast<uint64_t>(round * 1000)) == nullptr);
+    }
+    CHECK_EQ(map.capacity(), capacity);
+}
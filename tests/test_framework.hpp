@@ -0,0 +1,67 @@
+#pragma once
+// Bağımlılıksız küçük test altyapısı: TEST ile kayıt, CHECK* ile doğrulama.
+
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace testing_mini {
+
+struct TestCase {
+    const char* name;
+    std::function<void()> body;
+};
+
+inline std::vector<TestCase>& registry() {
+    static std::vector<TestCase> tests;
+    return tests;
+}
+
+inline int& failureCount() {
+    static int failures = 0;
+    return failures;
+}
+
+struct Registrar {
+    Registrar(const char* name, std::function<void()> body) {
+        registry().push_back({name, std::move(body)});
+    }
+};
+
+inline void reportFailure(const char* file, int line, const std::string& msg) {
+    ++failureCount();
+    std::cerr << file << ":" << line << ": FAIL: " << msg << "\n";
+}
+
+} // namespace testing_mini
+
+#define TEST_CONCAT_INNER(a, b) a##b
+#define TEST_CONCAT(a, b) TEST_CONCAT_INNER(a, b)
+
+#define TEST(name)                                                              \
+    static void name();                                                         \
+    static testing_mini::Registrar TEST_CONCAT(name, _registrar)(#name, name);  \
+    static void name()
+
+#define CHECK(cond)                                                             \
+    do {                                                                        \
+        if (!(cond)) testing_mini::reportFailure(__FILE__, __LINE__, #cond);    \
+    } while (0)
+
+#define CHECK_EQ(a, b)                                                          \
+    do {                                                                        \
+        if (!((a) == (b)))                                                      \
+            testing_mini::reportFailure(__FILE__, __LINE__,                     \
+                std::string(#a " == " #b " (") + std::to_string(a) + " vs " +   \
+                std::to_string(b) + ")");                                       \
+    } while (0)
+
+#define CHECK_NEAR(a, b, tol)                                                   \
+    do {                                                                        \
+        if (!(std::abs((a) - (b)) <= (tol)))                                    \
+            testing_mini::reportFailure(__FILE__, __LINE__,                     \
+                std::string(#a " ~= " #b " (") + std::to_string(a) + " vs " +   \
+                std::to_string(b) + ")");                                       \
+    } while (0)
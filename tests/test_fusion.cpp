@@ -0,0 +1,158 @@
+#include "test_framework.hpp"
+#include "controller/app_controller.hpp"
+#include "model/fusion.hpp"
+#include "model/lidar.hpp"
+#include "model/scene.hpp"
+#include "utils/scan_sync.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <string>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+TEST(fusion_identity_mount_matches_single_conversion) {
+    Scene scene;
+    addRoom(scene, 0.0, 0.0, 5.0, 3.0);
+    ScanSimConfig cfg;
+    cfg.beams = 1000;
+    cfg.dropoutRate = 0.1;
+    cfg.noiseSigma = 0.01;
+    const LidarScan scan = simulateScan(scene, SensorPose{0.3, 0.1, 0.2}, cfg);
+
+    ScanFuser<double> fuser({SensorMount{}});
+    auto fused = fuser.fuse({&scan});
+    auto single = filterAndConvertToPoints(scan);
+
+    CHECK_EQ(fused.size(), single.size());
+    bool same = fused.size() == single.size();
+    for (size_t i = 0; same && i < single.size(); ++i) {
+        same = fused[i].x == single[i].x && fused[i].y == single[i].y;
+    }
+    CHECK(same);
+}
+
+TEST(fusion_mounted_sensors_land_on_vehicle_frame_walls) {
+    // Araç odanın merkezinde; sensör pozları montajla aynı
+    Scene scene;
+    addRoom(scene, 0.0, 0.0, 4.0, 4.0);
+    const std::vector<SensorMount> mounts = {{0.8, 0.0, 0.0}, {-0.8, 0.3, 3.1}, {0.0, -0.5, -1.2}};
+
+    ScanSimConfig cfg;
+    cfg.beams = 4000; // Paralel yol (toplam ışın eşiğin üstünde)
+    std::vector<LidarScan> scans;
+    for (const auto& m : mounts) {
+        scans.push_back(simulateScan(scene, SensorPose{m.x, m.y, m.yaw}, cfg));
+    }
+
+    ScanFuser<float> fuser(mounts);
+    std::vector<size_t> counts;
+    auto cloud = fuser.fuse({&scans[0], &scans[1], &scans[2]}, std::pmr::get_default_resource(), &counts);
+
+    CHECK_EQ(counts.size(), size_t{3});
+    CHECK_EQ(cloud.size(), counts[0] + counts[1] + counts[2]);
+    CHECK(cloud.size() > 3 * 3500);
+
+    size_t offWall = 0;
+    for (const auto& p : cloud) {
+        const double d = std::min(std::abs(std::abs(p.x) - 2.0), std::abs(std::abs(p.y) - 2.0));
+        offWall += d > 1e-3 ? 1 : 0;
+    }
+    CHECK_EQ(offWall, size_t{0});
+
+    // Eksik sensör: yalnızca diğerlerinin noktaları (tablolar yeniden kullanılır)
+    auto partial = fuser.fuse({&scans[0], nullptr, &scans[2]});
+    CHECK_EQ(partial.size(), counts[0] + counts[2]);
+}
+
+TEST(sync_bounded_wait_emits_partial_frame) {
+    ScanSynchronizer sync(2, 1e9, std::chrono::milliseconds(30));
+    auto scan = std::make_shared<const LidarScan>();
+
+    sync.push(0, 0.0, scan);
+    const auto t0 = std::chrono::steady_clock::now();
+    auto frame = sync.next(); // Sensör 1 hiç gelmez: en fazla ~30 ms beklenir
+    const double waited = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    CHECK(frame.has_value());
+    if (!frame) return;
+    CHECK_EQ(frame->present, size_t{1});
+    CHECK(frame->scans[0] != nullptr);
+    CHECK(frame->scans[1] == nullptr);
+    CHECK(waited < 1.0);
+    CHECK_EQ(sync.stats().partialFrames, size_t{1});
+
+    sync.close(0);
+    sync.close(1);
+    CHECK(!sync.next().has_value());
+}
+
+TEST(sync_drops_skewed_scans_and_waits_for_late_sensor) {
+    ScanSynchronizer sync(3, 0.05, std::chrono::milliseconds(2000));
+    auto scan = std::make_shared<const LidarScan>();
+
+    sync.push(0, 10.00, scan);
+    sync.push(1, 9.80, scan);   // 200 ms eski: atılır
+    sync.push(1, 9.90, scan);   // Tüketilmeden yenisi gelir, yine eski
+    std::thread late([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        sync.push(2, 10.02, scan);
+    });
+
+    auto frame = sync.next(); // Tüm sensörler gelince beklemeden döner
+    late.join();
+
+    CHECK(frame.has_value());
+    if (!frame) return;
+    CHECK_EQ(frame->present, size_t{2});
+    CHECK(frame->scans[1] == nullptr);
+    CHECK(frame->scans[2] != nullptr);
+    CHECK_NEAR(frame->stamp, 10.02, 1e-12);
+
+    auto st = sync.stats();
+    CHECK_EQ(st.skewDropped, size_t{1});
+    CHECK_EQ(st.overwritten, size_t{1});
+}
+
+#ifndef _WIN32
+TEST(fused_read_does_not_wait_for_stalled_sensor) {
+    // İkinci sensör hiç yazılmayan bir FIFO: okuyucusu açılışta takılı kalır. Kare
+    // syncWaitMs sonunda yalnızca ilk sensörle çıkar, takılı okuyucu beklenmez
+    namespace fs = std::filesystem;
+    const fs::path fifo = fs::temp_directory_path() / "lidar_stalled_sensor";
+    const fs::path svg = fs::temp_directory_path() / "lidar_stalled_sensor.svg";
+    fs::remove(fifo);
+    CHECK_EQ(mkfifo(fifo.c_str(), 0600), 0);
+
+    CliParams params;
+    params.sensors = {{std::string(LIDAR_DATA_DIR) + "/lidar1.toml", SensorMount{}}, {fifo.string(), SensorMount{}}};
+    params.syncWaitMs = 200;
+    params.seed = 1;
+    params.quiet = true;
+    params.outSvg = svg.string();
+    AppController app(params);
+    auto reader = app.results().reader();
+
+    const auto t0 = std::chrono::steady_clock::now();
+    app.run();
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+    // Analiz ve SVG örnek taramada birkaç ms; pay zamanlayıcı gecikmeleri için
+    CHECK(ms < params.syncWaitMs + 500.0);
+    CHECK(reader.read().version() == 1);
+    CHECK(reader.read()->pointCount > 0);
+
+    // Takılı okuyucuyu serbest bırak: yazıcı açılıp kapanınca boş girdi okur ve çıkar
+    const int fd = open(fifo.c_str(), O_WRONLY);
+    if (fd >= 0) close(fd);
+    fs::remove(fifo);
+    fs::remove(svg);
+}
+#endif
@@ -0,0 +1,73 @@
+#include "test_framework.hpp"
+#include "fixtures.hpp"
+#include "model/geometry.hpp"
+#include "model/ransac.hpp"
+
+#include <cmath>
+
+using fixtures::segment;
+
+TEST(geometry_crossing_segments_intersect) {
+    auto p = getSegmentIntersection(segment({-1, 0}, {1, 0}), segment({0, -1}, {0, 1}));
+    CHECK(p.has_value());
+    if (p) {
+        CHECK_NEAR(p->x, 0.0, 1e-12);
+        CHECK_NEAR(p->y, 0.0, 1e-12);
+    }
+}
+
+TEST(geometry_parallel_and_disjoint_segments) {
+    CHECK(!getSegmentIntersection(segment({0, 0}, {1, 0}), segment({0, 1}, {1, 1})).has_value());
+    CHECK(!getSegmentIntersection(segment({0, 0}, {1, 0}), segment({2, -1}, {2, 1})).has_value());
+}
+
+TEST(geometry_angle_threshold_filters_shallow_pairs) {
+    std::pmr::vector<Line> segs = {
+        segment({-1, 1}, {1, 1}),     // yatay
+        segment({0, 0}, {0, 2}),      // dikey -> 90 derece
+        segment({-1, 0.8}, {1, 1.2}), // ~11 derece
+    };
+    auto xs = findPhysicalIntersections(segs, 60.0);
+    CHECK_EQ(xs.size(), size_t{2});
+    for (const auto& x : xs) {
+        CHECK(x.angleDeg >= 60.0);
+        CHECK_NEAR(x.distanceToRobot, std::hypot(x.position.x, x.position.y), 1e-12);
+    }
+}
+
+// RANSAC noktaları yerinde sıralar: doğruların inlier aralıkları ardışık ve ayrık,
+// nokta kümesi korunur ve her inlier kendi doğrusuna eşik mesafesinden yakındır
+TEST(ransac_inlier_spans_partition_point_buffer) {
+    std::pmr::vector<Point> pts;
+    for (int i = 0; i < 200; ++i) {
+        const double t = -1.0 + i * 0.01;
+        pts.push_back({t, 1.0});   // y = 1
+        pts.push_back({1.5, t});   // x = 1.5
+    }
+    pts.push_back({-2.0, -2.5}); // Hiçbir doğruya ait değil
+
+    double sumBefore = 0.0;
+    for (const auto& p : pts) sumBefore += p.x * 3.0 + p.y;
+
+    const double eps = 0.02;
+    auto lines = findLinesRANSAC(pts, 40, eps, 500, std::pmr::get_default_resource(), 5);
+    CHECK_EQ(lines.size(), size_t{2});
+
+    double sumAfter = 0.0;
+    for (const auto& p : pts) sumAfter += p.x * 3.0 + p.y;
+    CHECK_EQ(pts.size(), size_t{401});
+    CHECK_NEAR(sumAfter, sumBefore, 1e-9);
+
+    uint32_t next = 0;
+    for (const auto& l : lines) {
+        CHECK_EQ(l.inlierOffset, next);
+        CHECK(l.inlierCount >= 180);
+        next = l.inlierOffset + l.inlierCount;
+
+        const double norm = std::hypot(l.A, l.B);
+        for (const auto& p : l.inliers(pts)) {
+            CHECK(std::abs(l.A * p.x + l.B * p.y + l.C) / norm < eps);
+        }
+    }
+    CHECK(next < pts.size());
+}
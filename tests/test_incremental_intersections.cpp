@@ -0,0 +1,174 @@
+#include "test_framework.hpp"
+#include "fixtures.hpp"
+#include "model/geometry.hpp"
+#include "model/incremental_intersections.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using fixtures::segment;
+
+static Line randomSegment(std::mt19937& rng) {
+    std::uniform_real_distribution<double> pos(-5.0, 5.0);
+    return segment({pos(rng), pos(rng)}, {pos(rng), pos(rng)});
+}
+
+static bool sameIntersections(const std::pmr::vector<Intersection>& a, const std::pmr::vector<Intersection>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        // Çift sırası farklı olabilir: yalnızca yuvarlama farkı
+        if (std::abs(a[i].position.x - b[i].position.x) > 1e-9 || std::abs(a[i].position.y - b[i].position.y) > 1e-9 ||
+            std::abs(a[i].angleDeg - b[i].angleDeg) > 1e-9) {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST(incremental_unchanged_frame_reuses_every_pair) {
+    std::mt19937 rng(3);
+    std::pmr::vector<Line> segs;
+    for (int i = 0; i < 40; ++i) segs.push_back(randomSegment(rng));
+
+    IncrementalIntersector<double> engine(60.0, 0.01);
+    auto first = engine.update(segs);
+    CHECK(sameIntersections(first, findPhysicalIntersections(segs, 60.0)));
+    CHECK_EQ(engine.stats().pairsEvaluated, size_t{40 * 39 / 2});
+    const std::vector<uint64_t> firstIds = engine.ids();
+    CHECK_EQ(engine.stats().newIds, first.size());
+
+    // Aynı parçalar farklı sırada ve küçük titreşimle: hiç çift hesaplanmaz, kimlikler korunur
+    std::pmr::vector<Line> jittered(segs.rbegin(), segs.rend());
+    for (auto& l : jittered) {
+        l.startPoint.x += 0.004;
+        l.endPoint.y -= 0.004;
+    }
+    auto second = engine.update(jittered);
+    CHECK_EQ(engine.stats().matched, size_t{40});
+    CHECK_EQ(engine.stats().pairsEvaluated, size_t{0});
+    CHECK_EQ(engine.stats().newIds, size_t{0});
+    CHECK_EQ(second.size(), first.size());
+
+    std::vector<uint64_t> a = firstIds, b = engine.ids();
+    std::sort(a.begin(), a.end());
+    std::sort(b.begin(), b.end());
+    CHECK(a == b);
+}
+
+TEST(incremental_changed_segment_evaluates_only_its_pairs) {
+    // Izgara: 3 yatay x 3 dikey = 9 kesişim
+    std::pmr::vector<Line> segs;
+    for (int k = 0; k < 3; ++k) {
+        segs.push_back(segment({-1.0, k * 1.0}, {3.0, k * 1.0}));
+        segs.push_back(segment({k * 1.0, -1.0}, {k * 1.0, 3.0}));
+    }
+
+    IncrementalIntersector<double> engine(60.0, 0.01);
+    engine.update(segs);
+    CHECK_EQ(engine.ids().size(), size_t{9});
+    const std::vector<uint64_t> before = engine.ids();
+    const std::pmr::vector<Intersection> beforePos = findPhysicalIntersections(segs, 60.0);
+
+    // Bir dikey parça toleranstan fazla kayar: yalnızca onu içeren 5 çift hesaplanır
+    segs[1] = segment({0.05, -1.0}, {0.05, 3.0});
+    auto xs = engine.update(segs);
+    CHECK_EQ(engine.stats().fresh, size_t{1});
+    CHECK_EQ(engine.stats().pairsEvaluated, size_t{5});
+    CHECK_EQ(engine.stats().pairsReused, size_t{10});
+    CHECK(sameIntersections(xs, findPhysicalIntersections(segs, 60.0)));
+
+    // Kayan kesişimler tolerans dışında: yeni kimlik; diğerleri aynı kimlikte
+    CHECK_EQ(engine.stats().newIds, size_t{3});
+    size_t kept = 0;
+    for (size_t i = 0; i < xs.size(); ++i) {
+        for (size_t j = 0; j < beforePos.size(); ++j) {
+            if (std::abs(xs[i].position.x - beforePos[j].position.x) < 1e-9 &&
+                std::abs(xs[i].position.y - beforePos[j].position.y) < 1e-9) {
+                CHECK_EQ(engine.ids()[i], before[j]);
+                ++kept;
+            }
+        }
+    }
+    CHECK_EQ(kept, size_t{6});
+}
+
+TEST(incremental_exact_mode_matches_stateless_over_frames) {
+    // Tolerans 0: yalnızca birebir aynı parçalar eşlenir, sonuç her karede durumsuz hesapla aynıdır
+    std::mt19937 rng(11);
+    std::pmr::vector<Line> segs;
+    for (int i = 0; i < 30; ++i) segs.push_back(randomSegment(rng));
+
+    IncrementalIntersector<double> engine(45.0, 0.0);
+    size_t reused = 0;
+    for (int frame = 0; frame < 20; ++frame) {
+        // Parçaların bir kısmı değişir, bazıları kaybolur / eklenir, sıra karışır
+        for (auto& l : segs) {
+            if (rng() % 4 == 0) l = randomSegment(rng);
+        }
+        if (rng() % 2 == 0 && !segs.empty()) segs.erase(segs.begin() + static_cast<std::ptrdiff_t>(rng() % segs.size()));
+        if (rng() % 2 == 0) segs.push_back(randomSegment(rng));
+        std::shuffle(segs.begin(), segs.end(), rng);
+
+        auto xs = engine.update(segs);
+        const auto ref = findPhysicalIntersections(segs, 45.0);
+        CHECK(sameIntersections(xs, ref));
+        CHECK_EQ(engine.ids().size(), xs.size());
+        reused += engine.stats().pairsReused;
+    }
+    CHECK(reused > 0);
+}
+
+TEST(incremental_cache_tracks_only_current_intersections) {
+    // Her karede parçaların yarısı yenilenir: eski slotların çiftleri önbellekte birikmez
+    std::mt19937 rng(11);
+    std::pmr::vector<Line> segs;
+    for (int i = 0; i < 60; ++i) segs.push_back(randomSegment(rng));
+
+    IncrementalIntersector<double> engine(60.0, 0.0);
+    for (int frame = 0; frame < 50; ++frame) {
+        for (size_t i = frame % 2; i < segs.size(); i += 2) segs[i] = randomSegment(rng);
+        auto got = engine.update(segs);
+        CHECK(sameIntersections(got, findPhysicalIntersections(segs, 60.0)));
+        CHECK_EQ(engine.stats().cachedPairs, got.size());
+        CHECK_EQ(engine.stats().fresh, frame == 0 ? segs.size() : size_t{30});
+    }
+}
+
+TEST(incremental_moved_segments_hand_over_nearby_ids) {
+    // 12 x 12 ızgara: ikinci karede her parça kendi doğrultusunda toleranstan fazla kayar
+    // (hiçbiri eşlenmez, 144 kesişimin hepsi yeniden hesaplanır), kesişimler ise yalnızca
+    // dikine titreşim kadar oynar: her kesişim önceki karedeki en yakın komşusunun kimliğini alır
+    std::pmr::vector<Line> segs, moved;
+    for (int i = 0; i < 12; ++i) {
+        const double c = 0.5 * i;
+        segs.push_back(segment({-1.0, c}, {6.5, c}));
+        segs.push_back(segment({c, -1.0}, {c, 6.5}));
+        const double wobble = (i % 2 == 0 ? 0.003 : -0.003);
+        moved.push_back(segment({-1.05, c + wobble}, {6.45, c + wobble}));
+        moved.push_back(segment({c + wobble, -0.95}, {c + wobble, 6.55}));
+    }
+
+    IncrementalIntersector<double> engine(60.0, 0.02);
+    const auto first = engine.update(segs);
+    const std::vector<uint64_t> firstIds = engine.ids();
+    CHECK_EQ(first.size(), size_t{144});
+
+    const auto second = engine.update(moved);
+    CHECK_EQ(engine.stats().matched, size_t{0});
+    CHECK_EQ(engine.stats().newIds, size_t{0});
+    CHECK_EQ(second.size(), first.size());
+    for (size_t k = 0; k < second.size(); ++k) {
+        size_t nearest = 0;
+        double best = 1e9;
+        for (size_t q = 0; q < first.size(); ++q) {
+            const double d = std::hypot(first[q].position.x - second[k].position.x,
+                                        first[q].position.y - second[k].position.y);
+            if (d < best) {
+                best = d;
+                nearest = q;
+            }
+        }
+        CHECK_EQ(engine.ids()[k], firstIds[nearest]);
+    }
+}
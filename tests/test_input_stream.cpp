@@ -0,0 +1,32 @@
+#include "test_framework.hpp"
+#include "utils/input_stream.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+TEST(input_stream_reads_file_in_chunks) {
+    const std::string path = std::string(LIDAR_DATA_DIR) + "/lidar1.toml";
+    std::string bytes, error;
+    CHECK(readInputChunks(path, [&bytes](const char* d, size_t n) { bytes.append(d, n); }, error));
+    CHECK_EQ(bytes.size(), static_cast<size_t>(fs::file_size(path)));
+
+    CHECK(!readInputChunks(path + ".yok", [](const char*, size_t) {}, error));
+    CHECK(!error.empty());
+}
+
+TEST(input_stream_url_is_not_passed_through_a_shell) {
+    // Kabuk çalışsaydı işaret dosyaları oluşurdu; bağlantı noktası 9'da dinleyen yok
+    const fs::path a = fs::temp_directory_path() / "lidar_url_inject_a";
+    const fs::path b = fs::temp_directory_path() / "lidar_url_inject_b";
+    fs::remove(a);
+    fs::remove(b);
+    const std::string url = "http://127.0.0.1:9/$(touch " + a.string() + ")`touch " + b.string() + "`\";touch " + b.string() + ";\"";
+
+    std::string error;
+    CHECK(!readInputChunks(url, [](const char*, size_t) {}, error));
+    CHECK(!error.empty());
+    CHECK(!fs::exists(a));
+    CHECK(!fs::exists(b));
+}
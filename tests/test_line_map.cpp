@@ -0,0 +1,103 @@
+#include "test_framework.hpp"
+#include "model/lidar.hpp"
+#include "model/line_map.hpp"
+#include "model/ransac.hpp"
+#include "model/scene.hpp"
+
+#include <cmath>
+
+// Her duvar a'dan b'ye eşit aralıklı count nokta; inlier aralıkları sırayla
+struct Frame {
+    std::pmr::vector<Point> points;
+    std::pmr::vector<Line> lines;
+};
+
+static void addWall(Frame& f, Point a, Point b, int count) {
+    Line l;
+    const double len = std::hypot(b.x - a.x, b.y - a.y);
+    l.A = -(b.y - a.y) / len;
+    l.B = (b.x - a.x) / len;
+    l.C = -l.A * a.x - l.B * a.y;
+    l.inlierOffset = static_cast<uint32_t>(f.points.size());
+    l.inlierCount = static_cast<uint32_t>(count);
+    l.startPoint = a;
+    l.endPoint = b;
+    for (int i = 0; i < count; ++i) {
+        const double t = static_cast<double>(i) / (count - 1);
+        f.points.push_back(Point{a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t});
+    }
+    f.lines.push_back(l);
+}
+
+TEST(line_map_merges_walls_seen_from_several_poses) {
+    Scene scene;
+    addRoom(scene, 0.0, 0.0, 6.0, 4.0);
+    ScanSimConfig cfg;
+    cfg.beams = 720;
+    cfg.noiseSigma = 0.003;
+
+    LineMap map;
+    const SensorPose poses[] = {{0.0, 0.0, 0.0}, {0.8, 0.3, 0.4}, {-1.0, -0.5, -1.2}};
+    uint32_t seed = 1;
+    for (const SensorPose& pose : poses) {
+        cfg.seed = seed;
+        auto points = filterAndConvertToPoints(simulateScan(scene, pose, cfg));
+        auto lines = findLinesRANSAC(points, 20, 0.02, 500, std::pmr::get_default_resource(), seed++);
+        map.integrate(points, lines, pose);
+    }
+
+    CHECK_EQ(map.stats().frames, size_t{3});
+    CHECK_EQ(map.size(), size_t{4});
+    for (const Line& l : map.lines()) {
+        // Dünya çerçevesinde eksen hizalı duvarlar: x = +-3 veya y = +-2
+        const bool vertical = std::abs(l.A) > std::abs(l.B);
+        CHECK_NEAR(std::abs(vertical ? l.B : l.A), 0.0, 2e-3);
+        CHECK_NEAR(std::abs(l.C), vertical ? 3.0 : 2.0, 5e-3);
+        CHECK(l.inlierCount > 300u);
+    }
+    for (const MapSegment& s : map.segments()) {
+        if (s.alive) CHECK_EQ(s.observations, 3u);
+    }
+}
+
+TEST(line_map_extends_and_bridges_segments) {
+    LineMap map;
+    Frame a, b, c;
+    addWall(a, Point{0.0, 1.0}, Point{2.0, 1.0}, 41);
+    addWall(b, Point{3.0, 1.0}, Point{5.0, 1.0}, 41);
+    map.integrate(a.points, a.lines, SensorPose{});
+    map.integrate(b.points, b.lines, SensorPose{});
+    CHECK_EQ(map.size(), size_t{2});   // 1 m boşluk > maxGap
+
+    addWall(c, Point{1.8, 1.0}, Point{3.2, 1.0}, 29);
+    map.integrate(c.points, c.lines, SensorPose{});
+    CHECK_EQ(map.stats().associated, size_t{1});
+    CHECK_EQ(map.stats().fused, size_t{1});
+    CHECK_EQ(map.size(), size_t{1});
+
+    const Line l = map.lines().front();
+    CHECK_EQ(l.inlierCount, 41u + 41u + 29u);
+    CHECK_NEAR(std::abs(l.C), 1.0, 1e-9);
+    CHECK_NEAR(std::min(l.startPoint.x, l.endPoint.x), 0.0, 1e-9);
+    CHECK_NEAR(std::max(l.startPoint.x, l.endPoint.x), 5.0, 1e-9);
+}
+
+TEST(line_map_association_tests_only_nearby_segments) {
+    // 100 x 100 ayrı kısa duvar, 4 m aralıklı; yeni gözlem yalnızca komşularıyla sınanır
+    LineMap map;
+    Frame grid;
+    for (int i = 0; i < 100; ++i) {
+        for (int j = 0; j < 100; ++j) {
+            addWall(grid, Point{4.0 * i, 4.0 * j}, Point{4.0 * i + 2.0, 4.0 * j}, 5);
+        }
+    }
+    map.integrate(grid.points, grid.lines, SensorPose{});
+    CHECK_EQ(map.size(), size_t{10000});
+
+    Frame f;
+    addWall(f, Point{201.5, 120.02}, Point{202.5, 120.02}, 11);
+    map.integrate(f.points, f.lines, SensorPose{});
+    CHECK_EQ(map.size(), size_t{10000});
+    CHECK_EQ(map.stats().associated, size_t{1});
+    CHECK(map.stats().candidates <= 2);
+}
@@ -0,0 +1,20 @@
+#include "test_framework.hpp"
+#include <cstring>
+
+// Kullanım: unit_tests [isim-filtresi]
+int main(int argc, char* argv[]) {
+    const char* filter = argc > 1 ? argv[1] : nullptr;
+
+    int ran = 0;
+    for (const auto& t : testing_mini::registry()) {
+        if (filter && std::strstr(t.name, filter) == nullptr) continue;
+
+        const int before = testing_mini::failureCount();
+        t.body();
+        ++ran;
+        std::cout << (testing_mini::failureCount() == before ? "[ OK ] " : "[FAIL] ") << t.name << "\n";
+    }
+
+    std::cout << ran << " test, " << testing_mini::failureCount() << " hata\n";
+    return testing_mini::failureCount() == 0 ? 0 : 1;
+}
@@ -0,0 +1,101 @@
+#include "test_framework.hpp"
+#include "model/lidar.hpp"
+#include "model/occupancy_grid.hpp"
+#include "model/scene.hpp"
+#include "view/raster_writer.hpp"
+
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+static std::pmr::vector<Point> scanFrom(const Scene& scene, const SensorPose& pose) {
+    ScanSimConfig cfg;
+    cfg.beams = 720;
+    return filterAndConvertToPoints(simulateScan(scene, pose, cfg));
+}
+
+TEST(occupancy_marks_walls_and_free_space) {
+    // Duvarlar hücre ortalarında: x = +-3.025, y = +-2.025
+    Scene scene;
+    addRoom(scene, 0.0, 0.0, 6.05, 4.05);
+    OccupancyGrid grid;
+    const auto points = scanFrom(scene, SensorPose{});
+
+    grid.integrate(points, SensorPose{});
+    CHECK(grid.state(60, 0) == CellState::Occupied);    // +x duvarı
+    CHECK(grid.state(-61, 0) == CellState::Occupied);   // -x duvarı
+    CHECK(grid.state(0, 40) == CellState::Occupied);    // +y duvarı
+    CHECK(grid.state(20, 0) == CellState::Unknown);     // Tek geçiş eşiğin altında
+    CHECK_EQ(grid.stats().rays, points.size());
+
+    grid.integrate(points, SensorPose{});
+    CHECK(grid.state(20, 0) == CellState::Free);
+    CHECK(grid.state(-30, -20) == CellState::Free);
+    CHECK(grid.state(80, 0) == CellState::Unknown);     // Duvarın arkası
+    CHECK(grid.state(60, 0) == CellState::Occupied);
+    CHECK_NEAR(grid.logOdds(60, 0), 2 * grid.params().hitLogOdds, 1e-6);
+
+    // Raster: hücre başına piksel, dolu koyu, bilinmeyen orta gri
+    RasterRenderer raster;
+    raster.renderOccupancy(grid, RasterFormat::Pgm);
+    CHECK_EQ(raster.width(), grid.cellsPerSide());
+    CHECK_EQ(raster.height(), grid.cellsPerSide());
+    auto pixel = [&](int64_t cx, int64_t cy) {
+        const int64_t x = cx - grid.originX();
+        const int64_t row = grid.cellsPerSide() - 1 - (cy - grid.originY());
+        return raster.pixels()[static_cast<size_t>(row * raster.width() + x)];
+    };
+    CHECK(pixel(60, 0) < 64);
+    CHECK(pixel(20, 0) > 160);
+    CHECK_EQ(pixel(80, 0), 128);
+}
+
+TEST(occupancy_hit_wins_over_pass_in_same_scan) {
+    // yaw = 90 derece: sensör +x'i dünya +y'sidir. Uzak ışın yakın isabetin hücresinden geçer.
+    OccupancyGrid grid;
+    std::pmr::vector<Point> points{Point{2.0, 0.0}, Point{1.0, 0.0}, Point{1.0, 0.0}};
+    grid.integrate(points, SensorPose{0.0, 0.0, M_PI / 2});
+
+    CHECK_NEAR(grid.logOdds(0, 20), grid.params().hitLogOdds, 1e-6);   // İsabet, tek kez
+    CHECK_NEAR(grid.logOdds(0, 40), grid.params().hitLogOdds, 1e-6);
+    CHECK_NEAR(grid.logOdds(0, 10), grid.params().missLogOdds, 1e-6);  // Üç ışın, tek güncelleme
+    CHECK_NEAR(grid.logOdds(0, 30), grid.params().missLogOdds, 1e-6);
+    CHECK_NEAR(grid.logOdds(10, 0), 0.0, 1e-9);
+    CHECK_EQ(grid.stats().hitCells, size_t{2});
+    CHECK_EQ(grid.stats().missCells, size_t{40 - 1});
+}
+
+TEST(occupancy_window_scrolls_with_constant_memory) {
+    // Duvarlar y = +-1.025 (hücre ortası); robot 30 m boyunca ilerler
+    Scene scene;
+    addCorridor(scene, Point{-5.0, 0.0}, Point{45.0, 0.0}, 2.05);
+    OccupancyGridParams params;
+    params.tiles = 8;   // 128 hücre = 6.4 m pencere
+    OccupancyGrid grid(params);
+    const size_t bytes = grid.memoryBytes();
+
+    SensorPose pose;
+    for (int k = 0; k < 60; ++k) {
+        pose.x = 0.5 * k;
+        grid.integrate(scanFrom(scene, pose), pose);
+        CHECK_EQ(grid.memoryBytes(), bytes);
+    }
+    CHECK(grid.stats().scrolledTiles > 0);
+
+    // Robotun yanındaki duvar hücreleri dolu; geride kalan başlangıç penceresi unutuldu
+    const auto rx = static_cast<int64_t>(std::floor(pose.x / params.cellSize));
+    CHECK(grid.contains(rx, 0));
+    CHECK(grid.state(rx, 20) == CellState::Occupied);
+    CHECK(grid.state(rx + 20, -21) == CellState::Occupied);
+    CHECK(grid.state(rx - 20, 10) == CellState::Free);
+    CHECK(!grid.contains(0, 20));
+    CHECK(grid.state(0, 20) == CellState::Unknown);
+
+    // Pencereye yeniden giren karolar sıfırdan başlar (eski yuvaların verisi sızmaz)
+    pose.x = 0.0;
+    grid.recenter(pose.x, pose.y);
+    CHECK(grid.contains(0, 20));
+    CHECK(grid.state(0, 20) == CellState::Unknown);
+}
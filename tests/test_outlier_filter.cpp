@@ -0,0 +1,136 @@
+#include "test_framework.hpp"
+#include "model/lidar.hpp"
+#include "model/outlier_filter.hpp"
+#include "model/ransac.hpp"
+#include "model/toml_parser.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+static LidarScan flatScan(size_t beams, double range, double sweep) {
+    LidarScan scan;
+    scan.angle_min = 0.0;
+    scan.angle_increment = sweep / static_cast<double>(beams);
+    scan.angle_max = scan.angle_min + (static_cast<double>(beams) - 0.5) * scan.angle_increment;
+    scan.range_min = 0.05;
+    scan.range_max = 10.0;
+    scan.ranges.assign(beams, range);
+    return scan;
+}
+
+TEST(outlier_filter_removes_isolated_returns_only) {
+    LidarScan scan = flatScan(100, 2.0, M_PI);
+    scan.ranges[40] = 3.5;                 // Tek tük dönüş
+    scan.ranges[60] = -1.0;                // Sentinel: sayılmaz, dokunulmaz
+    scan.ranges[61] = 2.01;                // Sentinel komşusu: diğer yandan desteği var
+
+    ScanOutlierFilter<double> filter(OutlierFilterParams{2, 2, 0.05, 2.0});
+    filter.apply(scan);
+    CHECK_EQ(filter.stats().validBeams, size_t{99});
+    CHECK_EQ(filter.stats().removed, size_t{1});
+    CHECK_EQ(scan.ranges[40], -1.0);
+    CHECK_EQ(scan.ranges[61], 2.01);
+    CHECK_EQ(filterAndConvertToPoints(scan).size(), size_t{98});
+}
+
+TEST(outlier_filter_drops_random_noise_keeps_walls) {
+    // Yarısı duvar, yarısı rastgele range: gürültü bölgesinin çoğu elenir, duvar kalır
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> noise(1.0, 3.0);
+    LidarScan scan = flatScan(400, 2.0, M_PI);
+    for (size_t i = 200; i < 400; ++i) scan.ranges[i] = noise(rng);
+
+    ScanOutlierFilter<double> filter(OutlierFilterParams{});
+    filter.apply(scan);
+    size_t wallKept = 0, noiseKept = 0;
+    for (size_t i = 0; i < 400; ++i) {
+        if (scan.ranges[i] < 0) continue;
+        (i < 200 ? wallKept : noiseKept)++;
+    }
+    CHECK(wallKept >= 198);
+    CHECK(noiseKept < 20);
+
+    // Eğik duvar (x = 1, 60 dereceye kadar): uzak uçta ışın başına range artışı sabit
+    // toleransı aşar, eğim terimi karşılar
+    LidarScan grazing = flatScan(60, 1.0, M_PI / 3);
+    for (size_t i = 0; i < 60; ++i) {
+        grazing.ranges[i] = 1.0 / std::cos(static_cast<double>(i) * grazing.angle_increment);
+    }
+    LidarScan grazingFlat = grazing;
+    filter.apply(grazing);
+    CHECK_EQ(filter.stats().removed, size_t{0});
+
+    ScanOutlierFilter<double> noSlope(OutlierFilterParams{2, 2, 0.05, 0.0});
+    noSlope.apply(grazingFlat);
+    CHECK(noSlope.stats().removed > 0);
+}
+
+TEST(outlier_filter_keeps_wall_segments_of_sample_scan) {
+    // Örnekte gürültü bulutları elenir (202 noktanın 119'u gider); filtresiz RANSAC'ın yüzeye
+    // oturan parçaları (inlier'lar arası en büyük boşluk < 0.35 m; diğerleri bulutları birleştiren
+    // seyrek doğrular) varsayılan ön filtreden sonra inlier'larının en az %80'ini korur
+    auto scan = loadScanFromFile(std::string(LIDAR_DATA_DIR) + "/lidar1.toml");
+    CHECK(scan.has_value());
+    if (!scan) return;
+
+    LidarScan filtered = *scan;
+    ScanOutlierFilter<double> filter(OutlierFilterParams{});
+    filter.apply(filtered);
+    CHECK_EQ(filter.stats().validBeams, size_t{202});
+    CHECK_EQ(filter.stats().removed, size_t{119});
+    const auto kept = filterAndConvertToPoints(filtered);
+    auto isKept = [&](const Point& p) {
+        for (const Point& q : kept) {
+            if (q.x == p.x && q.y == p.y) return true;
+        }
+        return false;
+    };
+
+    size_t walls = 0;
+    for (uint32_t seed = 1; seed <= 16; ++seed) {
+        auto points = filterAndConvertToPoints(*scan);
+        const auto lines = findLinesRANSAC(points, 8, 0.02, 2000, std::pmr::get_default_resource(), seed);
+        for (const Line& l : lines) {
+            const double n = std::hypot(l.A, l.B);
+            std::vector<double> t;
+            for (const Point& p : l.inliers(points)) t.push_back((l.B * p.x - l.A * p.y) / n);
+            std::sort(t.begin(), t.end());
+            double gap = 0.0;
+            for (size_t i = 1; i < t.size(); ++i) gap = std::max(gap, t[i] - t[i - 1]);
+            if (gap >= 0.35) continue;
+
+            ++walls;
+            size_t survived = 0;
+            for (const Point& p : l.inliers(points)) survived += isKept(p) ? 1 : 0;
+            CHECK(survived * 5 >= l.inlierCount * 4);
+        }
+    }
+    CHECK(walls >= 10);
+}
+
+TEST(outlier_filter_full_sweep_wraps_window) {
+    // 1. ışın tek tük; 0. ışının bir yanındaki desteği yalnızca 2. ışın.
+    // Tam turda 358 ve 359 da komşudur (0 kalır), yarım turda 0. ışının desteği yetmez.
+    ScanOutlierFilter<double> filter(OutlierFilterParams{2, 2, 0.05, 0.0});
+    LidarScan full = flatScan(360, 2.0, 2.0 * M_PI);
+    full.ranges[1] = 5.0;
+    filter.apply(full);
+    CHECK_EQ(filter.stats().removed, size_t{1});
+    CHECK_EQ(full.ranges[0], 2.0);
+
+    LidarScan partial = flatScan(360, 2.0, M_PI);
+    partial.ranges[1] = 5.0;
+    LidarScanT<float> partialF = convertScanHeader<float>(partial);
+    partialF.ranges.assign(partial.ranges.begin(), partial.ranges.end());
+    ScanOutlierFilter<float> filterF(OutlierFilterParams{2, 2, 0.05, 0.0});
+    filterF.apply(partialF);
+    CHECK_EQ(filterF.stats().removed, size_t{2});
+    CHECK_EQ(partialF.ranges[0], -1.0f);
+    CHECK_EQ(partialF.ranges[359], 2.0f);
+}
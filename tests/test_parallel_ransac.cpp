@@ -0,0 +1,222 @@
+#include "test_framework.hpp"
+#include "fixtures.hpp"
+#include "model/geometry.hpp"
+#include "model/lidar.hpp"
+#include "model/parallel_ransac.hpp"
+#include "model/ransac.hpp"
+#include "model/toml_parser.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+// Orijin merkezli 6 m x 4 m oda, tam tur 720 ışın, hafif gürültü
+static std::pmr::vector<Point> roomPoints() {
+    fixtures::RoomScanConfig room;
+    room.sim.seed = 3;
+    return fixtures::roomPoints(room);
+}
+
+// Birim normal ve C işareti sabitlenmiş iki doğrunun aynı duvar olup olmadığı
+static bool sameWall(const Line& a, const Line& b) {
+    const double na = std::hypot(a.A, a.B), nb = std::hypot(b.A, b.B);
+    const double dot = (a.A * b.A + a.B * b.B) / (na * nb);
+    const double sign = dot < 0 ? -1.0 : 1.0;
+    return std::abs(dot) > std::cos(2.0 * M_PI / 180.0) && std::abs(a.C / na - sign * b.C / nb) < 0.02;
+}
+
+TEST(parallel_finds_same_walls_as_sequential) {
+    auto seqPoints = roomPoints();
+    auto parPoints = seqPoints;
+    const auto seq = findLinesRANSAC(seqPoints, 20, 0.02, 500, std::pmr::get_default_resource(), 1);
+
+    ParallelRansacStats st;
+    const auto par = findLinesParallel(parPoints, 20, 0.02, 500, ParallelRansacParams{},
+                                       std::pmr::get_default_resource(), 1, &st);
+
+    CHECK_EQ(seq.size(), size_t{4});
+    CHECK_EQ(par.size(), seq.size());
+    for (const Line& s : seq) {
+        CHECK(std::any_of(par.begin(), par.end(), [&](const Line& p) { return sameWall(s, p); }));
+    }
+    // Her duvar birden çok sektörü keser; hepsi tek parçaya birleşir
+    CHECK_EQ(st.sectors, size_t{8});
+    CHECK(st.rawSegments > par.size());
+    CHECK_EQ(st.rawSegments - st.merged - st.dropped, par.size());
+}
+
+TEST(parallel_assigns_each_point_once) {
+    const auto input = roomPoints();
+    auto points = input;
+    ParallelRansacParams params;
+    params.sectors = 16;
+    params.threads = 4;
+    const auto lines = findLinesParallel(points, 20, 0.02, 500, params, std::pmr::get_default_resource(), 5);
+
+    // Tampon girişin bir permütasyonu; inlier aralıkları ardışık ve çakışmasız
+    CHECK_EQ(points.size(), input.size());
+    auto less = [](const Point& a, const Point& b) { return a.x < b.x || (a.x == b.x && a.y < b.y); };
+    auto sortedIn = input, sortedOut = points;
+    std::sort(sortedIn.begin(), sortedIn.end(), less);
+    std::sort(sortedOut.begin(), sortedOut.end(), less);
+    CHECK(std::equal(sortedIn.begin(), sortedIn.end(), sortedOut.begin(),
+                     [](const Point& a, const Point& b) { return a.x == b.x && a.y == b.y; }));
+
+    uint32_t next = 0;
+    for (const Line& l : lines) {
+        CHECK_EQ(l.inlierOffset, next);
+        CHECK(l.inlierCount >= 20u);
+        next += l.inlierCount;
+    }
+    CHECK(next <= points.size());
+
+    // İş parçacığı sayısı sonucu değiştirmez (sektör tohumları sabit)
+    auto serialPoints = input;
+    params.threads = 1;
+    const auto serial = findLinesParallel(serialPoints, 20, 0.02, 500, params, std::pmr::get_default_resource(), 5);
+    CHECK_EQ(serial.size(), lines.size());
+    for (size_t i = 0; i < std::min(serial.size(), lines.size()); ++i) {
+        CHECK_NEAR(serial[i].C, lines[i].C, 1e-12);
+        CHECK_EQ(serial[i].inlierCount, lines[i].inlierCount);
+    }
+}
+
+TEST(parallel_merges_wall_across_wraparound) {
+    // x = 2 duvarı 0 radyan sınırını keser: ilk ve son sektörde parçalanır
+    std::pmr::vector<Point> points;
+    for (int i = -100; i <= 100; ++i) {
+        points.push_back(Point{2.0, i * 0.01});
+    }
+    ParallelRansacParams params;
+    params.sectors = 12;
+    ParallelRansacStats st;
+    const auto lines = findLinesParallel(points, 20, 0.01, 200, params, std::pmr::get_default_resource(), 1, &st);
+
+    CHECK_EQ(st.rawSegments, size_t{2});
+    CHECK_EQ(st.merged, size_t{1});
+    CHECK_EQ(lines.size(), size_t{1});
+    if (!lines.empty()) {
+        CHECK_EQ(lines[0].inlierCount, 201u);
+        CHECK_NEAR(std::abs(lines[0].A / std::hypot(lines[0].A, lines[0].B)), 1.0, 1e-9);
+        CHECK_NEAR(std::min(lines[0].startPoint.y, lines[0].endPoint.y), -0.95, 0.06);
+        CHECK_NEAR(std::max(lines[0].startPoint.y, lines[0].endPoint.y), 0.95, 0.06);
+    }
+}
+
+TEST(parallel_matches_sequential_on_sample_scan) {
+    // 202 noktalık örnek 8 sektöre bölünür (sektör başına ~25 nokta). Örnek büyük ölçüde
+    // dağınık gürültü ve birkaç yay olduğundan tek tek doğrular ve kesişimler tohuma bağlıdır;
+    // kalite tohumlar üzerinden karşılaştırılır: doğru sayısı, açıklanan nokta ve uyum artığı
+    auto scan = loadScanFromFile(std::string(LIDAR_DATA_DIR) + "/lidar1.toml");
+    CHECK(scan.has_value());
+    if (!scan) return;
+
+    const double eps = 0.02;
+    size_t seqLines = 0, parLines = 0, seqInliers = 0, parInliers = 0;
+    for (uint32_t seed = 1; seed <= 8; ++seed) {
+        auto seqPoints = filterAndConvertToPoints(*scan);
+        auto parPoints = seqPoints;
+        const auto seq = findLinesRANSAC(seqPoints, 8, eps, 2000, std::pmr::get_default_resource(), seed);
+        ParallelRansacStats st;
+        const auto par = findLinesParallel(parPoints, 8, eps, 2000, ParallelRansacParams{},
+                                           std::pmr::get_default_resource(), seed, &st);
+        CHECK_EQ(st.sectors, size_t{8});
+        CHECK_EQ(st.rawSegments + st.recovered - st.merged - st.dropped, par.size());
+
+        // Her doğru inlier'larına eşik içinde oturur
+        for (const Line& l : par) {
+            double sq = 0.0;
+            for (const Point& p : l.inliers(parPoints)) {
+                const double d = (l.A * p.x + l.B * p.y + l.C) / std::hypot(l.A, l.B);
+                sq += d * d;
+            }
+            CHECK(std::sqrt(sq / l.inlierCount) < eps);
+        }
+        seqLines += seq.size();
+        parLines += par.size();
+        for (const Line& l : seq) seqInliers += l.inlierCount;
+        for (const Line& l : par) parInliers += l.inlierCount;
+    }
+    CHECK(parLines * 4 <= seqLines * 5 && parLines * 5 >= seqLines * 4);
+    CHECK(parInliers * 10 >= seqInliers * 9);
+}
+
+// Dik doğru çiftlerinin (sonsuz doğru) kesişimleri: kısaltılmış uçlar köşede kesişmez
+static std::vector<Point> corners(const std::pmr::vector<Line>& lines) {
+    std::vector<Point> out;
+    for (size_t i = 0; i < lines.size(); ++i) {
+        for (size_t j = i + 1; j < lines.size(); ++j) {
+            const Line& a = lines[i];
+            const Line& b = lines[j];
+            const double det = a.A * b.B - b.A * a.B;
+            if (std::abs(det) < 0.9 * std::hypot(a.A, a.B) * std::hypot(b.A, b.B)) continue;
+            out.push_back(Point{(a.B * b.C - b.B * a.C) / det, (b.A * a.C - a.A * b.C) / det});
+        }
+    }
+    return out;
+}
+
+TEST(parallel_matches_sequential_on_sample_sized_room) {
+    // Örnekle aynı ışın sayısında gerçek duvarlı sahne (~42 nokta / sektör): her duvar birkaç
+    // sektöre bölünür, birleştirme sonrası duvarlar ve köşeler seri RANSAC'ınkiyle aynıdır
+    fixtures::RoomScanConfig room(338);
+    room.sim.seed = 1;
+    const auto input = fixtures::roomPoints(room);
+
+    auto near = [](const std::vector<Point>& from, const std::vector<Point>& to) {
+        return std::all_of(from.begin(), from.end(), [&](const Point& p) {
+            return std::any_of(to.begin(), to.end(),
+                               [&](const Point& q) { return std::hypot(p.x - q.x, p.y - q.y) < 0.02; });
+        });
+    };
+    for (uint32_t seed = 1; seed <= 4; ++seed) {
+        auto seqPoints = input;
+        auto parPoints = input;
+        auto seq = findLinesRANSAC(seqPoints, 8, 0.02, 2000, std::pmr::get_default_resource(), seed);
+        ParallelRansacStats st;
+        const auto par = findLinesParallel(parPoints, 8, 0.02, 2000, ParallelRansacParams{},
+                                           std::pmr::get_default_resource(), seed, &st);
+        CHECK_EQ(st.sectors, size_t{8});
+        CHECK(st.merged > 0);
+        CHECK_EQ(par.size(), size_t{4});
+        // Seri RANSAC köşede birkaç inlier'lı yapay doğru da bulabilir; karşılaştırma duvar
+        // ölçeğindeki (en az 20 inlier) doğrularla yapılır
+        seq.erase(std::remove_if(seq.begin(), seq.end(), [](const Line& l) { return l.inlierCount < 20; }),
+                  seq.end());
+        for (const Line& s : seq) {
+            CHECK(std::any_of(par.begin(), par.end(), [&](const Line& p) { return sameWall(s, p); }));
+        }
+
+        const auto seqCorners = corners(seq);
+        const auto parCorners = corners(par);
+        CHECK_EQ(parCorners.size(), size_t{4});
+        CHECK(near(seqCorners, parCorners));
+        CHECK(near(parCorners, seqCorners));
+    }
+}
+
+TEST(parallel_merges_leftover_pass_with_sector_lines) {
+    // x = 2 duvarı: y < 0 kısmı son sektörde sık (100 nokta), y > 0 kısmı 10 cm aralıkla
+    // seyrek ve iki sektöre dağılır (12 + 9 nokta < minInliers). Seyrek kısım ancak son
+    // geçişte bulunur ve sektör doğrusuyla tek parçaya birleşir
+    std::pmr::vector<Point> points;
+    for (int i = -100; i < 0; ++i) {
+        points.push_back(Point{2.0, i * 0.01});
+    }
+    for (int i = 0; i <= 20; ++i) {
+        points.push_back(Point{2.0, i * 0.1});
+    }
+    ParallelRansacParams params;
+    params.sectors = 12;
+    params.overlapDeg = 0.0;
+    ParallelRansacStats st;
+    const auto lines = findLinesParallel(points, 20, 0.01, 200, params, std::pmr::get_default_resource(), 1, &st);
+
+    CHECK_EQ(st.recovered, size_t{1});
+    CHECK_EQ(st.merged, size_t{1});
+    CHECK_EQ(lines.size(), size_t{1});
+    if (!lines.empty()) {
+        CHECK_EQ(lines[0].inlierCount, static_cast<uint32_t>(points.size()));
+        CHECK_NEAR(std::min(lines[0].startPoint.y, lines[0].endPoint.y), -0.95, 0.06);
+        CHECK_NEAR(std::max(lines[0].startPoint.y, lines[0].endPoint.y), 1.95, 0.06);
+    }
+}
@@ -0,0 +1,199 @@
+// Verim regresyon testleri: her hızlı yol aynı çalışmada ölçülen sade referans
+// gerçeklemeyle (tests/reference) karşılaştırılır; taban çizgisi mutlak verim değil
+// hızlanma oranıdır, makinenin hızından bağımsızdır.
+// Yalnızca LIDAR_PERF_BASELINE verildiğinde çalışır (ctest: perf_regression, Release ve
+// -DLIDAR_PERF_TESTS=ON); aksi halde atlanır.
+//   LIDAR_PERF_MARGIN=0.5  -> kayıtlı oranın %50 altına inen ölçüm hata sayılır
+//   LIDAR_PERF_RECORD=1    -> ölçülen oranlar taban çizgisi dosyasına yazılır (yalnızca açıkça)
+#include "test_framework.hpp"
+#include "fixtures.hpp"
+#include "reference.hpp"
+#include "model/geometry.hpp"
+#include "model/lidar.hpp"
+#include "model/ransac.hpp"
+#include "model/scan_stream.hpp"
+#include "model/toml_writer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace {
+
+const char* envOr(const char* name, const char* fallback) {
+    const char* v = std::getenv(name);
+    return (v && *v) ? v : fallback;
+}
+
+// "isim  değer" satırları; '#' ile başlayanlar yorum
+std::map<std::string, double> readBaseline(const std::string& path) {
+    std::map<std::string, double> values;
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::istringstream row(line);
+        std::string name;
+        double v = 0.0;
+        if (row >> name >> v) values[name] = v;
+    }
+    return values;
+}
+
+void writeBaseline(const std::string& path, const std::map<std::string, double>& values) {
+    std::ofstream out(path);
+    out << "# Hizlanma taban cizgisi (hizli yol / referans verimi, en iyi tekrarlar). Guncellemek icin:\n"
+        << "#   LIDAR_PERF_RECORD=1 ctest --test-dir <build> -R perf_regression\n";
+    for (const auto& [name, v] : values) {
+        out << name << " " << v << "\n";
+    }
+}
+
+// body bir tekrar çalıştırır; en hızlı tekrarın verimi (oge/s) döner
+template <typename F>
+double bestThroughput(size_t items, int reps, F&& body) {
+    double best = 1e300;
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = std::chrono::steady_clock::now();
+        body();
+        best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count());
+    }
+    return static_cast<double>(items) / std::max(best, 1e-9);
+}
+
+// fast / ref: aynı çalışmada ölçülen verimler (oge/s). Kayıt modunda yalnızca oran yazılır;
+// kayıtlı oran yoksa test başarısız olur (taban çizgisi kendiliğinden yazılmaz).
+void checkSpeedup(const char* name, double fast, double ref) {
+    const std::string path = envOr("LIDAR_PERF_BASELINE", "");
+    const double margin = std::atof(envOr("LIDAR_PERF_MARGIN", "0.5"));
+    const double speedup = fast / std::max(ref, 1e-9);
+
+    auto values = readBaseline(path);
+    auto it = values.find(name);
+    std::cout << "  " << name << ": " << static_cast<long long>(fast) << " oge/s, referans "
+              << static_cast<long long>(ref) << " oge/s, x" << speedup;
+
+    if (std::string(envOr("LIDAR_PERF_RECORD", "0")) == "1") {
+        std::cout << " (kaydedildi)\n";
+        values[name] = speedup;
+        writeBaseline(path, values);
+        return;
+    }
+    if (it == values.end()) {
+        std::cout << " (taban cizgisinde yok; LIDAR_PERF_RECORD=1 ile kaydedin)\n";
+        CHECK(it != values.end());
+        return;
+    }
+
+    const double floor = it->second * (1.0 - margin);
+    std::cout << " (taban x" << it->second << ", alt sinir x" << floor << ")\n";
+    CHECK(speedup >= floor);
+}
+
+bool perfEnabled() {
+    return std::getenv("LIDAR_PERF_BASELINE") != nullptr;
+}
+
+LidarScan roomScan(size_t beams, double noise) {
+    fixtures::RoomScanConfig room(beams, noise);
+    room.clutter = 6;
+    room.clutterSeed = 11;
+    room.pose = SensorPose{0.2, -0.1, 0.4};
+    room.sim.dropoutRate = 0.02;
+    return fixtures::roomScan(room);
+}
+
+} // namespace
+
+TEST(perf_toml_stream_parse) {
+    if (!perfEnabled()) return;
+
+    const std::string text = formatScanAsToml(roomScan(200000, 0.01));
+    size_t count = 0;
+    double tput = bestThroughput(200000, 5, [&] {
+        TomlScanStreamParser parser([&count](const LidarScan&, size_t, double) { ++count; });
+        for (size_t pos = 0; pos < text.size(); pos += 64 * 1024) {
+            parser.feed(text.data() + pos, std::min<size_t>(64 * 1024, text.size() - pos));
+        }
+        parser.finish();
+    });
+    CHECK_EQ(count, size_t{5 * 200000});
+    size_t refCount = 0;
+    double ref = bestThroughput(200000, 3, [&] {
+        refCount = reference::parseScanToml(text)->ranges.size();
+    });
+    CHECK_EQ(refCount, size_t{200000});
+    checkSpeedup("toml_stream_parse", tput, ref);
+}
+
+TEST(perf_convert) {
+    if (!perfEnabled()) return;
+
+    const LidarScan scan = roomScan(200000, 0.01);
+    size_t kept = 0;
+    double tput = bestThroughput(scan.ranges.size(), 5, [&] {
+        kept = filterAndConvertToPoints(scan).size();
+    });
+    CHECK(kept > 0);
+    size_t refKept = 0;
+    double ref = bestThroughput(scan.ranges.size(), 5, [&] {
+        refKept = reference::convertScan(scan).size();
+    });
+    CHECK_EQ(refKept, kept);
+    checkSpeedup("convert", tput, ref);
+}
+
+TEST(perf_ransac) {
+    if (!perfEnabled()) return;
+
+    auto converted = filterAndConvertToPoints(roomScan(4000, 0.005));
+    const std::pmr::vector<Point> input(converted.begin(), converted.end());
+    std::pmr::vector<Point> pts;
+    size_t lines = 0;
+    double tput = bestThroughput(input.size(), 15, [&] {
+        pts = input; // Yerinde sıralama: her tekrar aynı girdiyle başlar
+        lines = findLinesRANSAC(pts, 12, 0.02, 2000, std::pmr::get_default_resource(), 1).size();
+    });
+    CHECK(lines > 0);
+    const std::vector<Point> refInput(input.begin(), input.end());
+    size_t refLines = 0;
+    double ref = bestThroughput(input.size(), 5, [&] {
+        refLines = reference::findLines(refInput, 12, 0.02, 2000, 1).size();
+    });
+    CHECK(refLines > 0);
+    checkSpeedup("ransac", tput, ref);
+}
+
+TEST(perf_intersections) {
+    if (!perfEnabled()) return;
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> u(-3.0, 3.0);
+    std::pmr::vector<Line> segs;
+    for (int i = 0; i < 400; ++i) {
+        Line l;
+        l.startPoint = {u(rng), u(rng)};
+        l.endPoint = {u(rng), u(rng)};
+        l.A = l.endPoint.y - l.startPoint.y;
+        l.B = l.startPoint.x - l.endPoint.x;
+        l.C = -l.A * l.startPoint.x - l.B * l.startPoint.y;
+        segs.push_back(l);
+    }
+
+    const size_t pairs = segs.size() * (segs.size() - 1) / 2;
+    size_t found = 0;
+    double tput = bestThroughput(pairs, 5, [&] {
+        found = findPhysicalIntersections(segs, 30.0).size();
+    });
+    CHECK(found > 0);
+    const std::vector<Line> refSegs(segs.begin(), segs.end());
+    double ref = bestThroughput(pairs, 5, [&] {
+        found = reference::findIntersections(refSegs, 30.0).size();
+    });
+    checkSpeedup("intersections", tput, ref);
+}
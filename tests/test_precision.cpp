@@ -0,0 +1,58 @@
+#include "test_framework.hpp"
+#include "model/geometry.hpp"
+#include "model/lidar.hpp"
+#include "model/ransac.hpp"
+#include "model/toml_parser.hpp"
+#include "utils/cli.hpp"
+
+// float ve double akışları aynı tohumla aynı doğruları / kesişimleri bulmalı
+template <typename T>
+struct PipelineResult {
+    size_t pointCount = 0;
+    std::pmr::vector<LineT<T>> lines;
+    std::pmr::vector<IntersectionT<T>> intersections;
+};
+
+template <typename T>
+static PipelineResult<T> runSample(const LidarScan& scan, uint32_t seed) {
+    const CliParams d;
+    LidarScanT<T> s = convertScanHeader<T>(scan);
+    for (double r : scan.ranges) s.ranges.push_back(static_cast<T>(r));
+
+    PipelineResult<T> res;
+    auto pts = filterAndConvertToPoints(s);
+    res.pointCount = pts.size();
+    res.lines = findLinesRANSAC(pts, d.minInliers, d.epsilon, d.maxIters, std::pmr::get_default_resource(), seed);
+    res.intersections = findPhysicalIntersections(res.lines, d.angleThreshDeg);
+    return res;
+}
+
+TEST(precision_float_and_double_agree_on_sample) {
+    auto scan = loadScanFromFile(std::string(LIDAR_DATA_DIR) + "/lidar1.toml");
+    CHECK(scan.has_value());
+    if (!scan) return;
+
+    constexpr double tol = 1e-3; // Santimetre altı: sensör hassasiyetinin çok altında
+    for (uint32_t seed = 1; seed <= 8; ++seed) {
+        auto d = runSample<double>(*scan, seed);
+        auto f = runSample<float>(*scan, seed);
+
+        CHECK_EQ(f.pointCount, d.pointCount);
+        CHECK_EQ(f.lines.size(), d.lines.size());
+        CHECK_EQ(f.intersections.size(), d.intersections.size());
+        if (f.lines.size() != d.lines.size() || f.intersections.size() != d.intersections.size()) continue;
+
+        for (size_t i = 0; i < d.lines.size(); ++i) {
+            CHECK_NEAR(f.lines[i].startPoint.x, d.lines[i].startPoint.x, tol);
+            CHECK_NEAR(f.lines[i].startPoint.y, d.lines[i].startPoint.y, tol);
+            CHECK_NEAR(f.lines[i].endPoint.x, d.lines[i].endPoint.x, tol);
+            CHECK_NEAR(f.lines[i].endPoint.y, d.lines[i].endPoint.y, tol);
+            CHECK_EQ(f.lines[i].inlierCount, d.lines[i].inlierCount);
+        }
+        for (size_t i = 0; i < d.intersections.size(); ++i) {
+            CHECK_NEAR(f.intersections[i].position.x, d.intersections[i].position.x, tol);
+            CHECK_NEAR(f.intersections[i].position.y, d.intersections[i].position.y, tol);
+            CHECK_NEAR(f.intersections[i].angleDeg, d.intersections[i].angleDeg, 0.01);
+        }
+    }
+}
@@ -0,0 +1,129 @@
+#include "test_framework.hpp"
+#include "fixtures.hpp"
+#include "model/lidar.hpp"
+#include "model/quantized_scan.hpp"
+#include "model/ransac.hpp"
+#include "model/scan_binary.hpp"
+#include "model/scan_stream.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+static LidarScan noisyRoomScan() {
+    fixtures::RoomScanConfig room(2000, 0.005);
+    room.clutter = 4;
+    room.clutterSeed = 3;
+    room.pose = SensorPose{0.2, 0.1, 0.3};
+    room.sim.rangeMax = 3.0; // Köşeler menzil dışı
+    room.sim.dropoutRate = 0.05;
+    room.sim.errorRate = 0.02;
+    return fixtures::roomScan(room);
+}
+
+TEST(quantized_conversion_keeps_beams_within_half_step) {
+    const LidarScan scan = noisyRoomScan();
+    const QuantizedScan q = quantizeScan(scan);
+
+    CHECK_EQ(q.codes.size(), scan.ranges.size());
+    CHECK(q.scale < 1e-3); // Sensör hassasiyetinden (1 mm) ince
+    CHECK_EQ(scan.ranges.size() * sizeof(double), 4 * q.codes.size() * sizeof(uint16_t));
+
+    auto ref = filterAndConvertToPoints(scan);
+    auto pts = filterAndConvertToPoints<double>(q);
+    CHECK_EQ(pts.size(), ref.size());
+    if (pts.size() != ref.size()) return;
+
+    double worst = 0.0;
+    for (size_t i = 0; i < ref.size(); ++i) {
+        worst = std::max(worst, std::hypot(pts[i].x - ref[i].x, pts[i].y - ref[i].y));
+    }
+    CHECK(worst <= q.scale * 0.5 + 1e-12);
+
+    // Float yolu: açı sınırı float'ta değerlendirilir, float tarama ile karşılaştırılır
+    LidarScanT<float> scanF = convertScanHeader<float>(scan);
+    scanF.ranges.assign(scan.ranges.begin(), scan.ranges.end());
+    CHECK_EQ(filterAndConvertToPoints<float>(q).size(), filterAndConvertToPoints(scanF).size());
+}
+
+TEST(quantized_boundary_ranges_keep_filter_decision) {
+    LidarScan scan;
+    scan.angle_min = 0.0;
+    scan.angle_max = 1.0;
+    scan.angle_increment = 0.1;
+    scan.range_min = 0.2;
+    scan.range_max = 3.0;
+    scan.ranges = {0.2, 3.0, 0.19999999, 3.00000001, -1.0, 999.0, -999.0, 1.2345678, 0.0, 1e9, 2.0, 2.5};
+    // Son ışın açı sınırının (1.0) dışında
+
+    const QuantizedScan q = quantizeScan(scan);
+    CHECK_EQ(q.codes[2], RangeCode::OutOfRange);
+    CHECK_EQ(q.codes[3], RangeCode::OutOfRange);
+    CHECK_EQ(q.codes[4], RangeCode::Dropout);
+    CHECK_EQ(q.codes[5], RangeCode::NoReturn);
+    CHECK_EQ(q.codes[6], RangeCode::Error);
+
+    // Çözülen sınır değerleri menzil içinde kalır; double yol ile aynı ışınlar tutulur
+    const LidarScan back = dequantizeScan(q);
+    CHECK(back.ranges[0] >= scan.range_min);
+    CHECK(back.ranges[1] <= scan.range_max);
+    CHECK_EQ(filterAndConvertToPoints(back).size(), filterAndConvertToPoints(scan).size());
+    CHECK_EQ(filterAndConvertToPoints<double>(q).size(), filterAndConvertToPoints(scan).size());
+    CHECK_EQ(back.ranges[4], -1.0);
+    CHECK_EQ(back.ranges[5], 999.0);
+    CHECK_EQ(back.ranges[6], -999.0);
+}
+
+TEST(quantized_binary_round_trip_and_stream_decode) {
+    const LidarScan scan = noisyRoomScan();
+    const QuantizedScan q = quantizeScan(scan);
+
+    namespace fs = std::filesystem;
+    const auto path = (fs::temp_directory_path() / "lidar_quantized_test.bin").string();
+    CHECK(saveScanBinary(path, q));
+    CHECK_EQ(static_cast<size_t>(fs::file_size(path)), size_t{64} + 2 * q.codes.size());
+
+    auto loaded = loadQuantizedScanBinary(path);
+    CHECK(loaded.has_value());
+    if (loaded) {
+        CHECK(loaded->codes == q.codes);
+        CHECK_EQ(loaded->scale, q.scale);
+    }
+
+    const LidarScan expected = dequantizeScan(q);
+    auto asDouble = loadScanBinary(path);
+    CHECK(asDouble.has_value() && asDouble->ranges == expected.ranges);
+
+    // Akış: 3 baytlık parçalar kodları ve başlığı böler
+    std::ifstream in(path, std::ios::binary);
+    const std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::vector<double> streamed;
+    ScanStreamDecoder decoder([&streamed](const LidarScan&, size_t, double r) { streamed.push_back(r); });
+    for (size_t pos = 0; pos < bytes.size(); pos += 3) {
+        decoder.feed(bytes.data() + pos, std::min<size_t>(3, bytes.size() - pos));
+    }
+    decoder.finish();
+    CHECK(decoder.ok());
+    CHECK(std::vector<double>(expected.ranges.begin(), expected.ranges.end()) == streamed);
+    CHECK_EQ(decoder.header().range_max, scan.range_max);
+
+    std::remove(path.c_str());
+}
+
+TEST(quantized_scan_detects_same_lines) {
+    const LidarScan scan = noisyRoomScan();
+    auto ref = filterAndConvertToPoints(scan);
+    auto pts = filterAndConvertToPoints<double>(quantizeScan(scan));
+
+    auto linesRef = findLinesRANSAC(ref, 12, 0.02, 2000, std::pmr::get_default_resource(), 5);
+    auto linesQ = findLinesRANSAC(pts, 12, 0.02, 2000, std::pmr::get_default_resource(), 5);
+
+    CHECK_EQ(linesQ.size(), linesRef.size());
+    if (linesQ.size() != linesRef.size()) return;
+    for (size_t i = 0; i < linesRef.size(); ++i) {
+        CHECK_NEAR(linesQ[i].A, linesRef[i].A, 1e-3);
+        CHECK_NEAR(linesQ[i].B, linesRef[i].B, 1e-3);
+        CHECK_NEAR(linesQ[i].C, linesRef[i].C, 1e-3);
+    }
+}
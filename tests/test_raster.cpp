@@ -0,0 +1,74 @@
+#include "test_framework.hpp"
+#include "view/raster_writer.hpp"
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+static bool isColor(const RasterRenderer& r, int x, int y, uint8_t cr, uint8_t cg, uint8_t cb) {
+    const size_t i = (static_cast<size_t>(y) * r.width() + x) * 3;
+    return r.pixels()[i] == cr && r.pixels()[i + 1] == cg && r.pixels()[i + 2] == cb;
+}
+
+TEST(raster_uses_svg_screen_mapping) {
+    SvgParams sp;
+    const ScreenMapping map(sp);
+
+    std::pmr::vector<Point> pts = {{1.0, 1.0}, {50.0, 50.0}};
+    std::pmr::vector<Line> segs(1);
+    segs[0].startPoint = {-2.0, -1.0};
+    segs[0].endPoint = {2.0, -1.0};
+    const std::pmr::vector<Intersection> xs;
+
+    RasterRenderer r;
+    r.render(pts, segs, xs, sp, RasterFormat::Ppm);
+    CHECK_EQ(r.width(), sp.width);
+    CHECK_EQ(r.height(), sp.height);
+    CHECK_EQ(r.pixels().size(), static_cast<size_t>(sp.width) * sp.height * 3);
+
+    // Nokta, SVG'deki daire merkezinin pikselinde (tuval dışı nokta yok sayılır)
+    CHECK(isColor(r, static_cast<int>(map.x(1.0)), static_cast<int>(map.y(1.0)), 0xad, 0xb5, 0xbd));
+
+    // Yatay doğru boyunca ve 1 piksel kalınlık payıyla
+    const int ly = static_cast<int>(std::lround(map.y(-1.0)));
+    for (double wx = -1.9; wx < 1.9; wx += 0.1) {
+        const int lx = static_cast<int>(std::lround(map.x(wx)));
+        CHECK(isColor(r, lx, ly, 0x51, 0xcf, 0x66));
+        CHECK(isColor(r, lx, ly + 1, 0x51, 0xcf, 0x66));
+    }
+    CHECK(isColor(r, static_cast<int>(map.x(2.5)), ly, 0xf8, 0xf9, 0xfa));
+}
+
+TEST(raster_reuses_buffer_and_writes_pgm) {
+    SvgParams sp;
+    sp.width = 320;
+    sp.height = 240;
+
+    std::pmr::vector<Point> pts = {{0.5, 0.5}};
+    const std::pmr::vector<Line> segs;
+    std::pmr::vector<Intersection> xs(1);
+    xs[0].position = {1.0, 1.0};
+
+    RasterRenderer r;
+    r.render(pts, segs, xs, sp, RasterFormat::Pgm);
+    const uint8_t* first = r.pixels().data();
+    r.render(pts, segs, xs, sp, RasterFormat::Pgm);
+    CHECK(r.pixels().data() == first); // Aynı boyutta yeniden ayırma yok
+    CHECK_EQ(r.channels(), 1);
+
+    namespace fs = std::filesystem;
+    const std::string path = (fs::temp_directory_path() / "lidar_test_raster.pgm").string();
+    CHECK(r.save(path));
+
+    std::ifstream f(path, std::ios::binary);
+    std::stringstream ss;
+    ss << f.rdbuf();
+    const std::string data = ss.str();
+    const std::string header = "P5\n320 240\n255\n";
+    CHECK(data.compare(0, header.size(), header) == 0);
+    CHECK_EQ(data.size(), header.size() + size_t{320} * 240);
+
+    std::error_code ec;
+    fs::remove(path, ec);
+}
@@ -0,0 +1,64 @@
+#include "test_framework.hpp"
+#include "view/result_writer.hpp"
+
+#include <cmath>
+#include <limits>
+
+static std::pmr::vector<Line> sampleSegments() {
+    std::pmr::vector<Line> segs(2);
+    segs[0].A = 0.0; segs[0].B = 1.0; segs[0].C = -1.0;
+    segs[0].startPoint = {-1.0, 1.0};
+    segs[0].endPoint = {1.0, 1.0};
+    segs[0].inlierCount = 12;
+    segs[1].A = 1.0; segs[1].B = 0.0; segs[1].C = -0.5;
+    segs[1].startPoint = {0.5, -1.0};
+    segs[1].endPoint = {0.5, 2.0};
+    segs[1].inlierCount = 30;
+    return segs;
+}
+
+TEST(results_binary_round_trip_with_appended_records) {
+    const auto segs = sampleSegments();
+    std::pmr::vector<Intersection> xs(1);
+    xs[0].position = {0.5, 1.0};
+    xs[0].angleDeg = 90.0;
+    xs[0].distanceToRobot = std::hypot(0.5, 1.0);
+    const StageTimings t{1.5, 2.25, 0.125};
+
+    std::string data = resultFileHeader();
+    appendResultRecord(data, 100, segs, xs, t);
+    appendResultRecord(data, 7, std::pmr::vector<Line>{}, std::pmr::vector<Intersection>{}, StageTimings{});
+
+    auto frames = parseResultsBinary(data);
+    CHECK(frames.has_value());
+    if (!frames) return;
+    CHECK_EQ(frames->size(), size_t{2});
+
+    const ResultFrame& f = (*frames)[0];
+    CHECK_EQ(f.pointCount, uint32_t{100});
+    CHECK_NEAR(f.timings.ransacMs, 2.25, 0.0);
+    CHECK_EQ(f.segments.size(), size_t{2});
+    CHECK_EQ(f.segments[1].inliers, uint64_t{30});
+    CHECK_NEAR(f.segments[1].C, -0.5, 0.0);
+    CHECK_NEAR(f.segments[0].end.x, 1.0, 0.0);
+    CHECK_EQ(f.intersections.size(), size_t{1});
+    CHECK_NEAR(f.intersections[0].distanceToRobot, std::hypot(0.5, 1.0), 0.0);
+    CHECK_EQ((*frames)[1].pointCount, uint32_t{7});
+
+    // Kesik kayıt reddedilir
+    CHECK(!parseResultsBinary(data.substr(0, data.size() - 3)).has_value());
+}
+
+TEST(results_json_has_segments_intersections_and_timings) {
+    const auto segs = sampleSegments();
+    std::pmr::vector<Intersection> xs(1);
+    xs[0].position = {0.5, 1.0};
+    xs[0].angleDeg = std::numeric_limits<double>::quiet_NaN();
+
+    const std::string json = formatResultsAsJson(100, segs, xs, StageTimings{1.5, 2.25, 0.125});
+    CHECK(json.find("\"schema\":\"lidar-result/1\"") != std::string::npos);
+    CHECK(json.find("\"ransac\":2.25") != std::string::npos);
+    CHECK(json.find("\"inliers\":30") != std::string::npos);
+    CHECK(json.find("\"start\":[0.5,-1]") != std::string::npos);
+    CHECK(json.find("\"angle_deg\":null") != std::string::npos); // JSON'da NaN yok
+}
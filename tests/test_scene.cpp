@@ -0,0 +1,87 @@
+#include "test_framework.hpp"
+#include "model/lidar.hpp"
+#include "model/scan_binary.hpp"
+#include "model/scene.hpp"
+#include <cstdio>
+#include <filesystem>
+
+TEST(scene_square_room_ranges_match_geometry) {
+    Scene scene;
+    addRoom(scene, 0.0, 0.0, 4.0, 4.0);
+
+    ScanSimConfig cfg;
+    cfg.beams = 8; // 45 derecelik adımlar
+    std::vector<size_t> hits;
+    LidarScan scan = simulateScan(scene, SensorPose{}, cfg, &hits);
+
+    CHECK_EQ(scan.ranges.size(), size_t{8});
+    CHECK_NEAR(scan.ranges[0], 2.0, 1e-9);                // +x duvarı
+    CHECK_NEAR(scan.ranges[1], 2.0 * std::sqrt(2.0), 1e-9); // köşe
+    CHECK_NEAR(scan.ranges[2], 2.0, 1e-9);                // +y duvarı
+
+    size_t total = 0;
+    for (size_t h : hits) total += h;
+    CHECK_EQ(total, size_t{8});
+}
+
+TEST(scene_pose_moves_sensor_frame) {
+    Scene scene;
+    addRoom(scene, 0.0, 0.0, 4.0, 4.0);
+
+    ScanSimConfig cfg;
+    cfg.beams = 4;
+    SensorPose pose{1.0, 0.0, 0.0};
+    LidarScan scan = simulateScan(scene, pose, cfg);
+    CHECK_NEAR(scan.ranges[0], 1.0, 1e-9); // +x duvarına 1 m
+    CHECK_NEAR(scan.ranges[2], 3.0, 1e-9); // -x duvarına 3 m
+}
+
+TEST(scene_sentinels_and_ground_truth_corners) {
+    Scene scene;
+    addRoom(scene, 0.0, 0.0, 4.0, 4.0);
+
+    ScanSimConfig cfg;
+    cfg.beams = 720;
+    cfg.rangeMax = 2.5; // Köşelere yakın ışınlar menzil dışı
+    cfg.dropoutRate = 0.1;
+    std::vector<size_t> hits;
+    LidarScan scan = simulateScan(scene, SensorPose{}, cfg, &hits);
+
+    size_t dropouts = 0, noReturn = 0;
+    for (double r : scan.ranges) {
+        dropouts += r == -1.0 ? 1 : 0;
+        noReturn += r == 999.0 ? 1 : 0;
+    }
+    CHECK(dropouts > 0);
+    CHECK(noReturn > 0);
+    CHECK(filterAndConvertToPoints(scan).size() == scan.ranges.size() - dropouts - noReturn);
+
+    GroundTruth truth = computeGroundTruth(scene, SensorPose{}, hits, 60.0);
+    CHECK_EQ(truth.walls.size(), size_t{4});
+    CHECK_EQ(truth.corners.size(), size_t{4});
+    for (const auto& c : truth.corners) {
+        CHECK_NEAR(std::abs(c.position.x), 2.0, 1e-9);
+        CHECK_NEAR(std::abs(c.position.y), 2.0, 1e-9);
+        CHECK_NEAR(c.angleDeg, 90.0, 1e-9);
+    }
+}
+
+TEST(scan_binary_round_trip) {
+    Scene scene;
+    addPolygonRoom(scene, 0.0, 0.0, 6, 3.0);
+    ScanSimConfig cfg;
+    cfg.beams = 1000;
+    cfg.noiseSigma = 0.01;
+    LidarScan scan = simulateScan(scene, SensorPose{}, cfg);
+
+    const auto path = (std::filesystem::temp_directory_path() / "lidar_rt_test.bin").string();
+    CHECK(saveScanBinary(path, scan));
+    CHECK(isBinaryScanFile(path));
+    auto loaded = loadScanBinary(path);
+    std::remove(path.c_str());
+
+    CHECK(loaded.has_value());
+    if (!loaded) return;
+    CHECK(loaded->ranges == scan.ranges);
+    CHECK_EQ(loaded->angle_increment, scan.angle_increment);
+}
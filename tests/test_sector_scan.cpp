@@ -0,0 +1,238 @@
+#include "test_framework.hpp"
+#include "model/geometry.hpp"
+#include "model/lidar.hpp"
+#include "model/ransac.hpp"
+#include "model/scene.hpp"
+#include "model/sector_scan.hpp"
+#include "model/toml_parser.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <string>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// İki kesişen duvar: çift ışınlar y = 2 doğrusuna, tek ışınlar (0, 2)'den 110 derece
+// eğimle geçen doğruya çarpar. Kesişim 90 derecede, yani 200. ışındadır.
+static LidarScan crossingScan() {
+    LidarScan scan;
+    const double deg = M_PI / 180.0;
+    const double alpha = 110.0 * deg;
+    scan.angle_min = 75.0 * deg;
+    scan.angle_increment = 30.0 * deg / 400.0;
+    scan.angle_max = scan.angle_min + 399.5 * scan.angle_increment;
+    scan.range_min = 0.05;
+    scan.range_max = 10.0;
+    for (int i = 0; i < 400; ++i) {
+        const double th = scan.angle_min + i * scan.angle_increment;
+        scan.ranges.push_back(i % 2 == 0 ? 2.0 / std::sin(th) : 2.0 * std::cos(alpha) / std::sin(th - alpha));
+    }
+    return scan;
+}
+
+static void feed(SectorScanProcessor<double>& proc, const LidarScan& scan) {
+    proc.begin(scan);
+    for (size_t i = 0; i < scan.ranges.size(); ++i) {
+        proc.addBeam(i, scan.ranges[i]);
+    }
+    proc.finish();
+}
+
+static SectorParams sectorParams(size_t beams) {
+    SectorParams p;
+    p.sectorBeams = beams;
+    p.seed = 7;
+    p.minInliers = 30; // Sektörde doğru başına ~50 nokta; zikzak adaylar elenir
+    return p;
+}
+
+TEST(sector_stitches_segments_split_at_boundaries) {
+    // Kesişim sektör sınırında: hiçbir sektör tek başına kesişimi göremez
+    SectorScanProcessor<double> proc(sectorParams(100));
+    feed(proc, crossingScan());
+
+    const SectorStats& st = proc.stats();
+    CHECK_EQ(st.sectors, size_t{4});
+    CHECK_EQ(st.rawSegments, size_t{8});
+    CHECK_EQ(st.stitched, size_t{6});
+    CHECK_EQ(proc.segments().size(), size_t{2});
+    CHECK_EQ(proc.intersections().size(), size_t{1});
+    if (!proc.intersections().empty()) {
+        CHECK_NEAR(proc.intersections()[0].position.x, 0.0, 1e-3);
+        CHECK_NEAR(proc.intersections()[0].position.y, 2.0, 1e-3);
+    }
+    // Kesişim ancak birleştirmeden sonra bulundu
+    CHECK(st.firstIntersectionMs >= 0.0);
+    CHECK(st.firstIntersectionLeadMs <= 0.0);
+
+    // Birleşen parçaların inlier'ları yeniden sıralanmış tamponda ardışık
+    size_t inliers = 0;
+    for (const auto& l : proc.segments()) {
+        for (const auto& p : l.inliers(proc.points())) {
+            CHECK(std::abs(l.A * p.x + l.B * p.y + l.C) <= 0.02 + 1e-9);
+        }
+        inliers += l.inlierCount;
+    }
+    CHECK_EQ(inliers, size_t{400});
+}
+
+TEST(sector_reports_first_intersection_before_scan_ends) {
+    // Kesişim ikinci sektörün içinde: son sektör gelmeden bulunur
+    SectorScanProcessor<double> proc(sectorParams(160));
+    feed(proc, crossingScan());
+
+    const SectorStats& st = proc.stats();
+    CHECK_EQ(st.sectors, size_t{3});
+    CHECK_EQ(proc.segments().size(), size_t{2});
+    CHECK(st.firstIntersectionMs >= 0.0);
+    CHECK(st.firstIntersectionLeadMs > 0.0);
+    CHECK(st.finishMs >= 0.0);
+    CHECK_EQ(proc.intersections().size(), size_t{1});
+}
+
+TEST(sector_stitches_recovered_lines_with_sector_segments) {
+    // y = 2 duvarı 3 sektörde; son sektörde her 6. ışın geçerli (17 nokta < minSectorPoints),
+    // bu parça ancak son geçişte bulunur ve komşu sektör parçasıyla birleşir
+    LidarScan scan;
+    const double deg = M_PI / 180.0;
+    scan.angle_min = 60.0 * deg;
+    scan.angle_increment = 60.0 * deg / 300.0;
+    scan.angle_max = scan.angle_min + 299.5 * scan.angle_increment;
+    scan.range_min = 0.05;
+    scan.range_max = 10.0;
+    for (int i = 0; i < 300; ++i) {
+        const double th = scan.angle_min + i * scan.angle_increment;
+        scan.ranges.push_back(i < 200 || i % 6 == 0 ? 2.0 / std::sin(th) : -1.0);
+    }
+
+    SectorParams p;
+    p.sectorBeams = 100;
+    p.seed = 7;
+    p.minInliers = 10;   // minSectorPoints = 20
+    SectorScanProcessor<double> proc(p);
+    feed(proc, scan);
+
+    const SectorStats& st = proc.stats();
+    CHECK_EQ(st.rawSegments, size_t{2});
+    CHECK_EQ(st.recovered, size_t{1});
+    CHECK_EQ(st.stitched, size_t{2});
+    CHECK_EQ(proc.segments().size(), size_t{1});
+    if (!proc.segments().empty()) {
+        const Line& l = proc.segments()[0];
+        CHECK_EQ(l.inlierCount, static_cast<uint32_t>(proc.points().size()));
+        // Uçlar ilk ve son geçerli ışından (294) 5 * eps kısaltılmış
+        CHECK_NEAR(std::max(l.startPoint.x, l.endPoint.x), 2.0 / std::tan(scan.angle_min) - 0.1, 0.02);
+        CHECK_NEAR(std::min(l.startPoint.x, l.endPoint.x),
+                   2.0 / std::tan(scan.angle_min + 294 * scan.angle_increment) + 0.1, 0.02);
+    }
+}
+
+TEST(sector_full_sweep_matches_whole_scan) {
+    Scene scene;
+    addRoom(scene, 0.0, 0.0, 8.0, 5.0);
+    ScanSimConfig cfg;
+    cfg.beams = 2000;
+    cfg.noiseSigma = 0.003;
+    const LidarScan scan = simulateScan(scene, SensorPose{0.4, -0.3, 0.2}, cfg);
+
+    auto points = filterAndConvertToPoints(scan);
+    auto whole = findLinesRANSAC(points, 8, 0.02, 2000, std::pmr::get_default_resource(), 7);
+
+    SectorScanProcessor<double> proc(sectorParams(250));
+    feed(proc, scan);
+
+    // Aynı noktalar (yalnızca sıra farklı); duvarlar sınırlarda ve 0 / 2pi dikişinde birleşir
+    CHECK_EQ(proc.points().size(), points.size());
+    CHECK(proc.stats().stitched > 0);
+    CHECK_EQ(proc.segments().size(), size_t{4});
+    CHECK(proc.segments().size() <= whole.size());
+}
+
+TEST(sector_scan_keeps_corners_of_sample_scan) {
+    auto scan = loadScanFromFile(std::string(LIDAR_DATA_DIR) + "/lidar1.toml");
+    CHECK(scan.has_value());
+    if (!scan) return;
+
+    std::map<size_t, size_t> found;
+    for (uint32_t seed = 1; seed <= 3; ++seed) {
+        auto points = filterAndConvertToPoints(*scan);
+        const auto whole = findLinesRANSAC(points, 8, 0.02, 2000, std::pmr::get_default_resource(), seed);
+        CHECK(!findPhysicalIntersections(whole, 60.0).empty());
+
+        for (size_t beams : {30, 60, 90, 120, 180}) {
+            SectorParams p;
+            p.sectorBeams = beams;
+            p.seed = seed;
+            SectorScanProcessor<double> proc(p);
+            feed(proc, *scan);
+            // 30 ışında bile (~25 nokta / sektör) sektörler kendi parçalarını bulur; son geçiş
+            // yalnızca kalanları tamamlar
+            CHECK(proc.stats().rawSegments > 0);
+            CHECK_EQ(proc.points().size(), points.size());
+            found[beams] += proc.intersections().size();
+        }
+    }
+    // Örnek çoğunlukla dağınık gürültü: tek bir tohumun kesişimleri rastlantısaldır, ama hiçbir
+    // sektör boyu köşeleri sistematik olarak kaybetmez
+    for (const auto& [beams, count] : found) {
+        CHECK(count > 0);
+    }
+}
+
+TEST(sector_scan_finds_walls_of_office_scene) {
+    // scan_generator'ın ofis sahnesi, 3600 ışın: ara bölmeler, L köşe ve dağınık engeller
+    Scene scene;
+    addRoom(scene, 0.0, 0.0, 12.0, 8.0);
+    scene.walls.push_back({{-2.0, -4.0}, {-2.0, -0.5}});
+    scene.walls.push_back({{-2.0, 0.5}, {-2.0, 4.0}});
+    scene.walls.push_back({{3.0, 1.0}, {6.0, 1.0}});
+    scene.walls.push_back({{3.0, 1.0}, {3.0, 2.5}});
+    addClutter(scene, 12, {-5.5, -3.5}, {5.5, 3.5}, 0.8, 42);
+    ScanSimConfig cfg;
+    cfg.beams = 3600;
+    cfg.noiseSigma = 0.005;
+    std::vector<size_t> hits;
+    const LidarScan scan = simulateScan(scene, SensorPose{}, cfg, &hits);
+    const GroundTruth truth = computeGroundTruth(scene, SensorPose{}, hits, 60.0);
+
+    // Duvar bulundu: bir parçanın iki ucu da duvar doğru parçasına 5 cm içinde
+    auto distance = [](const Point& p, const Wall& w) {
+        const double dx = w.b.x - w.a.x, dy = w.b.y - w.a.y;
+        const double u = std::clamp(((p.x - w.a.x) * dx + (p.y - w.a.y) * dy) / (dx * dx + dy * dy), 0.0, 1.0);
+        return std::hypot(w.a.x + u * dx - p.x, w.a.y + u * dy - p.y);
+    };
+    auto wallsFound = [&](const std::pmr::vector<Line>& segments) {
+        size_t found = 0, walls = 0;
+        for (const TruthWall& w : truth.walls) {
+            if (w.hits < 30) continue;
+            ++walls;
+            found += std::any_of(segments.begin(), segments.end(), [&](const Line& l) {
+                return distance(l.startPoint, w.wall) < 0.05 && distance(l.endPoint, w.wall) < 0.05;
+            }) ? 1 : 0;
+        }
+        return std::make_pair(found, walls);
+    };
+
+    auto points = filterAndConvertToPoints(scan);
+    const auto whole = findLinesRANSAC(points, 8, 0.02, 2000, std::pmr::get_default_resource(), 1);
+    for (size_t beams : {90, 180, 360}) {
+        SectorParams p;
+        p.sectorBeams = beams;
+        p.seed = 1;
+        SectorScanProcessor<double> proc(p);
+        feed(proc, scan);
+
+        // Sektör başına RANSAC bütçesi yoğun duvarları ayırır; tam tarama aynı bütçeyi uzak
+        // noktaları birleştiren uzun yapay doğrulara da harcar. 360 ışınlık sektör kapı
+        // boşluğunun iki yanındaki eş doğrusal bölmeleri (x = -2) birlikte görür ve tam tarama
+        // gibi tek doğruya oturtur; daha küçük sektörlerde her duvar ayrı bulunur
+        const auto [found, walls] = wallsFound(proc.segments());
+        CHECK(walls >= 10);
+        CHECK(found >= wallsFound(whole).first);
+        if (beams < 360) CHECK_EQ(found, walls);
+        CHECK(proc.stats().rawSegments > proc.stats().recovered);
+    }
+}
@@ -0,0 +1,73 @@
+#include "test_framework.hpp"
+#include "utils/spsc_ring.hpp"
+
+#include <memory>
+#include <thread>
+
+TEST(spsc_ring_full_empty_and_wraparound) {
+    SpscRing<int> ring(3); // 4'e yuvarlanır
+    CHECK_EQ(ring.capacity(), size_t{4});
+
+    int v = 0;
+    CHECK(!ring.tryPop(v));
+    // Sayaçlar kapasitenin birkaç katı ilerler: indeks sarması sırayı bozmaz
+    int next = 0, expected = 0;
+    for (int round = 0; round < 5; ++round) {
+        while (ring.tryPush(next)) ++next;
+        CHECK_EQ(ring.size(), size_t{4});
+        for (int k = 0; k < 3; ++k) {
+            CHECK(ring.tryPop(v));
+            CHECK_EQ(v, expected++);
+        }
+    }
+    while (ring.tryPop(v)) CHECK_EQ(v, expected++);
+    CHECK_EQ(expected, next);
+    CHECK_EQ(ring.size(), size_t{0});
+}
+
+TEST(spsc_ring_full_push_keeps_value) {
+    // Dolu halkaya taşıyarak itme değeri çağırandan almaz
+    SpscRing<std::unique_ptr<int>> ring(2);
+    CHECK(ring.tryPush(std::make_unique<int>(1)));
+    CHECK(ring.tryPush(std::make_unique<int>(2)));
+
+    auto third = std::make_unique<int>(3);
+    CHECK(!ring.tryPush(std::move(third)));
+    CHECK(third != nullptr);
+
+    std::unique_ptr<int> out;
+    CHECK(ring.tryPop(out));
+    CHECK_EQ(*out, 1);
+    CHECK(ring.tryPush(std::move(third)));
+    CHECK(third == nullptr);
+    CHECK(ring.tryPop(out));
+    CHECK(ring.tryPop(out));
+    CHECK_EQ(*out, 3);
+}
+
+TEST(spsc_ring_two_threads_keep_order) {
+    SpscRing<size_t> ring(8);
+    const size_t count = 200000;
+
+    std::thread producer([&ring, count] {
+        for (size_t i = 0; i < count; ++i) {
+            while (!ring.tryPush(i)) std::this_thread::yield();
+        }
+    });
+
+    size_t expected = 0;
+    bool ordered = true;
+    while (expected < count) {
+        size_t v = 0;
+        if (!ring.tryPop(v)) {
+            std::this_thread::yield();
+            continue;
+        }
+        ordered = ordered && v == expected;
+        ++expected;
+    }
+    producer.join();
+
+    CHECK(ordered);
+    CHECK_EQ(ring.size(), size_t{0});
+}
@@ -0,0 +1,134 @@
+#include "test_framework.hpp"
+#include "model/geometry.hpp"
+#include "model/lidar.hpp"
+#include "model/ransac.hpp"
+#include "model/toml_parser.hpp"
+#include "utils/cli.hpp"
+#include "view/label_index.hpp"
+#include "view/svg_writer.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+static std::string readFile(const std::string& path) {
+    std::ifstream f(path, std::ios::binary);
+    std::stringstream ss;
+    ss << f.rdbuf();
+    return ss.str();
+}
+
+// Tamponlu yazıcı eski ofstream yazıcısıyla bayt bayt aynı dosyayı üretmeli
+template <typename T>
+static void checkBackendsMatch(const LidarScan& scan, const char* tag) {
+    const CliParams d;
+    LidarScanT<T> s = convertScanHeader<T>(scan);
+    for (double r : scan.ranges) s.ranges.push_back(static_cast<T>(r));
+
+    auto pts = filterAndConvertToPoints(s);
+    auto lines = findLinesRANSAC(pts, d.minInliers, d.epsilon, d.maxIters, std::pmr::get_default_resource(), 3);
+    auto xs = findPhysicalIntersections(lines, d.angleThreshDeg);
+    CHECK(!xs.empty()); // Etiketler ve std::fixed sonrası biçim de karşılaştırılsın
+
+    namespace fs = std::filesystem;
+    const std::string base = (fs::temp_directory_path() / "lidar_test_svg_").string() + tag;
+    SvgParams sp{d.svgWidth, d.svgHeight, d.svgMargin, SvgBackend::Stream};
+    saveToSVG(base + "_stream.svg", pts, lines, xs, sp);
+    sp.backend = SvgBackend::Buffered;
+    saveToSVG(base + "_buffered.svg", pts, lines, xs, sp);
+
+    const std::string a = readFile(base + "_stream.svg");
+    const std::string b = readFile(base + "_buffered.svg");
+    CHECK(!a.empty());
+    CHECK_EQ(a.size(), b.size());
+    CHECK(a == b);
+
+    std::error_code ec;
+    fs::remove(base + "_stream.svg", ec);
+    fs::remove(base + "_buffered.svg", ec);
+}
+
+TEST(svg_buffered_backend_matches_stream_backend) {
+    auto scan = loadScanFromFile(std::string(LIDAR_DATA_DIR) + "/lidar1.toml");
+    CHECK(scan.has_value());
+    if (!scan) return;
+
+    checkBackendsMatch<double>(*scan, "f64");
+    checkBackendsMatch<float>(*scan, "f32");
+}
+
+// LOD çıktısının boyutu nokta sayısına değil dolu piksel sayısına bağlı olmalı
+TEST(svg_lod_size_depends_on_occupied_pixels_only) {
+    namespace fs = std::filesystem;
+    const std::string path = (fs::temp_directory_path() / "lidar_test_svg_lod.svg").string();
+
+    std::pmr::vector<Point> few;
+    for (int i = 0; i < 200; ++i) {
+        few.push_back({-2.5 + i * 0.025, 1.0});
+    }
+    std::pmr::vector<Point> many;
+    for (int k = 0; k < 50; ++k) {
+        many.insert(many.end(), few.begin(), few.end());
+    }
+    const std::pmr::vector<Line> noLines;
+    const std::pmr::vector<Intersection> noXs;
+
+    SvgParams sp;
+    sp.lodThreshold = 100;
+    saveToSVG(path, few, noLines, noXs, sp);
+    const std::string a = readFile(path);
+    saveToSVG(path, many, noLines, noXs, sp);
+    const std::string b = readFile(path);
+
+    CHECK(a.find("r='1.75'") == std::string::npos);
+    CHECK(a.find("data-lod-cells=") != std::string::npos);
+    CHECK_EQ(a.size() - a.find("Doğru:"), b.size() - b.find("Doğru:"));
+
+    // Eşiğin altında eski nokta başına daire çizimi
+    sp.lodThreshold = few.size();
+    saveToSVG(path, few, noLines, noXs, sp);
+    const std::string c = readFile(path);
+    CHECK(c.find("data-lod-cells=") == std::string::npos);
+    CHECK(c.find("r='1.75'") != std::string::npos);
+
+    std::error_code ec;
+    fs::remove(path, ec);
+}
+
+// Izgara dizini, tüm kutuları tek tek deneyen eski döngüyle aynı sonucu vermeli
+TEST(label_index_matches_brute_force) {
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> px(-50.0, 1250.0);
+    std::uniform_real_distribution<double> py(-50.0, 950.0);
+
+    struct Box { double x, y, w, h; };
+    std::vector<Box> placed;
+    LabelIndex index(1200, 900, 64.0);
+    const double w = 45, h = 32, pad = 15;
+
+    size_t agreed = 0;
+    for (int i = 0; i < 4000; ++i) {
+        const double x = px(rng);
+        const double y = py(rng);
+
+        bool brute = false;
+        for (const auto& u : placed) {
+            if (!(x + w + pad < u.x || x > u.x + u.w + pad || y + h + pad < u.y || y > u.y + u.h + pad)) {
+                brute = true;
+                break;
+            }
+        }
+        const bool fast = index.overlaps(x, y, w, h, pad);
+        CHECK_EQ(fast, brute);
+        agreed += fast == brute ? 1 : 0;
+
+        if (!brute) {
+            placed.push_back({x, y, w, h});
+            index.insert(x, y, w, h);
+        }
+    }
+    CHECK_EQ(agreed, size_t{4000});
+    CHECK(placed.size() > 50);
+    CHECK_EQ(index.size(), placed.size());
+}
@@ -0,0 +1,142 @@
+#include "test_framework.hpp"
+#include "model/lidar.hpp"
+#include "model/scan_binary.hpp"
+#include "model/scan_stream.hpp"
+#include "model/toml_parser.hpp"
+#include "model/toml_writer.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+TEST(toml_loads_sample_scan) {
+    auto scan = loadScanFromFile(std::string(LIDAR_DATA_DIR) + "/lidar1.toml");
+    CHECK(scan.has_value());
+    if (!scan) return;
+
+    CHECK_NEAR(scan->angle_min, 0.0, 1e-12);
+    CHECK_NEAR(scan->angle_max, 4.71238898, 1e-12);
+    CHECK_NEAR(scan->angle_increment, 0.0174533, 1e-12);
+    CHECK_NEAR(scan->range_min, 0.2, 1e-12);
+    CHECK_NEAR(scan->range_max, 3.0, 1e-12);
+    CHECK(!scan->ranges.empty());
+    CHECK_NEAR(scan->ranges.front(), 1.0, 1e-12);
+}
+
+TEST(toml_missing_file_returns_nullopt) {
+    CHECK(!loadScanFromFile("/nonexistent/scan.toml").has_value());
+}
+
+TEST(toml_writer_round_trip) {
+    LidarScan scan;
+    scan.angle_min = -1.5;
+    scan.angle_max = 1.5;
+    scan.angle_increment = 0.1;
+    scan.range_min = 0.1;
+    scan.range_max = 8.0;
+    for (int i = 0; i < 31; ++i) scan.ranges.push_back(i % 7 == 0 ? -1.0 : 0.5 + i * 0.0123);
+
+    const auto path = (std::filesystem::temp_directory_path() / "lidar_rt_test.toml").string();
+    CHECK(saveScanToFile(path, scan));
+    auto loaded = loadScanFromFile(path);
+    std::remove(path.c_str());
+
+    CHECK(loaded.has_value());
+    if (!loaded) return;
+    CHECK_EQ(loaded->ranges.size(), scan.ranges.size());
+    for (size_t i = 0; i < scan.ranges.size() && i < loaded->ranges.size(); ++i) {
+        CHECK_NEAR(loaded->ranges[i], scan.ranges[i], 1e-12);
+    }
+    CHECK_NEAR(loaded->angle_increment, scan.angle_increment, 1e-12);
+}
+
+TEST(lidar_filter_drops_sentinels_and_out_of_range) {
+    LidarScan scan;
+    scan.angle_min = 0.0;
+    scan.angle_max = 1.0;
+    scan.angle_increment = 0.1;
+    scan.range_min = 0.2;
+    scan.range_max = 3.0;
+    scan.ranges = {1.0, -1.0, 999.0, -999.0, 0.1, 3.5, 2.0};
+
+    auto pts = filterAndConvertToPoints(scan);
+    CHECK_EQ(pts.size(), size_t{2});
+    if (pts.size() == 2) {
+        CHECK_NEAR(pts[0].x, 1.0, 1e-12);
+        CHECK_NEAR(pts[1].x, 2.0 * std::cos(0.6), 1e-12);
+    }
+}
+
+static std::vector<double> streamRanges(const std::string& text, size_t chunk, LidarScan* header = nullptr) {
+    std::vector<double> out;
+    ScanStreamDecoder decoder([&out](const LidarScan&, size_t, double r) { out.push_back(r); });
+    for (size_t i = 0; i < text.size(); i += chunk) {
+        decoder.feed(text.data() + i, std::min(chunk, text.size() - i));
+    }
+    decoder.finish();
+    if (header) *header = decoder.header();
+    return out;
+}
+
+TEST(toml_stream_is_chunk_size_independent) {
+    const std::string text =
+        "[header]\nframe_id = \"laser\"\n\n[scan]\nangle_min = -0.5\nangle_increment = 0.25\n"
+        "range_min = 0.1 # yorum\nrange_max = 4.0\n"
+        "ranges = [ 1.0, 2.5,\n  -1.0, 999.0, # yorum, 7.0\n  3.25 ]\nintensities = [9, 9]\n";
+
+    LidarScan header;
+    const std::vector<double> expected = {1.0, 2.5, -1.0, 999.0, 3.25};
+    CHECK(streamRanges(text, text.size(), &header) == expected);
+    CHECK_NEAR(header.angle_min, -0.5, 1e-12);
+    CHECK_NEAR(header.range_min, 0.1, 1e-12);
+    CHECK_NEAR(header.range_max, 4.0, 1e-12);
+
+    for (size_t chunk : {1, 2, 3, 7, 64}) {
+        CHECK(streamRanges(text, chunk) == expected);
+    }
+}
+
+TEST(toml_stream_emits_ranges_before_end_of_input) {
+    size_t seen = 0;
+    TomlScanStreamParser parser([&seen](const LidarScan& h, size_t i, double) {
+        CHECK_NEAR(h.angle_increment, 0.5, 1e-12); // Başlık dizi başlamadan hazır
+        CHECK_EQ(i, seen);
+        ++seen;
+    });
+
+    const std::string head = "[scan]\nangle_increment = 0.5\nranges = [1.0, 2.0, 3.0, ";
+    parser.feed(head.data(), head.size());
+    CHECK_EQ(seen, size_t{3}); // Akış bitmeden işlendi
+
+    const std::string tail = "4.0]\n";
+    parser.feed(tail.data(), tail.size());
+    parser.finish();
+    CHECK_EQ(seen, size_t{4});
+}
+
+TEST(binary_stream_matches_file_loader) {
+    LidarScan scan;
+    scan.angle_increment = 0.01;
+    scan.range_max = 5.0;
+    for (int i = 0; i < 1000; ++i) scan.ranges.push_back(0.5 + i * 0.001);
+
+    const auto path = (std::filesystem::temp_directory_path() / "lidar_stream_test.bin").string();
+    CHECK(saveScanBinary(path, scan));
+    std::ifstream f(path, std::ios::binary);
+    const std::string bytes((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+    std::remove(path.c_str());
+
+    for (size_t chunk : {1, 5, 8, 13, 4096}) {
+        LidarScan header;
+        auto ranges = streamRanges(bytes, chunk, &header);
+        CHECK(std::equal(ranges.begin(), ranges.end(), scan.ranges.begin(), scan.ranges.end()));
+        CHECK_EQ(header.angle_increment, 0.01);
+    }
+
+    // Kesik akış hata olarak raporlanır
+    ScanStreamDecoder truncated([](const LidarScan&, size_t, double) {});
+    truncated.feed(bytes.data(), bytes.size() / 2);
+    truncated.finish();
+    CHECK(!truncated.ok());
+}
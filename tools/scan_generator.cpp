@@ -0,0 +1,214 @@
+// Sentetik lidar tarama üreticisi: yapılandırılabilir 2D sahneden ışın izleyerek
+// TOML veya ikili tarama + yer gerçeği (duvarlar / köşeler) dosyası yazar.
+#include "model/scan_binary.hpp"
+#include "model/scene.hpp"
+#include "model/toml_writer.hpp"
+#include "utils/cli.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+
+struct GeneratorParams {
+    std::string scene     = "room";
+    std::string outPath   = "data/synthetic_scan.toml";
+    std::string truthPath;             // Boşsa <out>.truth.toml
+    std::string format;                // Boşsa uzantıdan (.bin -> ikili)
+    SensorPose  pose;
+    ScanSimConfig sim;
+    int    racks          = -1;        // -1: sahne varsayılanı
+    int    clutter        = -1;
+    double minAngleDeg    = CliParams{}.angleThreshDeg;
+};
+
+static bool parse_double(const char* s, double& out) {
+    char* end = nullptr;
+    double v = std::strtod(s, &end);
+    if (!end || *end != '\0') return false;
+    out = v;
+    return true;
+}
+
+static bool parse_count(const char* s, long long& out) {
+    char* end = nullptr;
+    long long v = std::strtoll(s, &end, 10);
+    if (!end || *end != '\0' || v < 0) return false;
+    out = v;
+    return true;
+}
+
+static bool parse_pose(const std::string& s, SensorPose& pose) {
+    std::stringstream ss(s);
+    std::string x, y, yaw;
+    if (!std::getline(ss, x, ',') || !std::getline(ss, y, ',')) return false;
+    std::getline(ss, yaw, ',');
+    return parse_double(x.c_str(), pose.x) && parse_double(y.c_str(), pose.y) &&
+           (yaw.empty() || parse_double(yaw.c_str(), pose.yaw));
+}
+
+static void print_help(const char* exe) {
+    std::cout
+      << "Usage:\n  " << exe << " [options]\n\n"
+      << "Sahne:\n"
+      << "      --scene <name>           room | corridor | office | warehouse (default: room)\n"
+      << "      --racks <n>              Raf sayisi (warehouse default: 8)\n"
+      << "      --clutter <n>            Rastgele engel sayisi (default: sahneye gore)\n"
+      << "      --pose <x,y[,yaw]>       Sensor pozu, dunya cercevesi (default: 0,0,0)\n\n"
+      << "Tarama:\n"
+      << "      --beams <n>              Isin sayisi (default: 360)\n"
+      << "      --resolution <rad>       Acisal cozunurluk (default: 2*pi/beams)\n"
+      << "      --angle-min <rad>        Baslangic acisi (default: 0)\n"
+      << "      --range-min <m>          (default: 0.05)\n"
+      << "      --range-max <m>          (default: 10)\n"
+      << "      --noise <m>              Gauss gurultu sigma (default: 0)\n"
+      << "      --dropout <0..1>         Kayip isin orani (default: 0)\n"
+      << "      --dropout-value <v>      Kayip isin degeri (default: -1)\n"
+      << "      --no-return-value <v>    Menzil disi isin degeri (default: 999)\n"
+      << "      --error-rate <0..1>      Hatali isin orani (default: 0)\n"
+      << "      --error-value <v>        Hatali isin degeri (default: -999)\n"
+      << "      --seed <n>               (default: 42)\n\n"
+      << "Cikti:\n"
+      << "      --out <path>             Tarama dosyasi (default: data/synthetic_scan.toml)\n"
+      << "      --format <toml|bin|qbin> (default: uzantidan, .bin -> ikili; qbin: 16 bit sikistirilmis ikili)\n"
+      << "      --truth <path>           Yer gercegi (default: <out>.truth.toml)\n"
+      << "      --min-angle <deg>        Kose sayilacak min aci (default: " << CliParams{}.angleThreshDeg << ")\n"
+      << "  -h, --help                   Bu yardimi goster\n";
+}
+
+static std::optional<GeneratorParams> parse_args(int argc, char* argv[]) {
+    GeneratorParams p;
+    for (int i = 1; i < argc; ++i) {
+        std::string a = argv[i];
+        const char* v = i + 1 < argc ? argv[i + 1] : nullptr;
+        long long n = 0;
+        bool ok = v != nullptr;
+
+        if (a == "-h" || a == "--help") { print_help(argv[0]); return std::nullopt; }
+        else if (a == "--scene" && ok) p.scene = v;
+        else if (a == "--racks" && ok && (ok = parse_count(v, n))) p.racks = static_cast<int>(n);
+        else if (a == "--clutter" && ok && (ok = parse_count(v, n))) p.clutter = static_cast<int>(n);
+        else if (a == "--pose" && ok) ok = parse_pose(v, p.pose);
+        else if (a == "--beams" && ok && (ok = parse_count(v, n))) p.sim.beams = static_cast<size_t>(n);
+        else if (a == "--resolution" && ok) ok = parse_double(v, p.sim.angleIncrement);
+        else if (a == "--angle-min" && ok) ok = parse_double(v, p.sim.angleMin);
+        else if (a == "--range-min" && ok) ok = parse_double(v, p.sim.rangeMin);
+        else if (a == "--range-max" && ok) ok = parse_double(v, p.sim.rangeMax);
+        else if (a == "--noise" && ok) ok = parse_double(v, p.sim.noiseSigma);
+        else if (a == "--dropout" && ok) ok = parse_double(v, p.sim.dropoutRate);
+        else if (a == "--dropout-value" && ok) ok = parse_double(v, p.sim.dropoutValue);
+        else if (a == "--no-return-value" && ok) ok = parse_double(v, p.sim.noReturnValue);
+        else if (a == "--error-rate" && ok) ok = parse_double(v, p.sim.errorRate);
+        else if (a == "--error-value" && ok) ok = parse_double(v, p.sim.errorValue);
+        else if (a == "--seed" && ok && (ok = parse_count(v, n))) p.sim.seed = static_cast<uint32_t>(n);
+        else if (a == "--out" && ok) p.outPath = v;
+        else if (a == "--format" && ok) p.format = v;
+        else if (a == "--truth" && ok) p.truthPath = v;
+        else if (a == "--min-angle" && ok) ok = parse_double(v, p.minAngleDeg);
+        else ok = false;
+
+        if (!ok) {
+            std::cerr << "[!] Bilinmeyen veya hatali arguman: " << a << "\n\n";
+            print_help(argv[0]);
+            return std::nullopt;
+        }
+        ++i;
+    }
+
+    if (p.format.empty()) {
+        const bool isBin = p.outPath.size() >= 4 && p.outPath.compare(p.outPath.size() - 4, 4, ".bin") == 0;
+        p.format = isBin ? "bin" : "toml";
+    }
+    if (p.format != "toml" && p.format != "bin" && p.format != "qbin") {
+        std::cerr << "[!] --format toml|bin|qbin\n";
+        return std::nullopt;
+    }
+    if (p.truthPath.empty()) {
+        p.truthPath = p.outPath + ".truth.toml";
+    }
+    return p;
+}
+
+// Hazır sahneler; raf / engel sayıları parametre ile değiştirilebilir
+static std::optional<Scene> build_scene(const GeneratorParams& p) {
+    Scene scene;
+    const uint32_t seed = p.sim.seed + 1;
+
+    if (p.scene == "room") {
+        addRoom(scene, 0.0, 0.0, 5.0, 4.0);
+        addClutter(scene, p.clutter < 0 ? 0 : p.clutter, {-2.2, -1.7}, {2.2, 1.7}, 0.4, seed);
+    } else if (p.scene == "corridor") {
+        // T kavşağı: ana koridorun üst duvarında yan koridor ağzı
+        scene.walls.push_back({{-12.0, -1.0}, {12.0, -1.0}});
+        scene.walls.push_back({{-12.0, 1.0}, {-0.8, 1.0}});
+        scene.walls.push_back({{0.8, 1.0}, {12.0, 1.0}});
+        addCorridor(scene, {0.0, 1.0}, {0.0, 10.0}, 1.6);
+        scene.walls.push_back({{-12.0, -1.0}, {-12.0, 1.0}}); // Uç duvarları
+        scene.walls.push_back({{12.0, -1.0}, {12.0, 1.0}});
+        scene.walls.push_back({{-0.8, 10.0}, {0.8, 10.0}});
+        addClutter(scene, p.clutter < 0 ? 4 : p.clutter, {-10.0, -0.8}, {10.0, 0.8}, 0.3, seed);
+    } else if (p.scene == "office") {
+        addRoom(scene, 0.0, 0.0, 12.0, 8.0);
+        // Kapı boşluklu ara bölmeler
+        scene.walls.push_back({{-2.0, -4.0}, {-2.0, -0.5}});
+        scene.walls.push_back({{-2.0, 0.5}, {-2.0, 4.0}});
+        scene.walls.push_back({{3.0, 1.0}, {6.0, 1.0}});
+        scene.walls.push_back({{3.0, 1.0}, {3.0, 2.5}});
+        addClutter(scene, p.clutter < 0 ? 12 : p.clutter, {-5.5, -3.5}, {5.5, 3.5}, 0.8, seed);
+    } else if (p.scene == "warehouse") {
+        addRoom(scene, 0.0, 0.0, 30.0, 20.0);
+        const int racks = p.racks < 0 ? 8 : p.racks;
+        for (int r = 0; r < racks; ++r) {
+            // Koridorun iki yanında 4'erli raf sıraları
+            const int row = r / 4;
+            const int col = r % 4;
+            const double y = (row % 2 == 0 ? 1.0 : -1.0) * (3.0 + (row / 2) * 3.0);
+            addRack(scene, -10.5 + col * 7.0, y, 5.0, 1.0, 0.0);
+        }
+        addClutter(scene, p.clutter < 0 ? 20 : p.clutter, {-14.0, -9.0}, {14.0, 9.0}, 1.0, seed);
+        return scene;
+    } else {
+        std::cerr << "[!] Bilinmeyen sahne: " << p.scene << "\n";
+        return std::nullopt;
+    }
+
+    // Diğer sahnelerde raf ancak istenirse eklenir
+    for (int r = 0; r < p.racks; ++r) {
+        addRack(scene, -1.5 + r * 1.2, 1.2, 0.9, 0.3, 0.0);
+    }
+    return scene;
+}
+
+int main(int argc, char* argv[]) {
+    std::optional<GeneratorParams> params = parse_args(argc, argv);
+    if (!params) return 1;
+
+    std::optional<Scene> scene = build_scene(*params);
+    if (!scene) return 1;
+
+    std::vector<size_t> wallHits;
+    LidarScan scan = simulateScan(*scene, params->pose, params->sim, &wallHits);
+    GroundTruth truth = computeGroundTruth(*scene, params->pose, wallHits, params->minAngleDeg);
+
+    bool ok = false;
+    if (params->format == "qbin") {
+        ok = saveScanBinary(params->outPath, quantizeScan(scan));
+    } else if (params->format == "bin") {
+        ok = saveScanBinary(params->outPath, scan);
+    } else {
+        ok = saveScanToFile(params->outPath, scan);
+    }
+    if (!ok || !saveGroundTruthToFile(params->truthPath, truth, params->pose)) {
+        return 1;
+    }
+
+    size_t visible = 0;
+    for (const auto& w : truth.walls) visible += w.hits > 0 ? 1 : 0;
+
+    std::cout << "[i] " << scan.ranges.size() << " isin -> " << params->outPath
+              << " (" << params->format << ")\n";
+    std::cout << "[i] Yer gercegi: " << visible << "/" << truth.walls.size() << " gorulen duvar, "
+              << truth.corners.size() << " kose -> " << params->truthPath << "\n";
+    return 0;
+}
@@ -0,0 +1,536 @@
+// Gerçek zamanlı tekrar oynatıcı: kayıtlı tarama dizisini sabit hızda, sensör sürücüsünün
+// yerine geçen kilitsiz SPSC halka üzerinden analiz hattına verir; kare başına uçtan uca
+// gecikme yüzdeliklerini, süre aşımlarını ve düşen / atlanan kareleri raporlar.
+// İstenirse işlenen kareler kayan doluluk ızgarasında ve / veya küresel çizgi haritasında
+// biriktirilir (poz: <tarama>.truth.toml). --readers ile sonuçlar kilitsiz yayınlanır ve canlı
+// okuyucu iş parçacıkları son kareyi izler.
+#include "model/geometry.hpp"
+#include "model/incremental_intersections.hpp"
+#include "model/lidar.hpp"
+#include "model/line_map.hpp"
+#include "model/occupancy_grid.hpp"
+#include "model/ransac.hpp"
+#include "model/scan_binary.hpp"
+#include "model/toml_parser.hpp"
+#include "utils/cli.hpp"
+#include "utils/scan_arena.hpp"
+#include "utils/snapshot_publisher.hpp"
+#include "utils/spsc_ring.hpp"
+#include "view/raster_writer.hpp"
+#include "view/result_writer.hpp"
+#include "view/svg_writer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+// Aşırı yükte:
+//   Queue - her kare sırayla işlenir; halka doluysa sürücü yeni kareyi düşürür
+//   Skip  - tüketici her seferinde en yeni kareyi alır, bekleyen eskiler atlanır
+enum class OverloadPolicy { Queue, Skip };
+
+struct ReplayParams {
+    std::vector<std::string> inputs;   // Dosyalar ve / veya dizinler (dizin içi ada göre sıralı)
+    std::vector<double> rates = {10.0};
+    size_t frames         = 0;         // 0: dizinin uzunluğu (en az 100)
+    size_t queue          = 4;
+    OverloadPolicy policy = OverloadPolicy::Queue;
+    double deadlineMs     = 0.0;       // 0: bir periyot (1000 / hız)
+    std::string outPath;               // Boş değilse JSON Lines
+    double incrementalTol = -1.0;      // >= 0: kareler arası artımlı kesişim (eşleme toleransı, m)
+    std::string gridPath;              // Boş değilse doluluk ızgarası (.svg / .pgm / .ppm)
+    OccupancyGridParams grid;
+    std::string mapPath;               // Boş değilse küresel çizgi haritası (lidar-result/1 JSON)
+    size_t readers        = 0;         // >0: sonuçları yayınla, bu kadar canlı okuyucu
+    double readerPeriodMs = 1.0;       // Okuyucunun iki okuması arası
+    CliParams analysis;                // RANSAC / geometri değerleri
+};
+
+struct ReplayResult {
+    double rateHz = 0.0;
+    double deadlineMs = 0.0;
+    size_t frames = 0;
+    size_t processed = 0;
+    size_t missed = 0;     // Gecikmesi süreyi aşan işlenmiş kareler
+    size_t dropped = 0;    // Halka dolu: sürücü kareyi bırakamadı
+    size_t skipped = 0;    // Skip: işlenmeden yerine yenisi alındı
+    double p50Ms = 0.0, p99Ms = 0.0, p999Ms = 0.0, maxMs = 0.0;
+    double serviceMeanMs = 0.0, serviceMaxMs = 0.0;
+    double wallSeconds = 0.0;
+    double pairsReusedPct = 0.0;  // Artımlı kesişimde önbellekten gelen çift oranı
+};
+
+// Yüklenen dizi: pozlar yer gerçeği dosyalarından, yoksa orijin
+struct Sequence {
+    std::vector<LidarScan> scans;
+    std::vector<SensorPose> poses;
+    size_t posed = 0;             // Pozu dosyadan gelen kare
+};
+
+// Halkadan geçen kayıt: taramanın kendisi değil, önceden yüklenmiş dizideki indeksi
+struct FrameTicket {
+    size_t sequence = 0;
+    Clock::time_point released;   // Sürücünün kareyi teslim ettiği an
+};
+
+static double msSince(Clock::time_point a, Clock::time_point b) {
+    return std::chrono::duration<double, std::milli>(b - a).count();
+}
+
+// Sıralı dizide en yakın sıra yöntemi (benchmarks ile aynı)
+static double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size()));
+    return sorted[std::min(sorted.size() - 1, rank == 0 ? 0 : rank - 1)];
+}
+
+static bool parse_double(const char* s, double& out) {
+    char* end = nullptr;
+    double v = std::strtod(s, &end);
+    if (!end || *end != '\0') return false;
+    out = v;
+    return true;
+}
+
+static bool parse_count(const char* s, long long& out) {
+    char* end = nullptr;
+    long long v = std::strtoll(s, &end, 10);
+    if (!end || *end != '\0' || v < 0) return false;
+    out = v;
+    return true;
+}
+
+static bool parse_rates(const std::string& s, std::vector<double>& out) {
+    out.clear();
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        double v = 0.0;
+        if (!parse_double(item.c_str(), v) || !(v > 0.0)) return false;
+        out.push_back(v);
+    }
+    return !out.empty();
+}
+
+static void print_help(const char* exe) {
+    std::cout
+      << "Usage:\n  " << exe << " [options] <tarama|dizin> [<tarama|dizin> ...]\n\n"
+      << "Oynatma:\n"
+      << "      --rate <hz[,hz...]>      Kare hizi; virgulle birden cok hiz sirayla denenir (default: 10)\n"
+      << "      --frames <n>             Hiz basina kare; dizi basa sararak tekrarlanir (default: max(dizi, 100))\n"
+      << "      --queue <n>              Surucu halkasi kapasitesi, 2'nin kuvvetine yuvarlanir (default: 4)\n"
+      << "      --policy <p>             queue | skip (default: queue)\n"
+      << "      --deadline <ms>          Kare basina sure siniri, 0 = bir periyot (default: 0)\n"
+      << "      --incremental <m>        Kesisimleri kareler arasi artimli hesapla (parca esleme toleransi)\n"
+      << "      --out <path>             Hiz basina JSON Lines kaydi\n\n"
+      << "Doluluk Izgarasi:\n"
+      << "      --grid <path>            Islenen kareleri izgarada biriktir, son hizinkini yaz (.svg / .pgm / .ppm)\n"
+      << "      --grid-cell <m>          Hucre boyu (default: " << OccupancyGridParams{}.cellSize << ")\n"
+      << "      --grid-tiles <n>         Pencere kenari, 16 hucrelik karo (default: " << OccupancyGridParams{}.tiles << ")\n"
+      << "      --map <path>             Kare dogrularini kuresel cizgi haritasinda birlestir, son hizinkini JSON yaz\n\n"
+      << "Canli Yayin:\n"
+      << "      --readers <n>            Sonuclari kilitsiz yayinla, n okuyucu son kareyi izler (default: 0, en fazla "
+      << SnapshotPublisher<ResultFrame>::kMaxReaders << ")\n"
+      << "      --reader-period <ms>     Okuyucunun iki okumasi arasi (default: " << ReplayParams{}.readerPeriodMs << ")\n\n"
+      << "Analiz:\n"
+      << "      --epsilon <m>            (default: " << CliParams{}.epsilon << ")\n"
+      << "      --min-inliers <n>        (default: " << CliParams{}.minInliers << ")\n"
+      << "      --max-iters <n>          (default: " << CliParams{}.maxIters << ")\n"
+      << "      --angle-thresh <deg>     (default: " << CliParams{}.angleThreshDeg << ")\n"
+      << "      --seed <n>               0 = saat (default: " << CliParams{}.seed << ")\n"
+      << "  -h, --help                   Bu yardimi goster\n";
+}
+
+static std::optional<ReplayParams> parse_args(int argc, char* argv[]) {
+    ReplayParams p;
+    for (int i = 1; i < argc; ++i) {
+        std::string a = argv[i];
+        const char* v = i + 1 < argc ? argv[i + 1] : nullptr;
+        long long n = 0;
+        bool ok = v != nullptr;
+
+        if (a == "-h" || a == "--help") { print_help(argv[0]); return std::nullopt; }
+        else if (a.empty() || a[0] != '-') { p.inputs.push_back(a); continue; }
+        else if (a == "--rate" && ok) ok = parse_rates(v, p.rates);
+        else if (a == "--frames" && ok && (ok = parse_count(v, n))) p.frames = static_cast<size_t>(n);
+        else if (a == "--queue" && ok && (ok = parse_count(v, n) && n > 0)) p.queue = static_cast<size_t>(n);
+        else if (a == "--policy" && ok && (ok = std::string(v) == "queue" || std::string(v) == "skip")) {
+            p.policy = std::string(v) == "skip" ? OverloadPolicy::Skip : OverloadPolicy::Queue;
+        }
+        else if (a == "--deadline" && ok) ok = parse_double(v, p.deadlineMs) && p.deadlineMs >= 0.0;
+        else if (a == "--out" && ok) p.outPath = v;
+        else if (a == "--incremental" && ok) ok = parse_double(v, p.incrementalTol) && p.incrementalTol >= 0.0;
+        else if (a == "--grid" && ok) p.gridPath = v;
+        else if (a == "--map" && ok) p.mapPath = v;
+        else if (a == "--readers" && ok && (ok = parse_count(v, n) && n <= static_cast<long long>(SnapshotPublisher<ResultFrame>::kMaxReaders))) {
+            p.readers = static_cast<size_t>(n);
+        }
+        else if (a == "--reader-period" && ok) ok = parse_double(v, p.readerPeriodMs) && p.readerPeriodMs >= 0.0;
+        else if (a == "--grid-cell" && ok) ok = parse_double(v, p.grid.cellSize) && p.grid.cellSize > 0.0;
+        else if (a == "--grid-tiles" && ok && (ok = parse_count(v, n) && n > 0 && n <= 1024)) p.grid.tiles = static_cast<size_t>(n);
+        else if (a == "--epsilon" && ok) ok = parse_double(v, p.analysis.epsilon);
+        else if (a == "--min-inliers" && ok && (ok = parse_count(v, n))) p.analysis.minInliers = static_cast<int>(n);
+        else if (a == "--max-iters" && ok && (ok = parse_count(v, n))) p.analysis.maxIters = static_cast<int>(n);
+        else if (a == "--angle-thresh" && ok) ok = parse_double(v, p.analysis.angleThreshDeg);
+        else if (a == "--seed" && ok && (ok = parse_count(v, n))) p.analysis.seed = static_cast<uint32_t>(n);
+        else ok = false;
+
+        if (!ok) {
+            std::cerr << "[!] Bilinmeyen veya hatali arguman: " << a << "\n\n";
+            print_help(argv[0]);
+            return std::nullopt;
+        }
+        ++i;
+    }
+
+    if (p.inputs.empty()) {
+        std::cerr << "[!] Tarama dosyasi veya dizini belirtilmedi.\n\n";
+        print_help(argv[0]);
+        return std::nullopt;
+    }
+    return p;
+}
+
+// Diziyi oynatmadan önce belleğe alır: disk / ayrıştırma süresi ölçüme girmez
+static bool load_sequence(const std::vector<std::string>& inputs, Sequence& seq) {
+    namespace fs = std::filesystem;
+    std::vector<std::string> paths;
+    for (const auto& in : inputs) {
+        std::error_code ec;
+        if (fs::is_directory(in, ec)) {
+            std::vector<std::string> entries;
+            for (const auto& e : fs::directory_iterator(in, ec)) {
+                const std::string name = e.path().filename().string();
+                // Yer gerçeği dosyaları tarama değildir
+                if (e.is_regular_file() && name.find(".truth.") == std::string::npos) {
+                    entries.push_back(e.path().string());
+                }
+            }
+            std::sort(entries.begin(), entries.end());
+            paths.insert(paths.end(), entries.begin(), entries.end());
+        } else {
+            paths.push_back(in);
+        }
+    }
+
+    for (const auto& path : paths) {
+        std::optional<LidarScan> scan = isBinaryScanFile(path) ? loadScanBinary(path) : loadScanFromFile(path);
+        if (!scan) {
+            std::cerr << "[!] Tarama okunamadi: " << path << "\n";
+            return false;
+        }
+        seq.scans.push_back(std::move(*scan));
+
+        // scan_generator varsayılanı: <tarama>.truth.toml
+        std::optional<SensorPose> pose = loadPoseFromTruthFile(path + ".truth.toml");
+        seq.posed += pose ? 1 : 0;
+        seq.poses.push_back(pose.value_or(SensorPose{}));
+    }
+    return !seq.scans.empty();
+}
+
+// Analiz hattı: dönüşüm -> RANSAC -> kesişim, kare başına arena ile (uygulamadaki gibi).
+// incremental verilirse kesişimler kareler arası önbellekle hesaplanır; grid verilirse noktalar
+// RANSAC'tan önce (tampon yeniden sıralanmadan) ızgaraya, map verilirse doğrular haritaya işlenir;
+// live verilirse sonuçlar canlı okuyuculara yayınlanır.
+static size_t analyze(const LidarScan& scan, const CliParams& a, ScanArenaPool& arenas,
+                      IncrementalIntersector<double>* incremental,
+                      OccupancyGrid* grid = nullptr, LineMap* map = nullptr, const SensorPose& pose = {},
+                      SnapshotPublisher<ResultFrame>* live = nullptr) {
+    std::shared_ptr<ScanArena> arena = arenas.acquire();
+    std::pmr::memory_resource* mr = arena->resource();
+    auto points = filterAndConvertToPoints(scan, mr);
+    if (grid) grid->integrate(points, pose);
+    auto segments = findLinesRANSAC(points, a.minInliers, a.epsilon, a.maxIters, mr, a.seed);
+    if (map) map->integrate(points, segments, pose);
+    auto intersections = incremental ? incremental->update(segments, mr)
+                                     : findPhysicalIntersections(segments, a.angleThreshDeg, mr);
+    if (live) {
+        assignResultFrame(live->beginWrite(), points.size(), segments, intersections, StageTimings{});
+        live->publish();
+    }
+    return segments.size() + intersections.size();
+}
+
+static void save_grid(const OccupancyGrid& grid, const ReplayParams& p) {
+    const std::string& path = p.gridPath;
+    if (path.size() >= 4 && path.compare(path.size() - 4, 4, ".svg") == 0) {
+        saveOccupancyToSVG(path, grid, SvgParams{});
+    } else {
+        RasterRenderer raster;
+        raster.renderOccupancy(grid, rasterFormatForPath(path));
+        if (!raster.save(path)) return;
+    }
+
+    size_t occupied = 0, freeCells = 0;
+    const int side = grid.cellsPerSide();
+    for (int y = 0; y < side; ++y) {
+        for (int x = 0; x < side; ++x) {
+            const CellState st = grid.state(grid.originX() + x, grid.originY() + y);
+            occupied += st == CellState::Occupied ? 1 : 0;
+            freeCells += st == CellState::Free ? 1 : 0;
+        }
+    }
+    std::cout << "[i] Doluluk izgarasi: " << grid.stats().scans << " kare, " << side << "x" << side
+              << " hucre (" << grid.memoryBytes() / 1024 << " KB), " << occupied << " dolu / "
+              << freeCells << " bos, " << grid.stats().scrolledTiles << " karo kaydi -> " << path << "\n";
+}
+
+static void save_map(const LineMap& map, const ReplayParams& p) {
+    const std::pmr::vector<Line> lines = map.lines();
+    size_t points = 0;
+    for (const Line& l : lines) points += l.inlierCount;
+    if (!saveResultsJson(p.mapPath, points, lines, std::pmr::vector<Intersection>{}, StageTimings{})) return;
+    std::cout << "[i] Cizgi haritasi: " << map.stats().frames << " kare, " << lines.size()
+              << " parca -> " << p.mapPath << "\n";
+}
+
+// Pano / planlayıcı benzeri tüketiciler: her biri periyodik olarak son yayını okur ve
+// doğrular üzerinde hafif bir iş yapar. Tutarsız (yırtık) görüntü sayılır: inlier'lar ayrıktır,
+// toplamları nokta sayısını aşamaz.
+class LiveReaders {
+public:
+    struct Totals {
+        size_t reads = 0;
+        size_t frames = 0;      // Okuyucu başına görülen farklı yayınların toplamı
+        size_t torn = 0;
+    };
+
+    LiveReaders(SnapshotPublisher<ResultFrame>& publisher, size_t count, double periodMs)
+        : m_totals(count) {
+        const auto period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(periodMs));
+        for (size_t i = 0; i < count; ++i) {
+            // Yuvalar burada alınır: yuva yetmezse hata iş parçacığına değil çağırana düşer
+            m_threads.emplace_back([this, i, period, reader = publisher.reader()]() mutable {
+                Totals& t = m_totals[i];
+                uint64_t last = 0;
+                while (!m_stop.load(std::memory_order_acquire)) {
+                    {
+                        auto snap = reader.read();
+                        uint64_t inliers = 0;
+                        for (const ResultSegment& s : snap->segments) inliers += s.inliers;
+                        t.torn += inliers > snap->pointCount ? 1 : 0;
+                        t.frames += snap.version() != last ? 1 : 0;
+                        last = snap.version();
+                        ++t.reads;
+                    }
+                    std::this_thread::sleep_for(period);
+                }
+            });
+        }
+    }
+
+    ~LiveReaders() { stop(); }
+
+    Totals stop() {
+        m_stop.store(true, std::memory_order_release);
+        for (auto& th : m_threads) th.join();
+        m_threads.clear();
+        Totals sum;
+        for (const Totals& t : m_totals) {
+            sum.reads += t.reads;
+            sum.frames += t.frames;
+            sum.torn += t.torn;
+        }
+        return sum;
+    }
+
+    size_t count() const { return m_totals.size(); }
+
+private:
+    std::vector<Totals> m_totals;
+    std::atomic<bool> m_stop{false};
+    std::vector<std::thread> m_threads;
+};
+
+// grid / map / live verilirse işlenen her kare onlara işlenir
+static ReplayResult replay(const Sequence& seq, const ReplayParams& p, double rateHz,
+                           OccupancyGrid* grid, LineMap* map, SnapshotPublisher<ResultFrame>* live) {
+    const std::vector<LidarScan>& scans = seq.scans;
+    ReplayResult r;
+    r.rateHz = rateHz;
+    r.frames = p.frames > 0 ? p.frames : std::max<size_t>(scans.size(), 100);
+    r.deadlineMs = p.deadlineMs > 0.0 ? p.deadlineMs : 1000.0 / rateHz;
+
+    SpscRing<FrameTicket> ring(p.queue);
+    ScanArenaPool arenas;
+    std::atomic<size_t> dropped{0};
+    std::atomic<bool> producerDone{false};
+
+    std::optional<IncrementalIntersector<double>> incremental;
+    if (p.incrementalTol >= 0.0) {
+        incremental.emplace(p.analysis.angleThreshDeg, p.incrementalTol);
+    }
+    IncrementalIntersector<double>* engine = incremental ? &*incremental : nullptr;
+    size_t pairsEvaluated = 0, pairsReused = 0;
+
+    // Isınma: arena ve ayırıcı ilk karede büyür, ölçüme girmez. Artımlı motor sıfırlanır:
+    // ölçülen 0. kare önbellekteki çiftlerle başlamaz
+    analyze(scans.front(), p.analysis, arenas, engine);
+    if (engine) engine->reset();
+
+    const auto period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / rateHz));
+    const Clock::time_point start = Clock::now() + std::chrono::milliseconds(5);
+
+    // Sürücü: kareleri zamanlamaya göre bırakır, asla beklemez
+    std::thread producer([&ring, &dropped, &producerDone, &r, start, period] {
+        for (size_t k = 0; k < r.frames; ++k) {
+            std::this_thread::sleep_until(start + period * static_cast<Clock::rep>(k));
+            if (!ring.tryPush(FrameTicket{k, Clock::now()})) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        producerDone.store(true, std::memory_order_release);
+    });
+
+    std::vector<double> latencies;
+    latencies.reserve(r.frames);
+    double serviceTotal = 0.0;
+    size_t idleSpins = 0;
+
+    for (;;) {
+        FrameTicket ticket;
+        if (!ring.tryPop(ticket)) {
+            // Önce bitiş bayrağı, sonra halka: son kare kaçırılmaz
+            if (producerDone.load(std::memory_order_acquire) && ring.size() == 0) break;
+            // Kısa süre dön, sonra uyu (tek çekirdekte üreticiyi aç bırakmamak için)
+            if (++idleSpins < 64) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+            continue;
+        }
+        idleSpins = 0;
+
+        if (p.policy == OverloadPolicy::Skip) {
+            FrameTicket newer;
+            while (ring.tryPop(newer)) {
+                ticket = newer;
+                ++r.skipped;
+            }
+        }
+
+        const Clock::time_point begin = Clock::now();
+        const size_t index = ticket.sequence % scans.size();
+        analyze(scans[index], p.analysis, arenas, engine, grid, map, seq.poses[index], live);
+        const Clock::time_point done = Clock::now();
+        if (engine) {
+            pairsEvaluated += engine->stats().pairsEvaluated;
+            pairsReused += engine->stats().pairsReused;
+        }
+
+        const double service = msSince(begin, done);
+        const double latency = msSince(ticket.released, done);
+        serviceTotal += service;
+        r.serviceMaxMs = std::max(r.serviceMaxMs, service);
+        latencies.push_back(latency);
+        if (latency > r.deadlineMs) ++r.missed;
+    }
+    producer.join();
+
+    r.wallSeconds = msSince(start, Clock::now()) / 1000.0;
+    r.dropped = dropped.load();
+    r.processed = latencies.size();
+    r.serviceMeanMs = r.processed > 0 ? serviceTotal / static_cast<double>(r.processed) : 0.0;
+    if (pairsEvaluated + pairsReused > 0) {
+        r.pairsReusedPct = 100.0 * static_cast<double>(pairsReused) / static_cast<double>(pairsEvaluated + pairsReused);
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    r.p50Ms = percentile(latencies, 50);
+    r.p99Ms = percentile(latencies, 99);
+    r.p999Ms = percentile(latencies, 99.9);
+    r.maxMs = latencies.empty() ? 0.0 : latencies.back();
+    return r;
+}
+
+static void print_live(size_t readers, const LiveReaders::Totals& t, const SnapshotPublisher<ResultFrame>::Stats& st) {
+    std::cout << "[i] Canli yayin: " << st.published << " yayin, " << readers << " okuyucu, " << t.reads
+              << " okuma (okuyucu basina " << t.frames / readers << " farkli kare), " << t.torn << " tutarsiz; " << st.allocated
+              << " nesne, " << st.reused << " yeniden kullanim\n";
+}
+
+static void print_result(const ReplayResult& r) {
+    std::printf("%7.1f %7zu %8zu %9zu %6zu %8zu %9.3f %9.3f %9.3f %9.3f %11.3f %8.1f\n",
+                r.rateHz, r.frames, r.processed, r.missed, r.dropped, r.skipped,
+                r.p50Ms, r.p99Ms, r.p999Ms, r.maxMs, r.serviceMeanMs, r.pairsReusedPct);
+}
+
+static void write_result(std::FILE* f, const ReplayResult& r, const ReplayParams& p) {
+    std::fprintf(f,
+        "{\"schema\":\"lidar-replay/1\",\"rate_hz\":%.6g,\"policy\":\"%s\",\"queue\":%zu,"
+        "\"deadline_ms\":%.6g,\"frames\":%zu,\"processed\":%zu,\"missed\":%zu,\"dropped\":%zu,"
+        "\"skipped\":%zu,\"p50_ms\":%.6g,\"p99_ms\":%.6g,\"p999_ms\":%.6g,\"max_ms\":%.6g,"
+        "\"service_mean_ms\":%.6g,\"service_max_ms\":%.6g,\"wall_s\":%.6g,\"pairs_reused_pct\":%.6g}\n",
+        r.rateHz, p.policy == OverloadPolicy::Skip ? "skip" : "queue", p.queue,
+        r.deadlineMs, r.frames, r.processed, r.missed, r.dropped,
+        r.skipped, r.p50Ms, r.p99Ms, r.p999Ms, r.maxMs,
+        r.serviceMeanMs, r.serviceMaxMs, r.wallSeconds, r.pairsReusedPct);
+}
+
+int main(int argc, char* argv[]) {
+    std::optional<ReplayParams> params = parse_args(argc, argv);
+    if (!params) return 1;
+
+    Sequence seq;
+    if (!load_sequence(params->inputs, seq)) {
+        std::cerr << "[!] Oynatilacak tarama yok.\n";
+        return 1;
+    }
+
+    size_t beams = 0;
+    for (const auto& s : seq.scans) beams += s.ranges.size();
+    std::cout << "[i] " << seq.scans.size() << " tarama yuklendi (ortalama "
+              << beams / seq.scans.size() << " isin, " << seq.posed << " pozlu), politika: "
+              << (params->policy == OverloadPolicy::Skip ? "skip" : "queue")
+              << ", halka: " << SpscRing<FrameTicket>(params->queue).capacity() << "\n";
+    std::printf("%7s %7s %8s %9s %6s %8s %9s %9s %9s %9s %11s %8s\n",
+                "hiz_hz", "kare", "islenen", "kacirilan", "dusen", "atlanan",
+                "p50_ms", "p99_ms", "p999_ms", "max_ms", "isleme_ms", "cift_%");
+
+    std::FILE* out = nullptr;
+    if (!params->outPath.empty()) {
+        out = std::fopen(params->outPath.c_str(), "w");
+        if (!out) {
+            std::cerr << "[!] Cikti dosyasi acilamadi: " << params->outPath << "\n";
+            return 1;
+        }
+    }
+
+    for (double rate : params->rates) {
+        std::optional<OccupancyGrid> grid;
+        if (!params->gridPath.empty()) grid.emplace(params->grid);
+        std::optional<LineMap> map;
+        if (!params->mapPath.empty()) map.emplace();
+        // Okuyucular yayıncıdan sonra kurulur, önce yok edilir
+        std::optional<SnapshotPublisher<ResultFrame>> live;
+        std::optional<LiveReaders> readers;
+        if (params->readers > 0) {
+            live.emplace();
+            readers.emplace(*live, params->readers, params->readerPeriodMs);
+        }
+        ReplayResult r = replay(seq, *params, rate, grid ? &*grid : nullptr, map ? &*map : nullptr,
+                                live ? &*live : nullptr);
+        print_result(r);
+        if (grid) save_grid(*grid, *params);
+        if (map) save_map(*map, *params);
+        if (readers) print_live(readers->count(), readers->stop(), live->stats());
+        if (out) write_result(out, r, *params);
+    }
+
+    if (out) std::fclose(out);
+    return 0;
+}